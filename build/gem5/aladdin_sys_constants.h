@@ -0,0 +1 @@
+/tmp/stub/gem5-aladdin/src/aladdin/gem5/aladdin_sys_constants.h
\ No newline at end of file
@@ -0,0 +1 @@
+/tmp/stub/gem5-aladdin/src/aladdin/gem5/sampling_interface.c
\ No newline at end of file
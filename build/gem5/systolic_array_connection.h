@@ -0,0 +1 @@
+/tmp/stub/gem5-aladdin/src/aladdin/../systolic_array/systolic_array_connection.h
\ No newline at end of file
@@ -0,0 +1,18 @@
+SMV_KERNEL_DISPATCH(batch_norm_simd_op)
+SMV_KERNEL_DISPATCH(host_load_fp16)
+SMV_KERNEL_DISPATCH(host_store_fp16)
+SMV_KERNEL_DISPATCH(smv_activation_fun_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_avgpooling_nhwc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_batch_norm_post_conv_nchw_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_batch_norm_post_conv_nhwc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_batch_norm_post_fc_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_conv3d_nhwc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_eltwise_add_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_eltwise_mul_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_greater_equal_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_greater_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_less_equal_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_less_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_matrix_multiply_transpose_nc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_maxpooling_nhwc_vec_fxp)
+SMV_KERNEL_DISPATCH(smv_softmax_nc_vec_fxp)
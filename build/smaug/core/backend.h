@@ -0,0 +1 @@
+/root/repo/smaug/core/backend.h
\ No newline at end of file
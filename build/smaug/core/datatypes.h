@@ -0,0 +1 @@
+/root/repo/smaug/core/datatypes.h
\ No newline at end of file
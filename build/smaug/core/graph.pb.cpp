@@ -0,0 +1,424 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: smaug/core/graph.proto
+
+#include "smaug/core/graph.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace smaug {
+PROTOBUF_CONSTEXPR GraphProto::GraphProto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.nodes_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.backend_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.mem_policy_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct GraphProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR GraphProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~GraphProtoDefaultTypeInternal() {}
+  union {
+    GraphProto _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 GraphProtoDefaultTypeInternal _GraphProto_default_instance_;
+}  // namespace smaug
+static ::_pb::Metadata file_level_metadata_smaug_2fcore_2fgraph_2eproto[1];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_smaug_2fcore_2fgraph_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_smaug_2fcore_2fgraph_2eproto = nullptr;
+
+const uint32_t TableStruct_smaug_2fcore_2fgraph_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::GraphProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::GraphProto, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::smaug::GraphProto, _impl_.nodes_),
+  PROTOBUF_FIELD_OFFSET(::smaug::GraphProto, _impl_.backend_),
+  PROTOBUF_FIELD_OFFSET(::smaug::GraphProto, _impl_.mem_policy_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::smaug::GraphProto)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::smaug::_GraphProto_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_smaug_2fcore_2fgraph_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026smaug/core/graph.proto\022\005smaug\032\025smaug/c"
+  "ore/node.proto\032\026smaug/core/types.proto\"\177"
+  "\n\nGraphProto\022\014\n\004name\030\001 \001(\t\022\037\n\005nodes\030\002 \003("
+  "\0132\020.smaug.NodeProto\022\017\n\007backend\030\003 \001(\t\0221\n\n"
+  "mem_policy\030\004 \001(\0162\035.smaug.HostMemoryAcces"
+  "sPolicyb\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_smaug_2fcore_2fgraph_2eproto_deps[2] = {
+  &::descriptor_table_smaug_2fcore_2fnode_2eproto,
+  &::descriptor_table_smaug_2fcore_2ftypes_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_smaug_2fcore_2fgraph_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_smaug_2fcore_2fgraph_2eproto = {
+    false, false, 215, descriptor_table_protodef_smaug_2fcore_2fgraph_2eproto,
+    "smaug/core/graph.proto",
+    &descriptor_table_smaug_2fcore_2fgraph_2eproto_once, descriptor_table_smaug_2fcore_2fgraph_2eproto_deps, 2, 1,
+    schemas, file_default_instances, TableStruct_smaug_2fcore_2fgraph_2eproto::offsets,
+    file_level_metadata_smaug_2fcore_2fgraph_2eproto, file_level_enum_descriptors_smaug_2fcore_2fgraph_2eproto,
+    file_level_service_descriptors_smaug_2fcore_2fgraph_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_smaug_2fcore_2fgraph_2eproto_getter() {
+  return &descriptor_table_smaug_2fcore_2fgraph_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_smaug_2fcore_2fgraph_2eproto(&descriptor_table_smaug_2fcore_2fgraph_2eproto);
+namespace smaug {
+
+// ===================================================================
+
+class GraphProto::_Internal {
+ public:
+};
+
+void GraphProto::clear_nodes() {
+  _impl_.nodes_.Clear();
+}
+GraphProto::GraphProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.GraphProto)
+}
+GraphProto::GraphProto(const GraphProto& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  GraphProto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){from._impl_.nodes_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.backend_){}
+    , decltype(_impl_.mem_policy_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.backend_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.backend_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_backend().empty()) {
+    _this->_impl_.backend_.Set(from._internal_backend(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.mem_policy_ = from._impl_.mem_policy_;
+  // @@protoc_insertion_point(copy_constructor:smaug.GraphProto)
+}
+
+inline void GraphProto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.nodes_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.backend_){}
+    , decltype(_impl_.mem_policy_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.backend_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.backend_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+GraphProto::~GraphProto() {
+  // @@protoc_insertion_point(destructor:smaug.GraphProto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void GraphProto::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.nodes_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.backend_.Destroy();
+}
+
+void GraphProto::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void GraphProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.GraphProto)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.nodes_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.backend_.ClearToEmpty();
+  _impl_.mem_policy_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GraphProto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "smaug.GraphProto.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .smaug.NodeProto nodes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_nodes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // string backend = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_backend();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "smaug.GraphProto.backend"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.HostMemoryAccessPolicy mem_policy = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_mem_policy(static_cast<::smaug::HostMemoryAccessPolicy>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* GraphProto::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.GraphProto)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "smaug.GraphProto.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // repeated .smaug.NodeProto nodes = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_nodes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_nodes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string backend = 3;
+  if (!this->_internal_backend().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_backend().data(), static_cast<int>(this->_internal_backend().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "smaug.GraphProto.backend");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_backend(), target);
+  }
+
+  // .smaug.HostMemoryAccessPolicy mem_policy = 4;
+  if (this->_internal_mem_policy() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_mem_policy(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.GraphProto)
+  return target;
+}
+
+size_t GraphProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.GraphProto)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .smaug.NodeProto nodes = 2;
+  total_size += 1UL * this->_internal_nodes_size();
+  for (const auto& msg : this->_impl_.nodes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // string backend = 3;
+  if (!this->_internal_backend().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_backend());
+  }
+
+  // .smaug.HostMemoryAccessPolicy mem_policy = 4;
+  if (this->_internal_mem_policy() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_mem_policy());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData GraphProto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    GraphProto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GraphProto::GetClassData() const { return &_class_data_; }
+
+
+void GraphProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<GraphProto*>(&to_msg);
+  auto& from = static_cast<const GraphProto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.GraphProto)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.nodes_.MergeFrom(from._impl_.nodes_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (!from._internal_backend().empty()) {
+    _this->_internal_set_backend(from._internal_backend());
+  }
+  if (from._internal_mem_policy() != 0) {
+    _this->_internal_set_mem_policy(from._internal_mem_policy());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void GraphProto::CopyFrom(const GraphProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.GraphProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GraphProto::IsInitialized() const {
+  return true;
+}
+
+void GraphProto::InternalSwap(GraphProto* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.nodes_.InternalSwap(&other->_impl_.nodes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.backend_, lhs_arena,
+      &other->_impl_.backend_, rhs_arena
+  );
+  swap(_impl_.mem_policy_, other->_impl_.mem_policy_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GraphProto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fgraph_2eproto_getter, &descriptor_table_smaug_2fcore_2fgraph_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fgraph_2eproto[0]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace smaug
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::smaug::GraphProto*
+Arena::CreateMaybeMessage< ::smaug::GraphProto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::GraphProto >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
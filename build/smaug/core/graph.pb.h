@@ -0,0 +1,438 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: smaug/core/graph.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_smaug_2fcore_2fgraph_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_smaug_2fcore_2fgraph_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "smaug/core/node.pb.h"
+#include "smaug/core/types.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_smaug_2fcore_2fgraph_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_smaug_2fcore_2fgraph_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_smaug_2fcore_2fgraph_2eproto;
+namespace smaug {
+class GraphProto;
+struct GraphProtoDefaultTypeInternal;
+extern GraphProtoDefaultTypeInternal _GraphProto_default_instance_;
+}  // namespace smaug
+PROTOBUF_NAMESPACE_OPEN
+template<> ::smaug::GraphProto* Arena::CreateMaybeMessage<::smaug::GraphProto>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace smaug {
+
+// ===================================================================
+
+class GraphProto final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:smaug.GraphProto) */ {
+ public:
+  inline GraphProto() : GraphProto(nullptr) {}
+  ~GraphProto() override;
+  explicit PROTOBUF_CONSTEXPR GraphProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  GraphProto(const GraphProto& from);
+  GraphProto(GraphProto&& from) noexcept
+    : GraphProto() {
+    *this = ::std::move(from);
+  }
+
+  inline GraphProto& operator=(const GraphProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GraphProto& operator=(GraphProto&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const GraphProto& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const GraphProto* internal_default_instance() {
+    return reinterpret_cast<const GraphProto*>(
+               &_GraphProto_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(GraphProto& a, GraphProto& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GraphProto* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GraphProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  GraphProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<GraphProto>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const GraphProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const GraphProto& from) {
+    GraphProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GraphProto* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "smaug.GraphProto";
+  }
+  protected:
+  explicit GraphProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNodesFieldNumber = 2,
+    kNameFieldNumber = 1,
+    kBackendFieldNumber = 3,
+    kMemPolicyFieldNumber = 4,
+  };
+  // repeated .smaug.NodeProto nodes = 2;
+  int nodes_size() const;
+  private:
+  int _internal_nodes_size() const;
+  public:
+  void clear_nodes();
+  ::smaug::NodeProto* mutable_nodes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::NodeProto >*
+      mutable_nodes();
+  private:
+  const ::smaug::NodeProto& _internal_nodes(int index) const;
+  ::smaug::NodeProto* _internal_add_nodes();
+  public:
+  const ::smaug::NodeProto& nodes(int index) const;
+  ::smaug::NodeProto* add_nodes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::NodeProto >&
+      nodes() const;
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // string backend = 3;
+  void clear_backend();
+  const std::string& backend() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_backend(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_backend();
+  PROTOBUF_NODISCARD std::string* release_backend();
+  void set_allocated_backend(std::string* backend);
+  private:
+  const std::string& _internal_backend() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_backend(const std::string& value);
+  std::string* _internal_mutable_backend();
+  public:
+
+  // .smaug.HostMemoryAccessPolicy mem_policy = 4;
+  void clear_mem_policy();
+  ::smaug::HostMemoryAccessPolicy mem_policy() const;
+  void set_mem_policy(::smaug::HostMemoryAccessPolicy value);
+  private:
+  ::smaug::HostMemoryAccessPolicy _internal_mem_policy() const;
+  void _internal_set_mem_policy(::smaug::HostMemoryAccessPolicy value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:smaug.GraphProto)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::NodeProto > nodes_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr backend_;
+    int mem_policy_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_smaug_2fcore_2fgraph_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// GraphProto
+
+// string name = 1;
+inline void GraphProto::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& GraphProto::name() const {
+  // @@protoc_insertion_point(field_get:smaug.GraphProto.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GraphProto::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:smaug.GraphProto.name)
+}
+inline std::string* GraphProto::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:smaug.GraphProto.name)
+  return _s;
+}
+inline const std::string& GraphProto::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void GraphProto::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GraphProto::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GraphProto::release_name() {
+  // @@protoc_insertion_point(field_release:smaug.GraphProto.name)
+  return _impl_.name_.Release();
+}
+inline void GraphProto::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:smaug.GraphProto.name)
+}
+
+// repeated .smaug.NodeProto nodes = 2;
+inline int GraphProto::_internal_nodes_size() const {
+  return _impl_.nodes_.size();
+}
+inline int GraphProto::nodes_size() const {
+  return _internal_nodes_size();
+}
+inline ::smaug::NodeProto* GraphProto::mutable_nodes(int index) {
+  // @@protoc_insertion_point(field_mutable:smaug.GraphProto.nodes)
+  return _impl_.nodes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::NodeProto >*
+GraphProto::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.GraphProto.nodes)
+  return &_impl_.nodes_;
+}
+inline const ::smaug::NodeProto& GraphProto::_internal_nodes(int index) const {
+  return _impl_.nodes_.Get(index);
+}
+inline const ::smaug::NodeProto& GraphProto::nodes(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.GraphProto.nodes)
+  return _internal_nodes(index);
+}
+inline ::smaug::NodeProto* GraphProto::_internal_add_nodes() {
+  return _impl_.nodes_.Add();
+}
+inline ::smaug::NodeProto* GraphProto::add_nodes() {
+  ::smaug::NodeProto* _add = _internal_add_nodes();
+  // @@protoc_insertion_point(field_add:smaug.GraphProto.nodes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::NodeProto >&
+GraphProto::nodes() const {
+  // @@protoc_insertion_point(field_list:smaug.GraphProto.nodes)
+  return _impl_.nodes_;
+}
+
+// string backend = 3;
+inline void GraphProto::clear_backend() {
+  _impl_.backend_.ClearToEmpty();
+}
+inline const std::string& GraphProto::backend() const {
+  // @@protoc_insertion_point(field_get:smaug.GraphProto.backend)
+  return _internal_backend();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void GraphProto::set_backend(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.backend_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:smaug.GraphProto.backend)
+}
+inline std::string* GraphProto::mutable_backend() {
+  std::string* _s = _internal_mutable_backend();
+  // @@protoc_insertion_point(field_mutable:smaug.GraphProto.backend)
+  return _s;
+}
+inline const std::string& GraphProto::_internal_backend() const {
+  return _impl_.backend_.Get();
+}
+inline void GraphProto::_internal_set_backend(const std::string& value) {
+  
+  _impl_.backend_.Set(value, GetArenaForAllocation());
+}
+inline std::string* GraphProto::_internal_mutable_backend() {
+  
+  return _impl_.backend_.Mutable(GetArenaForAllocation());
+}
+inline std::string* GraphProto::release_backend() {
+  // @@protoc_insertion_point(field_release:smaug.GraphProto.backend)
+  return _impl_.backend_.Release();
+}
+inline void GraphProto::set_allocated_backend(std::string* backend) {
+  if (backend != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.backend_.SetAllocated(backend, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.backend_.IsDefault()) {
+    _impl_.backend_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:smaug.GraphProto.backend)
+}
+
+// .smaug.HostMemoryAccessPolicy mem_policy = 4;
+inline void GraphProto::clear_mem_policy() {
+  _impl_.mem_policy_ = 0;
+}
+inline ::smaug::HostMemoryAccessPolicy GraphProto::_internal_mem_policy() const {
+  return static_cast< ::smaug::HostMemoryAccessPolicy >(_impl_.mem_policy_);
+}
+inline ::smaug::HostMemoryAccessPolicy GraphProto::mem_policy() const {
+  // @@protoc_insertion_point(field_get:smaug.GraphProto.mem_policy)
+  return _internal_mem_policy();
+}
+inline void GraphProto::_internal_set_mem_policy(::smaug::HostMemoryAccessPolicy value) {
+  
+  _impl_.mem_policy_ = value;
+}
+inline void GraphProto::set_mem_policy(::smaug::HostMemoryAccessPolicy value) {
+  _internal_set_mem_policy(value);
+  // @@protoc_insertion_point(field_set:smaug.GraphProto.mem_policy)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace smaug
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_smaug_2fcore_2fgraph_2eproto
@@ -0,0 +1,27 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: smaug/core/graph.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+from smaug.core import node_pb2 as smaug_dot_core_dot_node__pb2
+from smaug.core import types_pb2 as smaug_dot_core_dot_types__pb2
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x16smaug/core/graph.proto\x12\x05smaug\x1a\x15smaug/core/node.proto\x1a\x16smaug/core/types.proto\"\x7f\n\nGraphProto\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x1f\n\x05nodes\x18\x02 \x03(\x0b\x32\x10.smaug.NodeProto\x12\x0f\n\x07\x62\x61\x63kend\x18\x03 \x01(\t\x12\x31\n\nmem_policy\x18\x04 \x01(\x0e\x32\x1d.smaug.HostMemoryAccessPolicyb\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'smaug.core.graph_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _GRAPHPROTO._serialized_start=80
+  _GRAPHPROTO._serialized_end=207
+# @@protoc_insertion_point(module_scope)
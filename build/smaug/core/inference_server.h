@@ -0,0 +1 @@
+/root/repo/smaug/core/inference_server.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/core/inference_server_test.cpp
\ No newline at end of file
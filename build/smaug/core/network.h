@@ -0,0 +1 @@
+/root/repo/smaug/core/network.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/core/network_builder.h
\ No newline at end of file
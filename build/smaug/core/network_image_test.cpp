@@ -0,0 +1 @@
+/root/repo/smaug/core/network_image_test.cpp
\ No newline at end of file
@@ -0,0 +1,3435 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: smaug/core/node.proto
+
+#include "smaug/core/node.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace smaug {
+PROTOBUF_CONSTEXPR ConvParams::ConvParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stride_)*/{}
+  , /*decltype(_impl_._stride_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.padding_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConvParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConvParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConvParamsDefaultTypeInternal() {}
+  union {
+    ConvParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConvParamsDefaultTypeInternal _ConvParams_default_instance_;
+PROTOBUF_CONSTEXPR PoolParams::PoolParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stride_)*/{}
+  , /*decltype(_impl_._stride_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.pool_size_)*/{}
+  , /*decltype(_impl_._pool_size_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PoolParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PoolParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PoolParamsDefaultTypeInternal() {}
+  union {
+    PoolParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PoolParamsDefaultTypeInternal _PoolParams_default_instance_;
+PROTOBUF_CONSTEXPR PaddingParams::PaddingParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.padding_size_)*/{}
+  , /*decltype(_impl_._padding_size_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PaddingParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PaddingParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PaddingParamsDefaultTypeInternal() {}
+  union {
+    PaddingParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PaddingParamsDefaultTypeInternal _PaddingParams_default_instance_;
+PROTOBUF_CONSTEXPR ConcatParams::ConcatParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.concat_axis_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ConcatParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConcatParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConcatParamsDefaultTypeInternal() {}
+  union {
+    ConcatParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConcatParamsDefaultTypeInternal _ConcatParams_default_instance_;
+PROTOBUF_CONSTEXPR SplitParams::SplitParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.split_axis_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SplitParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SplitParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SplitParamsDefaultTypeInternal() {}
+  union {
+    SplitParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SplitParamsDefaultTypeInternal _SplitParams_default_instance_;
+PROTOBUF_CONSTEXPR LreluParams::LreluParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.slope_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LreluParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LreluParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LreluParamsDefaultTypeInternal() {}
+  union {
+    LreluParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LreluParamsDefaultTypeInternal _LreluParams_default_instance_;
+PROTOBUF_CONSTEXPR EluParams::EluParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.alpha_)*/0
+  , /*decltype(_impl_.lambda_param_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EluParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EluParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EluParamsDefaultTypeInternal() {}
+  union {
+    EluParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EluParamsDefaultTypeInternal _EluParams_default_instance_;
+PROTOBUF_CONSTEXPR HardTanhParams::HardTanhParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.min_)*/0
+  , /*decltype(_impl_.max_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct HardTanhParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HardTanhParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HardTanhParamsDefaultTypeInternal() {}
+  union {
+    HardTanhParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HardTanhParamsDefaultTypeInternal _HardTanhParams_default_instance_;
+PROTOBUF_CONSTEXPR ActivationParams::ActivationParams(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.activation_)*/0
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ActivationParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ActivationParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ActivationParamsDefaultTypeInternal() {}
+  union {
+    ActivationParams _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ActivationParamsDefaultTypeInternal _ActivationParams_default_instance_;
+PROTOBUF_CONSTEXPR Params::Params(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.act_params_)*/nullptr
+  , /*decltype(_impl_.value_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ParamsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ParamsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ParamsDefaultTypeInternal() {}
+  union {
+    Params _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ParamsDefaultTypeInternal _Params_default_instance_;
+PROTOBUF_CONSTEXPR NodeProto::NodeProto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.parents_)*/{}
+  , /*decltype(_impl_.src_tensors_indices_)*/{}
+  , /*decltype(_impl_._src_tensors_indices_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.input_tensors_)*/{}
+  , /*decltype(_impl_.output_tensors_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.params_)*/nullptr
+  , /*decltype(_impl_.op_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NodeProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NodeProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NodeProtoDefaultTypeInternal() {}
+  union {
+    NodeProto _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NodeProtoDefaultTypeInternal _NodeProto_default_instance_;
+}  // namespace smaug
+static ::_pb::Metadata file_level_metadata_smaug_2fcore_2fnode_2eproto[11];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_smaug_2fcore_2fnode_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_smaug_2fcore_2fnode_2eproto = nullptr;
+
+const uint32_t TableStruct_smaug_2fcore_2fnode_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::ConvParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::ConvParams, _impl_.padding_),
+  PROTOBUF_FIELD_OFFSET(::smaug::ConvParams, _impl_.stride_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::PoolParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::PoolParams, _impl_.stride_),
+  PROTOBUF_FIELD_OFFSET(::smaug::PoolParams, _impl_.pool_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::PaddingParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::PaddingParams, _impl_.padding_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::ConcatParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::ConcatParams, _impl_.concat_axis_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::SplitParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::SplitParams, _impl_.split_axis_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::LreluParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::LreluParams, _impl_.slope_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::EluParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::EluParams, _impl_.alpha_),
+  PROTOBUF_FIELD_OFFSET(::smaug::EluParams, _impl_.lambda_param_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::HardTanhParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::HardTanhParams, _impl_.min_),
+  PROTOBUF_FIELD_OFFSET(::smaug::HardTanhParams, _impl_.max_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::ActivationParams, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::smaug::ActivationParams, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::ActivationParams, _impl_.activation_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::smaug::ActivationParams, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::Params, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::smaug::Params, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::smaug::Params, _impl_.act_params_),
+  PROTOBUF_FIELD_OFFSET(::smaug::Params, _impl_.value_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::NodeProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::NodeProto, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::smaug::NodeProto, _impl_.op_),
+  PROTOBUF_FIELD_OFFSET(::smaug::NodeProto, _impl_.parents_),
+  PROTOBUF_FIELD_OFFSET(::smaug::NodeProto, _impl_.src_tensors_indices_),
+  PROTOBUF_FIELD_OFFSET(::smaug::NodeProto, _impl_.input_tensors_),
+  PROTOBUF_FIELD_OFFSET(::smaug::NodeProto, _impl_.output_tensors_),
+  PROTOBUF_FIELD_OFFSET(::smaug::NodeProto, _impl_.params_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::smaug::ConvParams)},
+  { 8, -1, -1, sizeof(::smaug::PoolParams)},
+  { 16, -1, -1, sizeof(::smaug::PaddingParams)},
+  { 23, -1, -1, sizeof(::smaug::ConcatParams)},
+  { 30, -1, -1, sizeof(::smaug::SplitParams)},
+  { 37, -1, -1, sizeof(::smaug::LreluParams)},
+  { 44, -1, -1, sizeof(::smaug::EluParams)},
+  { 52, -1, -1, sizeof(::smaug::HardTanhParams)},
+  { 60, -1, -1, sizeof(::smaug::ActivationParams)},
+  { 71, -1, -1, sizeof(::smaug::Params)},
+  { 84, -1, -1, sizeof(::smaug::NodeProto)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::smaug::_ConvParams_default_instance_._instance,
+  &::smaug::_PoolParams_default_instance_._instance,
+  &::smaug::_PaddingParams_default_instance_._instance,
+  &::smaug::_ConcatParams_default_instance_._instance,
+  &::smaug::_SplitParams_default_instance_._instance,
+  &::smaug::_LreluParams_default_instance_._instance,
+  &::smaug::_EluParams_default_instance_._instance,
+  &::smaug::_HardTanhParams_default_instance_._instance,
+  &::smaug::_ActivationParams_default_instance_._instance,
+  &::smaug::_Params_default_instance_._instance,
+  &::smaug::_NodeProto_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_smaug_2fcore_2fnode_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\025smaug/core/node.proto\022\005smaug\032\027smaug/co"
+  "re/tensor.proto\032\026smaug/core/types.proto\""
+  "A\n\nConvParams\022#\n\007padding\030\001 \001(\0162\022.smaug.P"
+  "addingType\022\016\n\006stride\030\002 \003(\005\"/\n\nPoolParams"
+  "\022\016\n\006stride\030\001 \003(\005\022\021\n\tpool_size\030\002 \003(\005\"%\n\rP"
+  "addingParams\022\024\n\014padding_size\030\001 \003(\005\"#\n\014Co"
+  "ncatParams\022\023\n\013concat_axis\030\001 \001(\005\"!\n\013Split"
+  "Params\022\022\n\nsplit_axis\030\001 \001(\005\"\034\n\013LreluParam"
+  "s\022\r\n\005slope\030\001 \001(\002\"0\n\tEluParams\022\r\n\005alpha\030\001"
+  " \001(\002\022\024\n\014lambda_param\030\002 \001(\002\"*\n\016HardTanhPa"
+  "rams\022\013\n\003min\030\001 \001(\002\022\013\n\003max\030\002 \001(\002\"\305\001\n\020Activ"
+  "ationParams\022!\n\nactivation\030\001 \001(\0162\r.smaug."
+  "OpType\022*\n\014lrelu_params\030\002 \001(\0132\022.smaug.Lre"
+  "luParamsH\000\022&\n\nelu_params\030\003 \001(\0132\020.smaug.E"
+  "luParamsH\000\0221\n\020hard_tanh_params\030\004 \001(\0132\025.s"
+  "maug.HardTanhParamsH\000B\007\n\005value\"\234\002\n\006Param"
+  "s\022(\n\013conv_params\030\001 \001(\0132\021.smaug.ConvParam"
+  "sH\000\022(\n\013pool_params\030\002 \001(\0132\021.smaug.PoolPar"
+  "amsH\000\022,\n\rconcat_params\030\004 \001(\0132\023.smaug.Con"
+  "catParamsH\000\022*\n\014split_params\030\005 \001(\0132\022.smau"
+  "g.SplitParamsH\000\022.\n\016padding_params\030\006 \001(\0132"
+  "\024.smaug.PaddingParamsH\000\022+\n\nact_params\030\003 "
+  "\001(\0132\027.smaug.ActivationParamsB\007\n\005value\"\330\001"
+  "\n\tNodeProto\022\014\n\004name\030\001 \001(\t\022\031\n\002op\030\002 \001(\0162\r."
+  "smaug.OpType\022\017\n\007parents\030\003 \003(\t\022\033\n\023src_ten"
+  "sors_indices\030\005 \003(\005\022)\n\rinput_tensors\030\006 \003("
+  "\0132\022.smaug.TensorProto\022*\n\016output_tensors\030"
+  "\007 \003(\0132\022.smaug.TensorProto\022\035\n\006params\030\010 \001("
+  "\0132\r.smaug.Paramsb\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_smaug_2fcore_2fnode_2eproto_deps[2] = {
+  &::descriptor_table_smaug_2fcore_2ftensor_2eproto,
+  &::descriptor_table_smaug_2fcore_2ftypes_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_smaug_2fcore_2fnode_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_smaug_2fcore_2fnode_2eproto = {
+    false, false, 1144, descriptor_table_protodef_smaug_2fcore_2fnode_2eproto,
+    "smaug/core/node.proto",
+    &descriptor_table_smaug_2fcore_2fnode_2eproto_once, descriptor_table_smaug_2fcore_2fnode_2eproto_deps, 2, 11,
+    schemas, file_default_instances, TableStruct_smaug_2fcore_2fnode_2eproto::offsets,
+    file_level_metadata_smaug_2fcore_2fnode_2eproto, file_level_enum_descriptors_smaug_2fcore_2fnode_2eproto,
+    file_level_service_descriptors_smaug_2fcore_2fnode_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_smaug_2fcore_2fnode_2eproto_getter() {
+  return &descriptor_table_smaug_2fcore_2fnode_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_smaug_2fcore_2fnode_2eproto(&descriptor_table_smaug_2fcore_2fnode_2eproto);
+namespace smaug {
+
+// ===================================================================
+
+class ConvParams::_Internal {
+ public:
+};
+
+ConvParams::ConvParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.ConvParams)
+}
+ConvParams::ConvParams(const ConvParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConvParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stride_){from._impl_.stride_}
+    , /*decltype(_impl_._stride_cached_byte_size_)*/{0}
+    , decltype(_impl_.padding_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.padding_ = from._impl_.padding_;
+  // @@protoc_insertion_point(copy_constructor:smaug.ConvParams)
+}
+
+inline void ConvParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stride_){arena}
+    , /*decltype(_impl_._stride_cached_byte_size_)*/{0}
+    , decltype(_impl_.padding_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ConvParams::~ConvParams() {
+  // @@protoc_insertion_point(destructor:smaug.ConvParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConvParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stride_.~RepeatedField();
+}
+
+void ConvParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConvParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.ConvParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stride_.Clear();
+  _impl_.padding_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConvParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .smaug.PaddingType padding = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_padding(static_cast<::smaug::PaddingType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 stride = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_stride(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_stride(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConvParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.ConvParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .smaug.PaddingType padding = 1;
+  if (this->_internal_padding() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_padding(), target);
+  }
+
+  // repeated int32 stride = 2;
+  {
+    int byte_size = _impl_._stride_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_stride(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.ConvParams)
+  return target;
+}
+
+size_t ConvParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.ConvParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 stride = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.stride_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._stride_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // .smaug.PaddingType padding = 1;
+  if (this->_internal_padding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_padding());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConvParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConvParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConvParams::GetClassData() const { return &_class_data_; }
+
+
+void ConvParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConvParams*>(&to_msg);
+  auto& from = static_cast<const ConvParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.ConvParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stride_.MergeFrom(from._impl_.stride_);
+  if (from._internal_padding() != 0) {
+    _this->_internal_set_padding(from._internal_padding());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConvParams::CopyFrom(const ConvParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.ConvParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConvParams::IsInitialized() const {
+  return true;
+}
+
+void ConvParams::InternalSwap(ConvParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stride_.InternalSwap(&other->_impl_.stride_);
+  swap(_impl_.padding_, other->_impl_.padding_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConvParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[0]);
+}
+
+// ===================================================================
+
+class PoolParams::_Internal {
+ public:
+};
+
+PoolParams::PoolParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.PoolParams)
+}
+PoolParams::PoolParams(const PoolParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PoolParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stride_){from._impl_.stride_}
+    , /*decltype(_impl_._stride_cached_byte_size_)*/{0}
+    , decltype(_impl_.pool_size_){from._impl_.pool_size_}
+    , /*decltype(_impl_._pool_size_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:smaug.PoolParams)
+}
+
+inline void PoolParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stride_){arena}
+    , /*decltype(_impl_._stride_cached_byte_size_)*/{0}
+    , decltype(_impl_.pool_size_){arena}
+    , /*decltype(_impl_._pool_size_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PoolParams::~PoolParams() {
+  // @@protoc_insertion_point(destructor:smaug.PoolParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PoolParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stride_.~RepeatedField();
+  _impl_.pool_size_.~RepeatedField();
+}
+
+void PoolParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PoolParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.PoolParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stride_.Clear();
+  _impl_.pool_size_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PoolParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 stride = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_stride(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_stride(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 pool_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_pool_size(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_pool_size(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PoolParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.PoolParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 stride = 1;
+  {
+    int byte_size = _impl_._stride_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_stride(), byte_size, target);
+    }
+  }
+
+  // repeated int32 pool_size = 2;
+  {
+    int byte_size = _impl_._pool_size_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_pool_size(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.PoolParams)
+  return target;
+}
+
+size_t PoolParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.PoolParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 stride = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.stride_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._stride_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int32 pool_size = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.pool_size_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._pool_size_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PoolParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PoolParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PoolParams::GetClassData() const { return &_class_data_; }
+
+
+void PoolParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PoolParams*>(&to_msg);
+  auto& from = static_cast<const PoolParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.PoolParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stride_.MergeFrom(from._impl_.stride_);
+  _this->_impl_.pool_size_.MergeFrom(from._impl_.pool_size_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PoolParams::CopyFrom(const PoolParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.PoolParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PoolParams::IsInitialized() const {
+  return true;
+}
+
+void PoolParams::InternalSwap(PoolParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stride_.InternalSwap(&other->_impl_.stride_);
+  _impl_.pool_size_.InternalSwap(&other->_impl_.pool_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PoolParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[1]);
+}
+
+// ===================================================================
+
+class PaddingParams::_Internal {
+ public:
+};
+
+PaddingParams::PaddingParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.PaddingParams)
+}
+PaddingParams::PaddingParams(const PaddingParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PaddingParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.padding_size_){from._impl_.padding_size_}
+    , /*decltype(_impl_._padding_size_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:smaug.PaddingParams)
+}
+
+inline void PaddingParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.padding_size_){arena}
+    , /*decltype(_impl_._padding_size_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PaddingParams::~PaddingParams() {
+  // @@protoc_insertion_point(destructor:smaug.PaddingParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PaddingParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.padding_size_.~RepeatedField();
+}
+
+void PaddingParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PaddingParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.PaddingParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.padding_size_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PaddingParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 padding_size = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_padding_size(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_padding_size(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PaddingParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.PaddingParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 padding_size = 1;
+  {
+    int byte_size = _impl_._padding_size_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_padding_size(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.PaddingParams)
+  return target;
+}
+
+size_t PaddingParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.PaddingParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 padding_size = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.padding_size_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._padding_size_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PaddingParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PaddingParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PaddingParams::GetClassData() const { return &_class_data_; }
+
+
+void PaddingParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PaddingParams*>(&to_msg);
+  auto& from = static_cast<const PaddingParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.PaddingParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.padding_size_.MergeFrom(from._impl_.padding_size_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PaddingParams::CopyFrom(const PaddingParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.PaddingParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PaddingParams::IsInitialized() const {
+  return true;
+}
+
+void PaddingParams::InternalSwap(PaddingParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.padding_size_.InternalSwap(&other->_impl_.padding_size_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PaddingParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[2]);
+}
+
+// ===================================================================
+
+class ConcatParams::_Internal {
+ public:
+};
+
+ConcatParams::ConcatParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.ConcatParams)
+}
+ConcatParams::ConcatParams(const ConcatParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ConcatParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.concat_axis_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.concat_axis_ = from._impl_.concat_axis_;
+  // @@protoc_insertion_point(copy_constructor:smaug.ConcatParams)
+}
+
+inline void ConcatParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.concat_axis_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ConcatParams::~ConcatParams() {
+  // @@protoc_insertion_point(destructor:smaug.ConcatParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConcatParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ConcatParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConcatParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.ConcatParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.concat_axis_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ConcatParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 concat_axis = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.concat_axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConcatParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.ConcatParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 concat_axis = 1;
+  if (this->_internal_concat_axis() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_concat_axis(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.ConcatParams)
+  return target;
+}
+
+size_t ConcatParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.ConcatParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 concat_axis = 1;
+  if (this->_internal_concat_axis() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_concat_axis());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ConcatParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ConcatParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ConcatParams::GetClassData() const { return &_class_data_; }
+
+
+void ConcatParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ConcatParams*>(&to_msg);
+  auto& from = static_cast<const ConcatParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.ConcatParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_concat_axis() != 0) {
+    _this->_internal_set_concat_axis(from._internal_concat_axis());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ConcatParams::CopyFrom(const ConcatParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.ConcatParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConcatParams::IsInitialized() const {
+  return true;
+}
+
+void ConcatParams::InternalSwap(ConcatParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.concat_axis_, other->_impl_.concat_axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ConcatParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[3]);
+}
+
+// ===================================================================
+
+class SplitParams::_Internal {
+ public:
+};
+
+SplitParams::SplitParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.SplitParams)
+}
+SplitParams::SplitParams(const SplitParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SplitParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.split_axis_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.split_axis_ = from._impl_.split_axis_;
+  // @@protoc_insertion_point(copy_constructor:smaug.SplitParams)
+}
+
+inline void SplitParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.split_axis_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SplitParams::~SplitParams() {
+  // @@protoc_insertion_point(destructor:smaug.SplitParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SplitParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SplitParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SplitParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.SplitParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.split_axis_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SplitParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 split_axis = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.split_axis_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SplitParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.SplitParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 split_axis = 1;
+  if (this->_internal_split_axis() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_split_axis(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.SplitParams)
+  return target;
+}
+
+size_t SplitParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.SplitParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 split_axis = 1;
+  if (this->_internal_split_axis() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_split_axis());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SplitParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SplitParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SplitParams::GetClassData() const { return &_class_data_; }
+
+
+void SplitParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SplitParams*>(&to_msg);
+  auto& from = static_cast<const SplitParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.SplitParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_split_axis() != 0) {
+    _this->_internal_set_split_axis(from._internal_split_axis());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SplitParams::CopyFrom(const SplitParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.SplitParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SplitParams::IsInitialized() const {
+  return true;
+}
+
+void SplitParams::InternalSwap(SplitParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.split_axis_, other->_impl_.split_axis_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SplitParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[4]);
+}
+
+// ===================================================================
+
+class LreluParams::_Internal {
+ public:
+};
+
+LreluParams::LreluParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.LreluParams)
+}
+LreluParams::LreluParams(const LreluParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LreluParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slope_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.slope_ = from._impl_.slope_;
+  // @@protoc_insertion_point(copy_constructor:smaug.LreluParams)
+}
+
+inline void LreluParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.slope_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LreluParams::~LreluParams() {
+  // @@protoc_insertion_point(destructor:smaug.LreluParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LreluParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void LreluParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LreluParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.LreluParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.slope_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LreluParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float slope = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.slope_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LreluParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.LreluParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float slope = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_slope = this->_internal_slope();
+  uint32_t raw_slope;
+  memcpy(&raw_slope, &tmp_slope, sizeof(tmp_slope));
+  if (raw_slope != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_slope(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.LreluParams)
+  return target;
+}
+
+size_t LreluParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.LreluParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float slope = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_slope = this->_internal_slope();
+  uint32_t raw_slope;
+  memcpy(&raw_slope, &tmp_slope, sizeof(tmp_slope));
+  if (raw_slope != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LreluParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LreluParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LreluParams::GetClassData() const { return &_class_data_; }
+
+
+void LreluParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LreluParams*>(&to_msg);
+  auto& from = static_cast<const LreluParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.LreluParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_slope = from._internal_slope();
+  uint32_t raw_slope;
+  memcpy(&raw_slope, &tmp_slope, sizeof(tmp_slope));
+  if (raw_slope != 0) {
+    _this->_internal_set_slope(from._internal_slope());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LreluParams::CopyFrom(const LreluParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.LreluParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LreluParams::IsInitialized() const {
+  return true;
+}
+
+void LreluParams::InternalSwap(LreluParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.slope_, other->_impl_.slope_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LreluParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[5]);
+}
+
+// ===================================================================
+
+class EluParams::_Internal {
+ public:
+};
+
+EluParams::EluParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.EluParams)
+}
+EluParams::EluParams(const EluParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EluParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.alpha_){}
+    , decltype(_impl_.lambda_param_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.alpha_, &from._impl_.alpha_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lambda_param_) -
+    reinterpret_cast<char*>(&_impl_.alpha_)) + sizeof(_impl_.lambda_param_));
+  // @@protoc_insertion_point(copy_constructor:smaug.EluParams)
+}
+
+inline void EluParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.alpha_){0}
+    , decltype(_impl_.lambda_param_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+EluParams::~EluParams() {
+  // @@protoc_insertion_point(destructor:smaug.EluParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EluParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EluParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EluParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.EluParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.alpha_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lambda_param_) -
+      reinterpret_cast<char*>(&_impl_.alpha_)) + sizeof(_impl_.lambda_param_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EluParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float alpha = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.alpha_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float lambda_param = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.lambda_param_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EluParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.EluParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float alpha = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_alpha = this->_internal_alpha();
+  uint32_t raw_alpha;
+  memcpy(&raw_alpha, &tmp_alpha, sizeof(tmp_alpha));
+  if (raw_alpha != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_alpha(), target);
+  }
+
+  // float lambda_param = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lambda_param = this->_internal_lambda_param();
+  uint32_t raw_lambda_param;
+  memcpy(&raw_lambda_param, &tmp_lambda_param, sizeof(tmp_lambda_param));
+  if (raw_lambda_param != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_lambda_param(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.EluParams)
+  return target;
+}
+
+size_t EluParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.EluParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float alpha = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_alpha = this->_internal_alpha();
+  uint32_t raw_alpha;
+  memcpy(&raw_alpha, &tmp_alpha, sizeof(tmp_alpha));
+  if (raw_alpha != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float lambda_param = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lambda_param = this->_internal_lambda_param();
+  uint32_t raw_lambda_param;
+  memcpy(&raw_lambda_param, &tmp_lambda_param, sizeof(tmp_lambda_param));
+  if (raw_lambda_param != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EluParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EluParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EluParams::GetClassData() const { return &_class_data_; }
+
+
+void EluParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EluParams*>(&to_msg);
+  auto& from = static_cast<const EluParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.EluParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_alpha = from._internal_alpha();
+  uint32_t raw_alpha;
+  memcpy(&raw_alpha, &tmp_alpha, sizeof(tmp_alpha));
+  if (raw_alpha != 0) {
+    _this->_internal_set_alpha(from._internal_alpha());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_lambda_param = from._internal_lambda_param();
+  uint32_t raw_lambda_param;
+  memcpy(&raw_lambda_param, &tmp_lambda_param, sizeof(tmp_lambda_param));
+  if (raw_lambda_param != 0) {
+    _this->_internal_set_lambda_param(from._internal_lambda_param());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EluParams::CopyFrom(const EluParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.EluParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EluParams::IsInitialized() const {
+  return true;
+}
+
+void EluParams::InternalSwap(EluParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EluParams, _impl_.lambda_param_)
+      + sizeof(EluParams::_impl_.lambda_param_)
+      - PROTOBUF_FIELD_OFFSET(EluParams, _impl_.alpha_)>(
+          reinterpret_cast<char*>(&_impl_.alpha_),
+          reinterpret_cast<char*>(&other->_impl_.alpha_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EluParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[6]);
+}
+
+// ===================================================================
+
+class HardTanhParams::_Internal {
+ public:
+};
+
+HardTanhParams::HardTanhParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.HardTanhParams)
+}
+HardTanhParams::HardTanhParams(const HardTanhParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  HardTanhParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_){}
+    , decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.min_, &from._impl_.min_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:smaug.HardTanhParams)
+}
+
+inline void HardTanhParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.min_){0}
+    , decltype(_impl_.max_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+HardTanhParams::~HardTanhParams() {
+  // @@protoc_insertion_point(destructor:smaug.HardTanhParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void HardTanhParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void HardTanhParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void HardTanhParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.HardTanhParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.min_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.min_)) + sizeof(_impl_.max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* HardTanhParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // float min = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 13)) {
+          _impl_.min_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // float max = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr);
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* HardTanhParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.HardTanhParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // float min = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_min = this->_internal_min();
+  uint32_t raw_min;
+  memcpy(&raw_min, &tmp_min, sizeof(tmp_min));
+  if (raw_min != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(1, this->_internal_min(), target);
+  }
+
+  // float max = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max = this->_internal_max();
+  uint32_t raw_max;
+  memcpy(&raw_max, &tmp_max, sizeof(tmp_max));
+  if (raw_max != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteFloatToArray(2, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.HardTanhParams)
+  return target;
+}
+
+size_t HardTanhParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.HardTanhParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // float min = 1;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_min = this->_internal_min();
+  uint32_t raw_min;
+  memcpy(&raw_min, &tmp_min, sizeof(tmp_min));
+  if (raw_min != 0) {
+    total_size += 1 + 4;
+  }
+
+  // float max = 2;
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max = this->_internal_max();
+  uint32_t raw_max;
+  memcpy(&raw_max, &tmp_max, sizeof(tmp_max));
+  if (raw_max != 0) {
+    total_size += 1 + 4;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData HardTanhParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    HardTanhParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*HardTanhParams::GetClassData() const { return &_class_data_; }
+
+
+void HardTanhParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<HardTanhParams*>(&to_msg);
+  auto& from = static_cast<const HardTanhParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.HardTanhParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_min = from._internal_min();
+  uint32_t raw_min;
+  memcpy(&raw_min, &tmp_min, sizeof(tmp_min));
+  if (raw_min != 0) {
+    _this->_internal_set_min(from._internal_min());
+  }
+  static_assert(sizeof(uint32_t) == sizeof(float), "Code assumes uint32_t and float are the same size.");
+  float tmp_max = from._internal_max();
+  uint32_t raw_max;
+  memcpy(&raw_max, &tmp_max, sizeof(tmp_max));
+  if (raw_max != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void HardTanhParams::CopyFrom(const HardTanhParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.HardTanhParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool HardTanhParams::IsInitialized() const {
+  return true;
+}
+
+void HardTanhParams::InternalSwap(HardTanhParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(HardTanhParams, _impl_.max_)
+      + sizeof(HardTanhParams::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(HardTanhParams, _impl_.min_)>(
+          reinterpret_cast<char*>(&_impl_.min_),
+          reinterpret_cast<char*>(&other->_impl_.min_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata HardTanhParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[7]);
+}
+
+// ===================================================================
+
+class ActivationParams::_Internal {
+ public:
+  static const ::smaug::LreluParams& lrelu_params(const ActivationParams* msg);
+  static const ::smaug::EluParams& elu_params(const ActivationParams* msg);
+  static const ::smaug::HardTanhParams& hard_tanh_params(const ActivationParams* msg);
+};
+
+const ::smaug::LreluParams&
+ActivationParams::_Internal::lrelu_params(const ActivationParams* msg) {
+  return *msg->_impl_.value_.lrelu_params_;
+}
+const ::smaug::EluParams&
+ActivationParams::_Internal::elu_params(const ActivationParams* msg) {
+  return *msg->_impl_.value_.elu_params_;
+}
+const ::smaug::HardTanhParams&
+ActivationParams::_Internal::hard_tanh_params(const ActivationParams* msg) {
+  return *msg->_impl_.value_.hard_tanh_params_;
+}
+void ActivationParams::set_allocated_lrelu_params(::smaug::LreluParams* lrelu_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (lrelu_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(lrelu_params);
+    if (message_arena != submessage_arena) {
+      lrelu_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, lrelu_params, submessage_arena);
+    }
+    set_has_lrelu_params();
+    _impl_.value_.lrelu_params_ = lrelu_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:smaug.ActivationParams.lrelu_params)
+}
+void ActivationParams::set_allocated_elu_params(::smaug::EluParams* elu_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (elu_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(elu_params);
+    if (message_arena != submessage_arena) {
+      elu_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, elu_params, submessage_arena);
+    }
+    set_has_elu_params();
+    _impl_.value_.elu_params_ = elu_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:smaug.ActivationParams.elu_params)
+}
+void ActivationParams::set_allocated_hard_tanh_params(::smaug::HardTanhParams* hard_tanh_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (hard_tanh_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hard_tanh_params);
+    if (message_arena != submessage_arena) {
+      hard_tanh_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hard_tanh_params, submessage_arena);
+    }
+    set_has_hard_tanh_params();
+    _impl_.value_.hard_tanh_params_ = hard_tanh_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:smaug.ActivationParams.hard_tanh_params)
+}
+ActivationParams::ActivationParams(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.ActivationParams)
+}
+ActivationParams::ActivationParams(const ActivationParams& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ActivationParams* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.activation_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.activation_ = from._impl_.activation_;
+  clear_has_value();
+  switch (from.value_case()) {
+    case kLreluParams: {
+      _this->_internal_mutable_lrelu_params()->::smaug::LreluParams::MergeFrom(
+          from._internal_lrelu_params());
+      break;
+    }
+    case kEluParams: {
+      _this->_internal_mutable_elu_params()->::smaug::EluParams::MergeFrom(
+          from._internal_elu_params());
+      break;
+    }
+    case kHardTanhParams: {
+      _this->_internal_mutable_hard_tanh_params()->::smaug::HardTanhParams::MergeFrom(
+          from._internal_hard_tanh_params());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:smaug.ActivationParams)
+}
+
+inline void ActivationParams::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.activation_){0}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_value();
+}
+
+ActivationParams::~ActivationParams() {
+  // @@protoc_insertion_point(destructor:smaug.ActivationParams)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ActivationParams::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_value()) {
+    clear_value();
+  }
+}
+
+void ActivationParams::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ActivationParams::clear_value() {
+// @@protoc_insertion_point(one_of_clear_start:smaug.ActivationParams)
+  switch (value_case()) {
+    case kLreluParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.lrelu_params_;
+      }
+      break;
+    }
+    case kEluParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.elu_params_;
+      }
+      break;
+    }
+    case kHardTanhParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.hard_tanh_params_;
+      }
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+
+
+void ActivationParams::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.ActivationParams)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.activation_ = 0;
+  clear_value();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ActivationParams::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .smaug.OpType activation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_activation(static_cast<::smaug::OpType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.LreluParams lrelu_params = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_lrelu_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.EluParams elu_params = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_elu_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.HardTanhParams hard_tanh_params = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hard_tanh_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ActivationParams::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.ActivationParams)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .smaug.OpType activation = 1;
+  if (this->_internal_activation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_activation(), target);
+  }
+
+  // .smaug.LreluParams lrelu_params = 2;
+  if (_internal_has_lrelu_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::lrelu_params(this),
+        _Internal::lrelu_params(this).GetCachedSize(), target, stream);
+  }
+
+  // .smaug.EluParams elu_params = 3;
+  if (_internal_has_elu_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::elu_params(this),
+        _Internal::elu_params(this).GetCachedSize(), target, stream);
+  }
+
+  // .smaug.HardTanhParams hard_tanh_params = 4;
+  if (_internal_has_hard_tanh_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::hard_tanh_params(this),
+        _Internal::hard_tanh_params(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.ActivationParams)
+  return target;
+}
+
+size_t ActivationParams::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.ActivationParams)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .smaug.OpType activation = 1;
+  if (this->_internal_activation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_activation());
+  }
+
+  switch (value_case()) {
+    // .smaug.LreluParams lrelu_params = 2;
+    case kLreluParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.lrelu_params_);
+      break;
+    }
+    // .smaug.EluParams elu_params = 3;
+    case kEluParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.elu_params_);
+      break;
+    }
+    // .smaug.HardTanhParams hard_tanh_params = 4;
+    case kHardTanhParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.hard_tanh_params_);
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ActivationParams::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ActivationParams::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ActivationParams::GetClassData() const { return &_class_data_; }
+
+
+void ActivationParams::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ActivationParams*>(&to_msg);
+  auto& from = static_cast<const ActivationParams&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.ActivationParams)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_activation() != 0) {
+    _this->_internal_set_activation(from._internal_activation());
+  }
+  switch (from.value_case()) {
+    case kLreluParams: {
+      _this->_internal_mutable_lrelu_params()->::smaug::LreluParams::MergeFrom(
+          from._internal_lrelu_params());
+      break;
+    }
+    case kEluParams: {
+      _this->_internal_mutable_elu_params()->::smaug::EluParams::MergeFrom(
+          from._internal_elu_params());
+      break;
+    }
+    case kHardTanhParams: {
+      _this->_internal_mutable_hard_tanh_params()->::smaug::HardTanhParams::MergeFrom(
+          from._internal_hard_tanh_params());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ActivationParams::CopyFrom(const ActivationParams& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.ActivationParams)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ActivationParams::IsInitialized() const {
+  return true;
+}
+
+void ActivationParams::InternalSwap(ActivationParams* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.activation_, other->_impl_.activation_);
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ActivationParams::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[8]);
+}
+
+// ===================================================================
+
+class Params::_Internal {
+ public:
+  static const ::smaug::ConvParams& conv_params(const Params* msg);
+  static const ::smaug::PoolParams& pool_params(const Params* msg);
+  static const ::smaug::ConcatParams& concat_params(const Params* msg);
+  static const ::smaug::SplitParams& split_params(const Params* msg);
+  static const ::smaug::PaddingParams& padding_params(const Params* msg);
+  static const ::smaug::ActivationParams& act_params(const Params* msg);
+};
+
+const ::smaug::ConvParams&
+Params::_Internal::conv_params(const Params* msg) {
+  return *msg->_impl_.value_.conv_params_;
+}
+const ::smaug::PoolParams&
+Params::_Internal::pool_params(const Params* msg) {
+  return *msg->_impl_.value_.pool_params_;
+}
+const ::smaug::ConcatParams&
+Params::_Internal::concat_params(const Params* msg) {
+  return *msg->_impl_.value_.concat_params_;
+}
+const ::smaug::SplitParams&
+Params::_Internal::split_params(const Params* msg) {
+  return *msg->_impl_.value_.split_params_;
+}
+const ::smaug::PaddingParams&
+Params::_Internal::padding_params(const Params* msg) {
+  return *msg->_impl_.value_.padding_params_;
+}
+const ::smaug::ActivationParams&
+Params::_Internal::act_params(const Params* msg) {
+  return *msg->_impl_.act_params_;
+}
+void Params::set_allocated_conv_params(::smaug::ConvParams* conv_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (conv_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(conv_params);
+    if (message_arena != submessage_arena) {
+      conv_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, conv_params, submessage_arena);
+    }
+    set_has_conv_params();
+    _impl_.value_.conv_params_ = conv_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:smaug.Params.conv_params)
+}
+void Params::set_allocated_pool_params(::smaug::PoolParams* pool_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (pool_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pool_params);
+    if (message_arena != submessage_arena) {
+      pool_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pool_params, submessage_arena);
+    }
+    set_has_pool_params();
+    _impl_.value_.pool_params_ = pool_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:smaug.Params.pool_params)
+}
+void Params::set_allocated_concat_params(::smaug::ConcatParams* concat_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (concat_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(concat_params);
+    if (message_arena != submessage_arena) {
+      concat_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, concat_params, submessage_arena);
+    }
+    set_has_concat_params();
+    _impl_.value_.concat_params_ = concat_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:smaug.Params.concat_params)
+}
+void Params::set_allocated_split_params(::smaug::SplitParams* split_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (split_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(split_params);
+    if (message_arena != submessage_arena) {
+      split_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, split_params, submessage_arena);
+    }
+    set_has_split_params();
+    _impl_.value_.split_params_ = split_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:smaug.Params.split_params)
+}
+void Params::set_allocated_padding_params(::smaug::PaddingParams* padding_params) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_value();
+  if (padding_params) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(padding_params);
+    if (message_arena != submessage_arena) {
+      padding_params = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, padding_params, submessage_arena);
+    }
+    set_has_padding_params();
+    _impl_.value_.padding_params_ = padding_params;
+  }
+  // @@protoc_insertion_point(field_set_allocated:smaug.Params.padding_params)
+}
+Params::Params(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.Params)
+}
+Params::Params(const Params& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Params* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.act_params_){nullptr}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_act_params()) {
+    _this->_impl_.act_params_ = new ::smaug::ActivationParams(*from._impl_.act_params_);
+  }
+  clear_has_value();
+  switch (from.value_case()) {
+    case kConvParams: {
+      _this->_internal_mutable_conv_params()->::smaug::ConvParams::MergeFrom(
+          from._internal_conv_params());
+      break;
+    }
+    case kPoolParams: {
+      _this->_internal_mutable_pool_params()->::smaug::PoolParams::MergeFrom(
+          from._internal_pool_params());
+      break;
+    }
+    case kConcatParams: {
+      _this->_internal_mutable_concat_params()->::smaug::ConcatParams::MergeFrom(
+          from._internal_concat_params());
+      break;
+    }
+    case kSplitParams: {
+      _this->_internal_mutable_split_params()->::smaug::SplitParams::MergeFrom(
+          from._internal_split_params());
+      break;
+    }
+    case kPaddingParams: {
+      _this->_internal_mutable_padding_params()->::smaug::PaddingParams::MergeFrom(
+          from._internal_padding_params());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:smaug.Params)
+}
+
+inline void Params::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.act_params_){nullptr}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_value();
+}
+
+Params::~Params() {
+  // @@protoc_insertion_point(destructor:smaug.Params)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Params::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.act_params_;
+  if (has_value()) {
+    clear_value();
+  }
+}
+
+void Params::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Params::clear_value() {
+// @@protoc_insertion_point(one_of_clear_start:smaug.Params)
+  switch (value_case()) {
+    case kConvParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.conv_params_;
+      }
+      break;
+    }
+    case kPoolParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.pool_params_;
+      }
+      break;
+    }
+    case kConcatParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.concat_params_;
+      }
+      break;
+    }
+    case kSplitParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.split_params_;
+      }
+      break;
+    }
+    case kPaddingParams: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.value_.padding_params_;
+      }
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = VALUE_NOT_SET;
+}
+
+
+void Params::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.Params)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.act_params_ != nullptr) {
+    delete _impl_.act_params_;
+  }
+  _impl_.act_params_ = nullptr;
+  clear_value();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Params::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .smaug.ConvParams conv_params = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_conv_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.PoolParams pool_params = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pool_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.ActivationParams act_params = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_act_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.ConcatParams concat_params = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_concat_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.SplitParams split_params = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_split_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.PaddingParams padding_params = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_padding_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Params::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.Params)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .smaug.ConvParams conv_params = 1;
+  if (_internal_has_conv_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::conv_params(this),
+        _Internal::conv_params(this).GetCachedSize(), target, stream);
+  }
+
+  // .smaug.PoolParams pool_params = 2;
+  if (_internal_has_pool_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::pool_params(this),
+        _Internal::pool_params(this).GetCachedSize(), target, stream);
+  }
+
+  // .smaug.ActivationParams act_params = 3;
+  if (this->_internal_has_act_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::act_params(this),
+        _Internal::act_params(this).GetCachedSize(), target, stream);
+  }
+
+  // .smaug.ConcatParams concat_params = 4;
+  if (_internal_has_concat_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::concat_params(this),
+        _Internal::concat_params(this).GetCachedSize(), target, stream);
+  }
+
+  // .smaug.SplitParams split_params = 5;
+  if (_internal_has_split_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::split_params(this),
+        _Internal::split_params(this).GetCachedSize(), target, stream);
+  }
+
+  // .smaug.PaddingParams padding_params = 6;
+  if (_internal_has_padding_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::padding_params(this),
+        _Internal::padding_params(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.Params)
+  return target;
+}
+
+size_t Params::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.Params)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .smaug.ActivationParams act_params = 3;
+  if (this->_internal_has_act_params()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.act_params_);
+  }
+
+  switch (value_case()) {
+    // .smaug.ConvParams conv_params = 1;
+    case kConvParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.conv_params_);
+      break;
+    }
+    // .smaug.PoolParams pool_params = 2;
+    case kPoolParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.pool_params_);
+      break;
+    }
+    // .smaug.ConcatParams concat_params = 4;
+    case kConcatParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.concat_params_);
+      break;
+    }
+    // .smaug.SplitParams split_params = 5;
+    case kSplitParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.split_params_);
+      break;
+    }
+    // .smaug.PaddingParams padding_params = 6;
+    case kPaddingParams: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.value_.padding_params_);
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Params::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Params::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Params::GetClassData() const { return &_class_data_; }
+
+
+void Params::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Params*>(&to_msg);
+  auto& from = static_cast<const Params&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.Params)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_act_params()) {
+    _this->_internal_mutable_act_params()->::smaug::ActivationParams::MergeFrom(
+        from._internal_act_params());
+  }
+  switch (from.value_case()) {
+    case kConvParams: {
+      _this->_internal_mutable_conv_params()->::smaug::ConvParams::MergeFrom(
+          from._internal_conv_params());
+      break;
+    }
+    case kPoolParams: {
+      _this->_internal_mutable_pool_params()->::smaug::PoolParams::MergeFrom(
+          from._internal_pool_params());
+      break;
+    }
+    case kConcatParams: {
+      _this->_internal_mutable_concat_params()->::smaug::ConcatParams::MergeFrom(
+          from._internal_concat_params());
+      break;
+    }
+    case kSplitParams: {
+      _this->_internal_mutable_split_params()->::smaug::SplitParams::MergeFrom(
+          from._internal_split_params());
+      break;
+    }
+    case kPaddingParams: {
+      _this->_internal_mutable_padding_params()->::smaug::PaddingParams::MergeFrom(
+          from._internal_padding_params());
+      break;
+    }
+    case VALUE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Params::CopyFrom(const Params& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.Params)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Params::IsInitialized() const {
+  return true;
+}
+
+void Params::InternalSwap(Params* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.act_params_, other->_impl_.act_params_);
+  swap(_impl_.value_, other->_impl_.value_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Params::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[9]);
+}
+
+// ===================================================================
+
+class NodeProto::_Internal {
+ public:
+  static const ::smaug::Params& params(const NodeProto* msg);
+};
+
+const ::smaug::Params&
+NodeProto::_Internal::params(const NodeProto* msg) {
+  return *msg->_impl_.params_;
+}
+void NodeProto::clear_input_tensors() {
+  _impl_.input_tensors_.Clear();
+}
+void NodeProto::clear_output_tensors() {
+  _impl_.output_tensors_.Clear();
+}
+NodeProto::NodeProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.NodeProto)
+}
+NodeProto::NodeProto(const NodeProto& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NodeProto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parents_){from._impl_.parents_}
+    , decltype(_impl_.src_tensors_indices_){from._impl_.src_tensors_indices_}
+    , /*decltype(_impl_._src_tensors_indices_cached_byte_size_)*/{0}
+    , decltype(_impl_.input_tensors_){from._impl_.input_tensors_}
+    , decltype(_impl_.output_tensors_){from._impl_.output_tensors_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.params_){nullptr}
+    , decltype(_impl_.op_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_params()) {
+    _this->_impl_.params_ = new ::smaug::Params(*from._impl_.params_);
+  }
+  _this->_impl_.op_ = from._impl_.op_;
+  // @@protoc_insertion_point(copy_constructor:smaug.NodeProto)
+}
+
+inline void NodeProto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.parents_){arena}
+    , decltype(_impl_.src_tensors_indices_){arena}
+    , /*decltype(_impl_._src_tensors_indices_cached_byte_size_)*/{0}
+    , decltype(_impl_.input_tensors_){arena}
+    , decltype(_impl_.output_tensors_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.params_){nullptr}
+    , decltype(_impl_.op_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NodeProto::~NodeProto() {
+  // @@protoc_insertion_point(destructor:smaug.NodeProto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NodeProto::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.parents_.~RepeatedPtrField();
+  _impl_.src_tensors_indices_.~RepeatedField();
+  _impl_.input_tensors_.~RepeatedPtrField();
+  _impl_.output_tensors_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.params_;
+}
+
+void NodeProto::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NodeProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.NodeProto)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.parents_.Clear();
+  _impl_.src_tensors_indices_.Clear();
+  _impl_.input_tensors_.Clear();
+  _impl_.output_tensors_.Clear();
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.params_ != nullptr) {
+    delete _impl_.params_;
+  }
+  _impl_.params_ = nullptr;
+  _impl_.op_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NodeProto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "smaug.NodeProto.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.OpType op = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_op(static_cast<::smaug::OpType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string parents = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_parents();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "smaug.NodeProto.parents"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 src_tensors_indices = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_src_tensors_indices(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_src_tensors_indices(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .smaug.TensorProto input_tensors = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_input_tensors(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .smaug.TensorProto output_tensors = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_output_tensors(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.Params params = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_params(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NodeProto::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.NodeProto)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "smaug.NodeProto.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .smaug.OpType op = 2;
+  if (this->_internal_op() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_op(), target);
+  }
+
+  // repeated string parents = 3;
+  for (int i = 0, n = this->_internal_parents_size(); i < n; i++) {
+    const auto& s = this->_internal_parents(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "smaug.NodeProto.parents");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // repeated int32 src_tensors_indices = 5;
+  {
+    int byte_size = _impl_._src_tensors_indices_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          5, _internal_src_tensors_indices(), byte_size, target);
+    }
+  }
+
+  // repeated .smaug.TensorProto input_tensors = 6;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_input_tensors_size()); i < n; i++) {
+    const auto& repfield = this->_internal_input_tensors(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .smaug.TensorProto output_tensors = 7;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_output_tensors_size()); i < n; i++) {
+    const auto& repfield = this->_internal_output_tensors(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(7, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .smaug.Params params = 8;
+  if (this->_internal_has_params()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::params(this),
+        _Internal::params(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.NodeProto)
+  return target;
+}
+
+size_t NodeProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.NodeProto)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string parents = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.parents_.size());
+  for (int i = 0, n = _impl_.parents_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.parents_.Get(i));
+  }
+
+  // repeated int32 src_tensors_indices = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.src_tensors_indices_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._src_tensors_indices_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .smaug.TensorProto input_tensors = 6;
+  total_size += 1UL * this->_internal_input_tensors_size();
+  for (const auto& msg : this->_impl_.input_tensors_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .smaug.TensorProto output_tensors = 7;
+  total_size += 1UL * this->_internal_output_tensors_size();
+  for (const auto& msg : this->_impl_.output_tensors_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .smaug.Params params = 8;
+  if (this->_internal_has_params()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.params_);
+  }
+
+  // .smaug.OpType op = 2;
+  if (this->_internal_op() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_op());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NodeProto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NodeProto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NodeProto::GetClassData() const { return &_class_data_; }
+
+
+void NodeProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NodeProto*>(&to_msg);
+  auto& from = static_cast<const NodeProto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.NodeProto)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.parents_.MergeFrom(from._impl_.parents_);
+  _this->_impl_.src_tensors_indices_.MergeFrom(from._impl_.src_tensors_indices_);
+  _this->_impl_.input_tensors_.MergeFrom(from._impl_.input_tensors_);
+  _this->_impl_.output_tensors_.MergeFrom(from._impl_.output_tensors_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_params()) {
+    _this->_internal_mutable_params()->::smaug::Params::MergeFrom(
+        from._internal_params());
+  }
+  if (from._internal_op() != 0) {
+    _this->_internal_set_op(from._internal_op());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NodeProto::CopyFrom(const NodeProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.NodeProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NodeProto::IsInitialized() const {
+  return true;
+}
+
+void NodeProto::InternalSwap(NodeProto* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.parents_.InternalSwap(&other->_impl_.parents_);
+  _impl_.src_tensors_indices_.InternalSwap(&other->_impl_.src_tensors_indices_);
+  _impl_.input_tensors_.InternalSwap(&other->_impl_.input_tensors_);
+  _impl_.output_tensors_.InternalSwap(&other->_impl_.output_tensors_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NodeProto, _impl_.op_)
+      + sizeof(NodeProto::_impl_.op_)
+      - PROTOBUF_FIELD_OFFSET(NodeProto, _impl_.params_)>(
+          reinterpret_cast<char*>(&_impl_.params_),
+          reinterpret_cast<char*>(&other->_impl_.params_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NodeProto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2fnode_2eproto_getter, &descriptor_table_smaug_2fcore_2fnode_2eproto_once,
+      file_level_metadata_smaug_2fcore_2fnode_2eproto[10]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace smaug
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::smaug::ConvParams*
+Arena::CreateMaybeMessage< ::smaug::ConvParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::ConvParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::PoolParams*
+Arena::CreateMaybeMessage< ::smaug::PoolParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::PoolParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::PaddingParams*
+Arena::CreateMaybeMessage< ::smaug::PaddingParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::PaddingParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::ConcatParams*
+Arena::CreateMaybeMessage< ::smaug::ConcatParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::ConcatParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::SplitParams*
+Arena::CreateMaybeMessage< ::smaug::SplitParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::SplitParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::LreluParams*
+Arena::CreateMaybeMessage< ::smaug::LreluParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::LreluParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::EluParams*
+Arena::CreateMaybeMessage< ::smaug::EluParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::EluParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::HardTanhParams*
+Arena::CreateMaybeMessage< ::smaug::HardTanhParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::HardTanhParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::ActivationParams*
+Arena::CreateMaybeMessage< ::smaug::ActivationParams >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::ActivationParams >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::Params*
+Arena::CreateMaybeMessage< ::smaug::Params >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::Params >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::NodeProto*
+Arena::CreateMaybeMessage< ::smaug::NodeProto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::NodeProto >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,47 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: smaug/core/node.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+from smaug.core import tensor_pb2 as smaug_dot_core_dot_tensor__pb2
+from smaug.core import types_pb2 as smaug_dot_core_dot_types__pb2
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x15smaug/core/node.proto\x12\x05smaug\x1a\x17smaug/core/tensor.proto\x1a\x16smaug/core/types.proto\"A\n\nConvParams\x12#\n\x07padding\x18\x01 \x01(\x0e\x32\x12.smaug.PaddingType\x12\x0e\n\x06stride\x18\x02 \x03(\x05\"/\n\nPoolParams\x12\x0e\n\x06stride\x18\x01 \x03(\x05\x12\x11\n\tpool_size\x18\x02 \x03(\x05\"%\n\rPaddingParams\x12\x14\n\x0cpadding_size\x18\x01 \x03(\x05\"#\n\x0c\x43oncatParams\x12\x13\n\x0b\x63oncat_axis\x18\x01 \x01(\x05\"!\n\x0bSplitParams\x12\x12\n\nsplit_axis\x18\x01 \x01(\x05\"\x1c\n\x0bLreluParams\x12\r\n\x05slope\x18\x01 \x01(\x02\"0\n\tEluParams\x12\r\n\x05\x61lpha\x18\x01 \x01(\x02\x12\x14\n\x0clambda_param\x18\x02 \x01(\x02\"*\n\x0eHardTanhParams\x12\x0b\n\x03min\x18\x01 \x01(\x02\x12\x0b\n\x03max\x18\x02 \x01(\x02\"\xc5\x01\n\x10\x41\x63tivationParams\x12!\n\nactivation\x18\x01 \x01(\x0e\x32\r.smaug.OpType\x12*\n\x0clrelu_params\x18\x02 \x01(\x0b\x32\x12.smaug.LreluParamsH\x00\x12&\n\nelu_params\x18\x03 \x01(\x0b\x32\x10.smaug.EluParamsH\x00\x12\x31\n\x10hard_tanh_params\x18\x04 \x01(\x0b\x32\x15.smaug.HardTanhParamsH\x00\x42\x07\n\x05value\"\x9c\x02\n\x06Params\x12(\n\x0b\x63onv_params\x18\x01 \x01(\x0b\x32\x11.smaug.ConvParamsH\x00\x12(\n\x0bpool_params\x18\x02 \x01(\x0b\x32\x11.smaug.PoolParamsH\x00\x12,\n\rconcat_params\x18\x04 \x01(\x0b\x32\x13.smaug.ConcatParamsH\x00\x12*\n\x0csplit_params\x18\x05 \x01(\x0b\x32\x12.smaug.SplitParamsH\x00\x12.\n\x0epadding_params\x18\x06 \x01(\x0b\x32\x14.smaug.PaddingParamsH\x00\x12+\n\nact_params\x18\x03 \x01(\x0b\x32\x17.smaug.ActivationParamsB\x07\n\x05value\"\xd8\x01\n\tNodeProto\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x19\n\x02op\x18\x02 \x01(\x0e\x32\r.smaug.OpType\x12\x0f\n\x07parents\x18\x03 \x03(\t\x12\x1b\n\x13src_tensors_indices\x18\x05 \x03(\x05\x12)\n\rinput_tensors\x18\x06 \x03(\x0b\x32\x12.smaug.TensorProto\x12*\n\x0eoutput_tensors\x18\x07 \x03(\x0b\x32\x12.smaug.TensorProto\x12\x1d\n\x06params\x18\x08 \x01(\x0b\x32\r.smaug.Paramsb\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'smaug.core.node_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _CONVPARAMS._serialized_start=81
+  _CONVPARAMS._serialized_end=146
+  _POOLPARAMS._serialized_start=148
+  _POOLPARAMS._serialized_end=195
+  _PADDINGPARAMS._serialized_start=197
+  _PADDINGPARAMS._serialized_end=234
+  _CONCATPARAMS._serialized_start=236
+  _CONCATPARAMS._serialized_end=271
+  _SPLITPARAMS._serialized_start=273
+  _SPLITPARAMS._serialized_end=306
+  _LRELUPARAMS._serialized_start=308
+  _LRELUPARAMS._serialized_end=336
+  _ELUPARAMS._serialized_start=338
+  _ELUPARAMS._serialized_end=386
+  _HARDTANHPARAMS._serialized_start=388
+  _HARDTANHPARAMS._serialized_end=430
+  _ACTIVATIONPARAMS._serialized_start=433
+  _ACTIVATIONPARAMS._serialized_end=630
+  _PARAMS._serialized_start=633
+  _PARAMS._serialized_end=917
+  _NODEPROTO._serialized_start=920
+  _NODEPROTO._serialized_end=1136
+# @@protoc_insertion_point(module_scope)
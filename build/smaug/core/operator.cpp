@@ -0,0 +1 @@
+/root/repo/smaug/core/operator.cpp
\ No newline at end of file
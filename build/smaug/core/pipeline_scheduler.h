@@ -0,0 +1 @@
+/root/repo/smaug/core/pipeline_scheduler.h
\ No newline at end of file
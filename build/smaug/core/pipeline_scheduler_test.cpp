@@ -0,0 +1 @@
+/root/repo/smaug/core/pipeline_scheduler_test.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/core/roofline.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/core/roofline.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/core/roofline_test.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/core/scheduler.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/core/scheduling_policy.cpp
\ No newline at end of file
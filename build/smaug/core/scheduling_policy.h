@@ -0,0 +1 @@
+/root/repo/smaug/core/scheduling_policy.h
\ No newline at end of file
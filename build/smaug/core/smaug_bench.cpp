@@ -0,0 +1 @@
+/root/repo/smaug/core/smaug_bench.cpp
\ No newline at end of file
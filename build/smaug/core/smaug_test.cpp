@@ -0,0 +1 @@
+/root/repo/smaug/core/smaug_test.cpp
\ No newline at end of file
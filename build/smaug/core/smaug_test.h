@@ -0,0 +1 @@
+/root/repo/smaug/core/smaug_test.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/core/tensor.h
\ No newline at end of file
@@ -0,0 +1,1432 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: smaug/core/tensor.proto
+
+#include "smaug/core/tensor.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace smaug {
+PROTOBUF_CONSTEXPR TensorShapeProto::TensorShapeProto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.dims_)*/{}
+  , /*decltype(_impl_._dims_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.layout_)*/0
+  , /*decltype(_impl_.alignment_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TensorShapeProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TensorShapeProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TensorShapeProtoDefaultTypeInternal() {}
+  union {
+    TensorShapeProto _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TensorShapeProtoDefaultTypeInternal _TensorShapeProto_default_instance_;
+PROTOBUF_CONSTEXPR TensorProto::TensorProto(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.shape_)*/nullptr
+  , /*decltype(_impl_.data_)*/nullptr
+  , /*decltype(_impl_.data_type_)*/0
+  , /*decltype(_impl_.data_format_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TensorProtoDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TensorProtoDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TensorProtoDefaultTypeInternal() {}
+  union {
+    TensorProto _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TensorProtoDefaultTypeInternal _TensorProto_default_instance_;
+PROTOBUF_CONSTEXPR TensorData::TensorData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.half_data_)*/{}
+  , /*decltype(_impl_._half_data_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.float_data_)*/{}
+  , /*decltype(_impl_.double_data_)*/{}
+  , /*decltype(_impl_.int_data_)*/{}
+  , /*decltype(_impl_._int_data_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.int64_data_)*/{}
+  , /*decltype(_impl_._int64_data_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bool_data_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TensorDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TensorDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TensorDataDefaultTypeInternal() {}
+  union {
+    TensorData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TensorDataDefaultTypeInternal _TensorData_default_instance_;
+PROTOBUF_CONSTEXPR TensorDataArray::TensorDataArray(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.data_array_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TensorDataArrayDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TensorDataArrayDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TensorDataArrayDefaultTypeInternal() {}
+  union {
+    TensorDataArray _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TensorDataArrayDefaultTypeInternal _TensorDataArray_default_instance_;
+}  // namespace smaug
+static ::_pb::Metadata file_level_metadata_smaug_2fcore_2ftensor_2eproto[4];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_smaug_2fcore_2ftensor_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_smaug_2fcore_2ftensor_2eproto = nullptr;
+
+const uint32_t TableStruct_smaug_2fcore_2ftensor_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorShapeProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorShapeProto, _impl_.dims_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorShapeProto, _impl_.layout_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorShapeProto, _impl_.alignment_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorProto, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorProto, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorProto, _impl_.data_type_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorProto, _impl_.shape_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorProto, _impl_.data_format_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorProto, _impl_.data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorData, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorData, _impl_.half_data_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorData, _impl_.float_data_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorData, _impl_.double_data_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorData, _impl_.int_data_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorData, _impl_.int64_data_),
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorData, _impl_.bool_data_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorDataArray, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::smaug::TensorDataArray, _impl_.data_array_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::smaug::TensorShapeProto)},
+  { 9, -1, -1, sizeof(::smaug::TensorProto)},
+  { 20, -1, -1, sizeof(::smaug::TensorData)},
+  { 33, -1, -1, sizeof(::smaug::TensorDataArray)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::smaug::_TensorShapeProto_default_instance_._instance,
+  &::smaug::_TensorProto_default_instance_._instance,
+  &::smaug::_TensorData_default_instance_._instance,
+  &::smaug::_TensorDataArray_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_smaug_2fcore_2ftensor_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\027smaug/core/tensor.proto\022\005smaug\032\026smaug/"
+  "core/types.proto\"V\n\020TensorShapeProto\022\014\n\004"
+  "dims\030\001 \003(\005\022!\n\006layout\030\002 \001(\0162\021.smaug.DataL"
+  "ayout\022\021\n\talignment\030\003 \001(\005\"\267\001\n\013TensorProto"
+  "\022\014\n\004name\030\001 \001(\t\022\"\n\tdata_type\030\002 \001(\0162\017.smau"
+  "g.DataType\022&\n\005shape\030\003 \001(\0132\027.smaug.Tensor"
+  "ShapeProto\022-\n\013data_format\030\004 \001(\0162\030.smaug."
+  "DataStorageFormat\022\037\n\004data\030\005 \001(\0132\021.smaug."
+  "TensorData\"\247\001\n\nTensorData\022\014\n\004name\030\001 \001(\t\022"
+  "\025\n\thalf_data\030\002 \003(\005B\002\020\001\022\026\n\nfloat_data\030\003 \003"
+  "(\002B\002\020\001\022\027\n\013double_data\030\004 \003(\001B\002\020\001\022\024\n\010int_d"
+  "ata\030\005 \003(\005B\002\020\001\022\026\n\nint64_data\030\006 \003(\003B\002\020\001\022\025\n"
+  "\tbool_data\030\007 \003(\010B\002\020\001\"8\n\017TensorDataArray\022"
+  "%\n\ndata_array\030\001 \003(\0132\021.smaug.TensorDatab\006"
+  "proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_smaug_2fcore_2ftensor_2eproto_deps[1] = {
+  &::descriptor_table_smaug_2fcore_2ftypes_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_smaug_2fcore_2ftensor_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_smaug_2fcore_2ftensor_2eproto = {
+    false, false, 566, descriptor_table_protodef_smaug_2fcore_2ftensor_2eproto,
+    "smaug/core/tensor.proto",
+    &descriptor_table_smaug_2fcore_2ftensor_2eproto_once, descriptor_table_smaug_2fcore_2ftensor_2eproto_deps, 1, 4,
+    schemas, file_default_instances, TableStruct_smaug_2fcore_2ftensor_2eproto::offsets,
+    file_level_metadata_smaug_2fcore_2ftensor_2eproto, file_level_enum_descriptors_smaug_2fcore_2ftensor_2eproto,
+    file_level_service_descriptors_smaug_2fcore_2ftensor_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_smaug_2fcore_2ftensor_2eproto_getter() {
+  return &descriptor_table_smaug_2fcore_2ftensor_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_smaug_2fcore_2ftensor_2eproto(&descriptor_table_smaug_2fcore_2ftensor_2eproto);
+namespace smaug {
+
+// ===================================================================
+
+class TensorShapeProto::_Internal {
+ public:
+};
+
+TensorShapeProto::TensorShapeProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.TensorShapeProto)
+}
+TensorShapeProto::TensorShapeProto(const TensorShapeProto& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TensorShapeProto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dims_){from._impl_.dims_}
+    , /*decltype(_impl_._dims_cached_byte_size_)*/{0}
+    , decltype(_impl_.layout_){}
+    , decltype(_impl_.alignment_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.layout_, &from._impl_.layout_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.alignment_) -
+    reinterpret_cast<char*>(&_impl_.layout_)) + sizeof(_impl_.alignment_));
+  // @@protoc_insertion_point(copy_constructor:smaug.TensorShapeProto)
+}
+
+inline void TensorShapeProto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.dims_){arena}
+    , /*decltype(_impl_._dims_cached_byte_size_)*/{0}
+    , decltype(_impl_.layout_){0}
+    , decltype(_impl_.alignment_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TensorShapeProto::~TensorShapeProto() {
+  // @@protoc_insertion_point(destructor:smaug.TensorShapeProto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TensorShapeProto::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.dims_.~RepeatedField();
+}
+
+void TensorShapeProto::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TensorShapeProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.TensorShapeProto)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.dims_.Clear();
+  ::memset(&_impl_.layout_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.alignment_) -
+      reinterpret_cast<char*>(&_impl_.layout_)) + sizeof(_impl_.alignment_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TensorShapeProto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated int32 dims = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_dims(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_dims(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.DataLayout layout = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_layout(static_cast<::smaug::DataLayout>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 alignment = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.alignment_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TensorShapeProto::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.TensorShapeProto)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated int32 dims = 1;
+  {
+    int byte_size = _impl_._dims_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          1, _internal_dims(), byte_size, target);
+    }
+  }
+
+  // .smaug.DataLayout layout = 2;
+  if (this->_internal_layout() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_layout(), target);
+  }
+
+  // int32 alignment = 3;
+  if (this->_internal_alignment() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_alignment(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.TensorShapeProto)
+  return target;
+}
+
+size_t TensorShapeProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.TensorShapeProto)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 dims = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.dims_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._dims_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // .smaug.DataLayout layout = 2;
+  if (this->_internal_layout() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_layout());
+  }
+
+  // int32 alignment = 3;
+  if (this->_internal_alignment() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_alignment());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TensorShapeProto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TensorShapeProto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TensorShapeProto::GetClassData() const { return &_class_data_; }
+
+
+void TensorShapeProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TensorShapeProto*>(&to_msg);
+  auto& from = static_cast<const TensorShapeProto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.TensorShapeProto)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.dims_.MergeFrom(from._impl_.dims_);
+  if (from._internal_layout() != 0) {
+    _this->_internal_set_layout(from._internal_layout());
+  }
+  if (from._internal_alignment() != 0) {
+    _this->_internal_set_alignment(from._internal_alignment());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TensorShapeProto::CopyFrom(const TensorShapeProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.TensorShapeProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TensorShapeProto::IsInitialized() const {
+  return true;
+}
+
+void TensorShapeProto::InternalSwap(TensorShapeProto* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.dims_.InternalSwap(&other->_impl_.dims_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TensorShapeProto, _impl_.alignment_)
+      + sizeof(TensorShapeProto::_impl_.alignment_)
+      - PROTOBUF_FIELD_OFFSET(TensorShapeProto, _impl_.layout_)>(
+          reinterpret_cast<char*>(&_impl_.layout_),
+          reinterpret_cast<char*>(&other->_impl_.layout_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TensorShapeProto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2ftensor_2eproto_getter, &descriptor_table_smaug_2fcore_2ftensor_2eproto_once,
+      file_level_metadata_smaug_2fcore_2ftensor_2eproto[0]);
+}
+
+// ===================================================================
+
+class TensorProto::_Internal {
+ public:
+  static const ::smaug::TensorShapeProto& shape(const TensorProto* msg);
+  static const ::smaug::TensorData& data(const TensorProto* msg);
+};
+
+const ::smaug::TensorShapeProto&
+TensorProto::_Internal::shape(const TensorProto* msg) {
+  return *msg->_impl_.shape_;
+}
+const ::smaug::TensorData&
+TensorProto::_Internal::data(const TensorProto* msg) {
+  return *msg->_impl_.data_;
+}
+TensorProto::TensorProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.TensorProto)
+}
+TensorProto::TensorProto(const TensorProto& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TensorProto* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.data_){nullptr}
+    , decltype(_impl_.data_type_){}
+    , decltype(_impl_.data_format_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_shape()) {
+    _this->_impl_.shape_ = new ::smaug::TensorShapeProto(*from._impl_.shape_);
+  }
+  if (from._internal_has_data()) {
+    _this->_impl_.data_ = new ::smaug::TensorData(*from._impl_.data_);
+  }
+  ::memcpy(&_impl_.data_type_, &from._impl_.data_type_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.data_format_) -
+    reinterpret_cast<char*>(&_impl_.data_type_)) + sizeof(_impl_.data_format_));
+  // @@protoc_insertion_point(copy_constructor:smaug.TensorProto)
+}
+
+inline void TensorProto::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.shape_){nullptr}
+    , decltype(_impl_.data_){nullptr}
+    , decltype(_impl_.data_type_){0}
+    , decltype(_impl_.data_format_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TensorProto::~TensorProto() {
+  // @@protoc_insertion_point(destructor:smaug.TensorProto)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TensorProto::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.shape_;
+  if (this != internal_default_instance()) delete _impl_.data_;
+}
+
+void TensorProto::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TensorProto::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.TensorProto)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.shape_ != nullptr) {
+    delete _impl_.shape_;
+  }
+  _impl_.shape_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.data_ != nullptr) {
+    delete _impl_.data_;
+  }
+  _impl_.data_ = nullptr;
+  ::memset(&_impl_.data_type_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.data_format_) -
+      reinterpret_cast<char*>(&_impl_.data_type_)) + sizeof(_impl_.data_format_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TensorProto::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "smaug.TensorProto.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.DataType data_type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_data_type(static_cast<::smaug::DataType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.TensorShapeProto shape = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_shape(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.DataStorageFormat data_format = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_data_format(static_cast<::smaug::DataStorageFormat>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .smaug.TensorData data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TensorProto::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.TensorProto)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "smaug.TensorProto.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .smaug.DataType data_type = 2;
+  if (this->_internal_data_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_data_type(), target);
+  }
+
+  // .smaug.TensorShapeProto shape = 3;
+  if (this->_internal_has_shape()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::shape(this),
+        _Internal::shape(this).GetCachedSize(), target, stream);
+  }
+
+  // .smaug.DataStorageFormat data_format = 4;
+  if (this->_internal_data_format() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      4, this->_internal_data_format(), target);
+  }
+
+  // .smaug.TensorData data = 5;
+  if (this->_internal_has_data()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::data(this),
+        _Internal::data(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.TensorProto)
+  return target;
+}
+
+size_t TensorProto::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.TensorProto)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .smaug.TensorShapeProto shape = 3;
+  if (this->_internal_has_shape()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.shape_);
+  }
+
+  // .smaug.TensorData data = 5;
+  if (this->_internal_has_data()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.data_);
+  }
+
+  // .smaug.DataType data_type = 2;
+  if (this->_internal_data_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_data_type());
+  }
+
+  // .smaug.DataStorageFormat data_format = 4;
+  if (this->_internal_data_format() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_data_format());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TensorProto::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TensorProto::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TensorProto::GetClassData() const { return &_class_data_; }
+
+
+void TensorProto::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TensorProto*>(&to_msg);
+  auto& from = static_cast<const TensorProto&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.TensorProto)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_shape()) {
+    _this->_internal_mutable_shape()->::smaug::TensorShapeProto::MergeFrom(
+        from._internal_shape());
+  }
+  if (from._internal_has_data()) {
+    _this->_internal_mutable_data()->::smaug::TensorData::MergeFrom(
+        from._internal_data());
+  }
+  if (from._internal_data_type() != 0) {
+    _this->_internal_set_data_type(from._internal_data_type());
+  }
+  if (from._internal_data_format() != 0) {
+    _this->_internal_set_data_format(from._internal_data_format());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TensorProto::CopyFrom(const TensorProto& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.TensorProto)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TensorProto::IsInitialized() const {
+  return true;
+}
+
+void TensorProto::InternalSwap(TensorProto* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(TensorProto, _impl_.data_format_)
+      + sizeof(TensorProto::_impl_.data_format_)
+      - PROTOBUF_FIELD_OFFSET(TensorProto, _impl_.shape_)>(
+          reinterpret_cast<char*>(&_impl_.shape_),
+          reinterpret_cast<char*>(&other->_impl_.shape_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TensorProto::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2ftensor_2eproto_getter, &descriptor_table_smaug_2fcore_2ftensor_2eproto_once,
+      file_level_metadata_smaug_2fcore_2ftensor_2eproto[1]);
+}
+
+// ===================================================================
+
+class TensorData::_Internal {
+ public:
+};
+
+TensorData::TensorData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.TensorData)
+}
+TensorData::TensorData(const TensorData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TensorData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.half_data_){from._impl_.half_data_}
+    , /*decltype(_impl_._half_data_cached_byte_size_)*/{0}
+    , decltype(_impl_.float_data_){from._impl_.float_data_}
+    , decltype(_impl_.double_data_){from._impl_.double_data_}
+    , decltype(_impl_.int_data_){from._impl_.int_data_}
+    , /*decltype(_impl_._int_data_cached_byte_size_)*/{0}
+    , decltype(_impl_.int64_data_){from._impl_.int64_data_}
+    , /*decltype(_impl_._int64_data_cached_byte_size_)*/{0}
+    , decltype(_impl_.bool_data_){from._impl_.bool_data_}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:smaug.TensorData)
+}
+
+inline void TensorData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.half_data_){arena}
+    , /*decltype(_impl_._half_data_cached_byte_size_)*/{0}
+    , decltype(_impl_.float_data_){arena}
+    , decltype(_impl_.double_data_){arena}
+    , decltype(_impl_.int_data_){arena}
+    , /*decltype(_impl_._int_data_cached_byte_size_)*/{0}
+    , decltype(_impl_.int64_data_){arena}
+    , /*decltype(_impl_._int64_data_cached_byte_size_)*/{0}
+    , decltype(_impl_.bool_data_){arena}
+    , decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TensorData::~TensorData() {
+  // @@protoc_insertion_point(destructor:smaug.TensorData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TensorData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.half_data_.~RepeatedField();
+  _impl_.float_data_.~RepeatedField();
+  _impl_.double_data_.~RepeatedField();
+  _impl_.int_data_.~RepeatedField();
+  _impl_.int64_data_.~RepeatedField();
+  _impl_.bool_data_.~RepeatedField();
+  _impl_.name_.Destroy();
+}
+
+void TensorData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TensorData::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.TensorData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.half_data_.Clear();
+  _impl_.float_data_.Clear();
+  _impl_.double_data_.Clear();
+  _impl_.int_data_.Clear();
+  _impl_.int64_data_.Clear();
+  _impl_.bool_data_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TensorData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "smaug.TensorData.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 half_data = 2 [packed = true];
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_half_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_half_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float float_data = 3 [packed = true];
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_float_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 29) {
+          _internal_add_float_data(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double double_data = 4 [packed = true];
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_double_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 33) {
+          _internal_add_double_data(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 int_data = 5 [packed = true];
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_int_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_int_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int64 int64_data = 6 [packed = true];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt64Parser(_internal_mutable_int64_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_int64_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bool bool_data = 7 [packed = true];
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedBoolParser(_internal_mutable_bool_data(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_bool_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TensorData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.TensorData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "smaug.TensorData.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // repeated int32 half_data = 2 [packed = true];
+  {
+    int byte_size = _impl_._half_data_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          2, _internal_half_data(), byte_size, target);
+    }
+  }
+
+  // repeated float float_data = 3 [packed = true];
+  if (this->_internal_float_data_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_float_data(), target);
+  }
+
+  // repeated double double_data = 4 [packed = true];
+  if (this->_internal_double_data_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_double_data(), target);
+  }
+
+  // repeated int32 int_data = 5 [packed = true];
+  {
+    int byte_size = _impl_._int_data_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt32Packed(
+          5, _internal_int_data(), byte_size, target);
+    }
+  }
+
+  // repeated int64 int64_data = 6 [packed = true];
+  {
+    int byte_size = _impl_._int64_data_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteInt64Packed(
+          6, _internal_int64_data(), byte_size, target);
+    }
+  }
+
+  // repeated bool bool_data = 7 [packed = true];
+  if (this->_internal_bool_data_size() > 0) {
+    target = stream->WriteFixedPacked(7, _internal_bool_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.TensorData)
+  return target;
+}
+
+size_t TensorData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.TensorData)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 half_data = 2 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.half_data_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._half_data_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float float_data = 3 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_float_data_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated double double_data = 4 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_double_data_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated int32 int_data = 5 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.int_data_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._int_data_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated int64 int64_data = 6 [packed = true];
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int64Size(this->_impl_.int64_data_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._int64_data_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated bool bool_data = 7 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_bool_data_size());
+    size_t data_size = 1UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TensorData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TensorData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TensorData::GetClassData() const { return &_class_data_; }
+
+
+void TensorData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TensorData*>(&to_msg);
+  auto& from = static_cast<const TensorData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.TensorData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.half_data_.MergeFrom(from._impl_.half_data_);
+  _this->_impl_.float_data_.MergeFrom(from._impl_.float_data_);
+  _this->_impl_.double_data_.MergeFrom(from._impl_.double_data_);
+  _this->_impl_.int_data_.MergeFrom(from._impl_.int_data_);
+  _this->_impl_.int64_data_.MergeFrom(from._impl_.int64_data_);
+  _this->_impl_.bool_data_.MergeFrom(from._impl_.bool_data_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TensorData::CopyFrom(const TensorData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.TensorData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TensorData::IsInitialized() const {
+  return true;
+}
+
+void TensorData::InternalSwap(TensorData* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.half_data_.InternalSwap(&other->_impl_.half_data_);
+  _impl_.float_data_.InternalSwap(&other->_impl_.float_data_);
+  _impl_.double_data_.InternalSwap(&other->_impl_.double_data_);
+  _impl_.int_data_.InternalSwap(&other->_impl_.int_data_);
+  _impl_.int64_data_.InternalSwap(&other->_impl_.int64_data_);
+  _impl_.bool_data_.InternalSwap(&other->_impl_.bool_data_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TensorData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2ftensor_2eproto_getter, &descriptor_table_smaug_2fcore_2ftensor_2eproto_once,
+      file_level_metadata_smaug_2fcore_2ftensor_2eproto[2]);
+}
+
+// ===================================================================
+
+class TensorDataArray::_Internal {
+ public:
+};
+
+TensorDataArray::TensorDataArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:smaug.TensorDataArray)
+}
+TensorDataArray::TensorDataArray(const TensorDataArray& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TensorDataArray* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_array_){from._impl_.data_array_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:smaug.TensorDataArray)
+}
+
+inline void TensorDataArray::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.data_array_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TensorDataArray::~TensorDataArray() {
+  // @@protoc_insertion_point(destructor:smaug.TensorDataArray)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TensorDataArray::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_array_.~RepeatedPtrField();
+}
+
+void TensorDataArray::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TensorDataArray::Clear() {
+// @@protoc_insertion_point(message_clear_start:smaug.TensorDataArray)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_array_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TensorDataArray::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .smaug.TensorData data_array = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_data_array(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TensorDataArray::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:smaug.TensorDataArray)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .smaug.TensorData data_array = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_data_array_size()); i < n; i++) {
+    const auto& repfield = this->_internal_data_array(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:smaug.TensorDataArray)
+  return target;
+}
+
+size_t TensorDataArray::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:smaug.TensorDataArray)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .smaug.TensorData data_array = 1;
+  total_size += 1UL * this->_internal_data_array_size();
+  for (const auto& msg : this->_impl_.data_array_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TensorDataArray::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TensorDataArray::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TensorDataArray::GetClassData() const { return &_class_data_; }
+
+
+void TensorDataArray::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TensorDataArray*>(&to_msg);
+  auto& from = static_cast<const TensorDataArray&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:smaug.TensorDataArray)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.data_array_.MergeFrom(from._impl_.data_array_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TensorDataArray::CopyFrom(const TensorDataArray& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:smaug.TensorDataArray)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TensorDataArray::IsInitialized() const {
+  return true;
+}
+
+void TensorDataArray::InternalSwap(TensorDataArray* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.data_array_.InternalSwap(&other->_impl_.data_array_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TensorDataArray::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_smaug_2fcore_2ftensor_2eproto_getter, &descriptor_table_smaug_2fcore_2ftensor_2eproto_once,
+      file_level_metadata_smaug_2fcore_2ftensor_2eproto[3]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace smaug
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::smaug::TensorShapeProto*
+Arena::CreateMaybeMessage< ::smaug::TensorShapeProto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::TensorShapeProto >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::TensorProto*
+Arena::CreateMaybeMessage< ::smaug::TensorProto >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::TensorProto >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::TensorData*
+Arena::CreateMaybeMessage< ::smaug::TensorData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::TensorData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::smaug::TensorDataArray*
+Arena::CreateMaybeMessage< ::smaug::TensorDataArray >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::smaug::TensorDataArray >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
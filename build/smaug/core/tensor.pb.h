@@ -0,0 +1,1695 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: smaug/core/tensor.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_smaug_2fcore_2ftensor_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_smaug_2fcore_2ftensor_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "smaug/core/types.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_smaug_2fcore_2ftensor_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_smaug_2fcore_2ftensor_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_smaug_2fcore_2ftensor_2eproto;
+namespace smaug {
+class TensorData;
+struct TensorDataDefaultTypeInternal;
+extern TensorDataDefaultTypeInternal _TensorData_default_instance_;
+class TensorDataArray;
+struct TensorDataArrayDefaultTypeInternal;
+extern TensorDataArrayDefaultTypeInternal _TensorDataArray_default_instance_;
+class TensorProto;
+struct TensorProtoDefaultTypeInternal;
+extern TensorProtoDefaultTypeInternal _TensorProto_default_instance_;
+class TensorShapeProto;
+struct TensorShapeProtoDefaultTypeInternal;
+extern TensorShapeProtoDefaultTypeInternal _TensorShapeProto_default_instance_;
+}  // namespace smaug
+PROTOBUF_NAMESPACE_OPEN
+template<> ::smaug::TensorData* Arena::CreateMaybeMessage<::smaug::TensorData>(Arena*);
+template<> ::smaug::TensorDataArray* Arena::CreateMaybeMessage<::smaug::TensorDataArray>(Arena*);
+template<> ::smaug::TensorProto* Arena::CreateMaybeMessage<::smaug::TensorProto>(Arena*);
+template<> ::smaug::TensorShapeProto* Arena::CreateMaybeMessage<::smaug::TensorShapeProto>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace smaug {
+
+// ===================================================================
+
+class TensorShapeProto final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:smaug.TensorShapeProto) */ {
+ public:
+  inline TensorShapeProto() : TensorShapeProto(nullptr) {}
+  ~TensorShapeProto() override;
+  explicit PROTOBUF_CONSTEXPR TensorShapeProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TensorShapeProto(const TensorShapeProto& from);
+  TensorShapeProto(TensorShapeProto&& from) noexcept
+    : TensorShapeProto() {
+    *this = ::std::move(from);
+  }
+
+  inline TensorShapeProto& operator=(const TensorShapeProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TensorShapeProto& operator=(TensorShapeProto&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorShapeProto& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TensorShapeProto* internal_default_instance() {
+    return reinterpret_cast<const TensorShapeProto*>(
+               &_TensorShapeProto_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(TensorShapeProto& a, TensorShapeProto& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TensorShapeProto* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorShapeProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TensorShapeProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TensorShapeProto>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TensorShapeProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorShapeProto& from) {
+    TensorShapeProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TensorShapeProto* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "smaug.TensorShapeProto";
+  }
+  protected:
+  explicit TensorShapeProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDimsFieldNumber = 1,
+    kLayoutFieldNumber = 2,
+    kAlignmentFieldNumber = 3,
+  };
+  // repeated int32 dims = 1;
+  int dims_size() const;
+  private:
+  int _internal_dims_size() const;
+  public:
+  void clear_dims();
+  private:
+  int32_t _internal_dims(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_dims() const;
+  void _internal_add_dims(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_dims();
+  public:
+  int32_t dims(int index) const;
+  void set_dims(int index, int32_t value);
+  void add_dims(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      dims() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_dims();
+
+  // .smaug.DataLayout layout = 2;
+  void clear_layout();
+  ::smaug::DataLayout layout() const;
+  void set_layout(::smaug::DataLayout value);
+  private:
+  ::smaug::DataLayout _internal_layout() const;
+  void _internal_set_layout(::smaug::DataLayout value);
+  public:
+
+  // int32 alignment = 3;
+  void clear_alignment();
+  int32_t alignment() const;
+  void set_alignment(int32_t value);
+  private:
+  int32_t _internal_alignment() const;
+  void _internal_set_alignment(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:smaug.TensorShapeProto)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > dims_;
+    mutable std::atomic<int> _dims_cached_byte_size_;
+    int layout_;
+    int32_t alignment_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_smaug_2fcore_2ftensor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TensorProto final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:smaug.TensorProto) */ {
+ public:
+  inline TensorProto() : TensorProto(nullptr) {}
+  ~TensorProto() override;
+  explicit PROTOBUF_CONSTEXPR TensorProto(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TensorProto(const TensorProto& from);
+  TensorProto(TensorProto&& from) noexcept
+    : TensorProto() {
+    *this = ::std::move(from);
+  }
+
+  inline TensorProto& operator=(const TensorProto& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TensorProto& operator=(TensorProto&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorProto& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TensorProto* internal_default_instance() {
+    return reinterpret_cast<const TensorProto*>(
+               &_TensorProto_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(TensorProto& a, TensorProto& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TensorProto* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorProto* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TensorProto* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TensorProto>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TensorProto& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorProto& from) {
+    TensorProto::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TensorProto* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "smaug.TensorProto";
+  }
+  protected:
+  explicit TensorProto(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kShapeFieldNumber = 3,
+    kDataFieldNumber = 5,
+    kDataTypeFieldNumber = 2,
+    kDataFormatFieldNumber = 4,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .smaug.TensorShapeProto shape = 3;
+  bool has_shape() const;
+  private:
+  bool _internal_has_shape() const;
+  public:
+  void clear_shape();
+  const ::smaug::TensorShapeProto& shape() const;
+  PROTOBUF_NODISCARD ::smaug::TensorShapeProto* release_shape();
+  ::smaug::TensorShapeProto* mutable_shape();
+  void set_allocated_shape(::smaug::TensorShapeProto* shape);
+  private:
+  const ::smaug::TensorShapeProto& _internal_shape() const;
+  ::smaug::TensorShapeProto* _internal_mutable_shape();
+  public:
+  void unsafe_arena_set_allocated_shape(
+      ::smaug::TensorShapeProto* shape);
+  ::smaug::TensorShapeProto* unsafe_arena_release_shape();
+
+  // .smaug.TensorData data = 5;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const ::smaug::TensorData& data() const;
+  PROTOBUF_NODISCARD ::smaug::TensorData* release_data();
+  ::smaug::TensorData* mutable_data();
+  void set_allocated_data(::smaug::TensorData* data);
+  private:
+  const ::smaug::TensorData& _internal_data() const;
+  ::smaug::TensorData* _internal_mutable_data();
+  public:
+  void unsafe_arena_set_allocated_data(
+      ::smaug::TensorData* data);
+  ::smaug::TensorData* unsafe_arena_release_data();
+
+  // .smaug.DataType data_type = 2;
+  void clear_data_type();
+  ::smaug::DataType data_type() const;
+  void set_data_type(::smaug::DataType value);
+  private:
+  ::smaug::DataType _internal_data_type() const;
+  void _internal_set_data_type(::smaug::DataType value);
+  public:
+
+  // .smaug.DataStorageFormat data_format = 4;
+  void clear_data_format();
+  ::smaug::DataStorageFormat data_format() const;
+  void set_data_format(::smaug::DataStorageFormat value);
+  private:
+  ::smaug::DataStorageFormat _internal_data_format() const;
+  void _internal_set_data_format(::smaug::DataStorageFormat value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:smaug.TensorProto)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::smaug::TensorShapeProto* shape_;
+    ::smaug::TensorData* data_;
+    int data_type_;
+    int data_format_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_smaug_2fcore_2ftensor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TensorData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:smaug.TensorData) */ {
+ public:
+  inline TensorData() : TensorData(nullptr) {}
+  ~TensorData() override;
+  explicit PROTOBUF_CONSTEXPR TensorData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TensorData(const TensorData& from);
+  TensorData(TensorData&& from) noexcept
+    : TensorData() {
+    *this = ::std::move(from);
+  }
+
+  inline TensorData& operator=(const TensorData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TensorData& operator=(TensorData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TensorData* internal_default_instance() {
+    return reinterpret_cast<const TensorData*>(
+               &_TensorData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(TensorData& a, TensorData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TensorData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TensorData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TensorData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TensorData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorData& from) {
+    TensorData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TensorData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "smaug.TensorData";
+  }
+  protected:
+  explicit TensorData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHalfDataFieldNumber = 2,
+    kFloatDataFieldNumber = 3,
+    kDoubleDataFieldNumber = 4,
+    kIntDataFieldNumber = 5,
+    kInt64DataFieldNumber = 6,
+    kBoolDataFieldNumber = 7,
+    kNameFieldNumber = 1,
+  };
+  // repeated int32 half_data = 2 [packed = true];
+  int half_data_size() const;
+  private:
+  int _internal_half_data_size() const;
+  public:
+  void clear_half_data();
+  private:
+  int32_t _internal_half_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_half_data() const;
+  void _internal_add_half_data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_half_data();
+  public:
+  int32_t half_data(int index) const;
+  void set_half_data(int index, int32_t value);
+  void add_half_data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      half_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_half_data();
+
+  // repeated float float_data = 3 [packed = true];
+  int float_data_size() const;
+  private:
+  int _internal_float_data_size() const;
+  public:
+  void clear_float_data();
+  private:
+  float _internal_float_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_float_data() const;
+  void _internal_add_float_data(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_float_data();
+  public:
+  float float_data(int index) const;
+  void set_float_data(int index, float value);
+  void add_float_data(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      float_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_float_data();
+
+  // repeated double double_data = 4 [packed = true];
+  int double_data_size() const;
+  private:
+  int _internal_double_data_size() const;
+  public:
+  void clear_double_data();
+  private:
+  double _internal_double_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_double_data() const;
+  void _internal_add_double_data(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_double_data();
+  public:
+  double double_data(int index) const;
+  void set_double_data(int index, double value);
+  void add_double_data(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      double_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_double_data();
+
+  // repeated int32 int_data = 5 [packed = true];
+  int int_data_size() const;
+  private:
+  int _internal_int_data_size() const;
+  public:
+  void clear_int_data();
+  private:
+  int32_t _internal_int_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_int_data() const;
+  void _internal_add_int_data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_int_data();
+  public:
+  int32_t int_data(int index) const;
+  void set_int_data(int index, int32_t value);
+  void add_int_data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      int_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_int_data();
+
+  // repeated int64 int64_data = 6 [packed = true];
+  int int64_data_size() const;
+  private:
+  int _internal_int64_data_size() const;
+  public:
+  void clear_int64_data();
+  private:
+  int64_t _internal_int64_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      _internal_int64_data() const;
+  void _internal_add_int64_data(int64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      _internal_mutable_int64_data();
+  public:
+  int64_t int64_data(int index) const;
+  void set_int64_data(int index, int64_t value);
+  void add_int64_data(int64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+      int64_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+      mutable_int64_data();
+
+  // repeated bool bool_data = 7 [packed = true];
+  int bool_data_size() const;
+  private:
+  int _internal_bool_data_size() const;
+  public:
+  void clear_bool_data();
+  private:
+  bool _internal_bool_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      _internal_bool_data() const;
+  void _internal_add_bool_data(bool value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      _internal_mutable_bool_data();
+  public:
+  bool bool_data(int index) const;
+  void set_bool_data(int index, bool value);
+  void add_bool_data(bool value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+      bool_data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+      mutable_bool_data();
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:smaug.TensorData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > half_data_;
+    mutable std::atomic<int> _half_data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > float_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > double_data_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > int_data_;
+    mutable std::atomic<int> _int_data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t > int64_data_;
+    mutable std::atomic<int> _int64_data_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool > bool_data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_smaug_2fcore_2ftensor_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TensorDataArray final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:smaug.TensorDataArray) */ {
+ public:
+  inline TensorDataArray() : TensorDataArray(nullptr) {}
+  ~TensorDataArray() override;
+  explicit PROTOBUF_CONSTEXPR TensorDataArray(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TensorDataArray(const TensorDataArray& from);
+  TensorDataArray(TensorDataArray&& from) noexcept
+    : TensorDataArray() {
+    *this = ::std::move(from);
+  }
+
+  inline TensorDataArray& operator=(const TensorDataArray& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TensorDataArray& operator=(TensorDataArray&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TensorDataArray& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TensorDataArray* internal_default_instance() {
+    return reinterpret_cast<const TensorDataArray*>(
+               &_TensorDataArray_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(TensorDataArray& a, TensorDataArray& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TensorDataArray* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TensorDataArray* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TensorDataArray* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TensorDataArray>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TensorDataArray& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TensorDataArray& from) {
+    TensorDataArray::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TensorDataArray* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "smaug.TensorDataArray";
+  }
+  protected:
+  explicit TensorDataArray(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataArrayFieldNumber = 1,
+  };
+  // repeated .smaug.TensorData data_array = 1;
+  int data_array_size() const;
+  private:
+  int _internal_data_array_size() const;
+  public:
+  void clear_data_array();
+  ::smaug::TensorData* mutable_data_array(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::TensorData >*
+      mutable_data_array();
+  private:
+  const ::smaug::TensorData& _internal_data_array(int index) const;
+  ::smaug::TensorData* _internal_add_data_array();
+  public:
+  const ::smaug::TensorData& data_array(int index) const;
+  ::smaug::TensorData* add_data_array();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::TensorData >&
+      data_array() const;
+
+  // @@protoc_insertion_point(class_scope:smaug.TensorDataArray)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::TensorData > data_array_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_smaug_2fcore_2ftensor_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// TensorShapeProto
+
+// repeated int32 dims = 1;
+inline int TensorShapeProto::_internal_dims_size() const {
+  return _impl_.dims_.size();
+}
+inline int TensorShapeProto::dims_size() const {
+  return _internal_dims_size();
+}
+inline void TensorShapeProto::clear_dims() {
+  _impl_.dims_.Clear();
+}
+inline int32_t TensorShapeProto::_internal_dims(int index) const {
+  return _impl_.dims_.Get(index);
+}
+inline int32_t TensorShapeProto::dims(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.TensorShapeProto.dims)
+  return _internal_dims(index);
+}
+inline void TensorShapeProto::set_dims(int index, int32_t value) {
+  _impl_.dims_.Set(index, value);
+  // @@protoc_insertion_point(field_set:smaug.TensorShapeProto.dims)
+}
+inline void TensorShapeProto::_internal_add_dims(int32_t value) {
+  _impl_.dims_.Add(value);
+}
+inline void TensorShapeProto::add_dims(int32_t value) {
+  _internal_add_dims(value);
+  // @@protoc_insertion_point(field_add:smaug.TensorShapeProto.dims)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TensorShapeProto::_internal_dims() const {
+  return _impl_.dims_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TensorShapeProto::dims() const {
+  // @@protoc_insertion_point(field_list:smaug.TensorShapeProto.dims)
+  return _internal_dims();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TensorShapeProto::_internal_mutable_dims() {
+  return &_impl_.dims_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TensorShapeProto::mutable_dims() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.TensorShapeProto.dims)
+  return _internal_mutable_dims();
+}
+
+// .smaug.DataLayout layout = 2;
+inline void TensorShapeProto::clear_layout() {
+  _impl_.layout_ = 0;
+}
+inline ::smaug::DataLayout TensorShapeProto::_internal_layout() const {
+  return static_cast< ::smaug::DataLayout >(_impl_.layout_);
+}
+inline ::smaug::DataLayout TensorShapeProto::layout() const {
+  // @@protoc_insertion_point(field_get:smaug.TensorShapeProto.layout)
+  return _internal_layout();
+}
+inline void TensorShapeProto::_internal_set_layout(::smaug::DataLayout value) {
+  
+  _impl_.layout_ = value;
+}
+inline void TensorShapeProto::set_layout(::smaug::DataLayout value) {
+  _internal_set_layout(value);
+  // @@protoc_insertion_point(field_set:smaug.TensorShapeProto.layout)
+}
+
+// int32 alignment = 3;
+inline void TensorShapeProto::clear_alignment() {
+  _impl_.alignment_ = 0;
+}
+inline int32_t TensorShapeProto::_internal_alignment() const {
+  return _impl_.alignment_;
+}
+inline int32_t TensorShapeProto::alignment() const {
+  // @@protoc_insertion_point(field_get:smaug.TensorShapeProto.alignment)
+  return _internal_alignment();
+}
+inline void TensorShapeProto::_internal_set_alignment(int32_t value) {
+  
+  _impl_.alignment_ = value;
+}
+inline void TensorShapeProto::set_alignment(int32_t value) {
+  _internal_set_alignment(value);
+  // @@protoc_insertion_point(field_set:smaug.TensorShapeProto.alignment)
+}
+
+// -------------------------------------------------------------------
+
+// TensorProto
+
+// string name = 1;
+inline void TensorProto::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& TensorProto::name() const {
+  // @@protoc_insertion_point(field_get:smaug.TensorProto.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TensorProto::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:smaug.TensorProto.name)
+}
+inline std::string* TensorProto::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:smaug.TensorProto.name)
+  return _s;
+}
+inline const std::string& TensorProto::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void TensorProto::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TensorProto::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TensorProto::release_name() {
+  // @@protoc_insertion_point(field_release:smaug.TensorProto.name)
+  return _impl_.name_.Release();
+}
+inline void TensorProto::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:smaug.TensorProto.name)
+}
+
+// .smaug.DataType data_type = 2;
+inline void TensorProto::clear_data_type() {
+  _impl_.data_type_ = 0;
+}
+inline ::smaug::DataType TensorProto::_internal_data_type() const {
+  return static_cast< ::smaug::DataType >(_impl_.data_type_);
+}
+inline ::smaug::DataType TensorProto::data_type() const {
+  // @@protoc_insertion_point(field_get:smaug.TensorProto.data_type)
+  return _internal_data_type();
+}
+inline void TensorProto::_internal_set_data_type(::smaug::DataType value) {
+  
+  _impl_.data_type_ = value;
+}
+inline void TensorProto::set_data_type(::smaug::DataType value) {
+  _internal_set_data_type(value);
+  // @@protoc_insertion_point(field_set:smaug.TensorProto.data_type)
+}
+
+// .smaug.TensorShapeProto shape = 3;
+inline bool TensorProto::_internal_has_shape() const {
+  return this != internal_default_instance() && _impl_.shape_ != nullptr;
+}
+inline bool TensorProto::has_shape() const {
+  return _internal_has_shape();
+}
+inline void TensorProto::clear_shape() {
+  if (GetArenaForAllocation() == nullptr && _impl_.shape_ != nullptr) {
+    delete _impl_.shape_;
+  }
+  _impl_.shape_ = nullptr;
+}
+inline const ::smaug::TensorShapeProto& TensorProto::_internal_shape() const {
+  const ::smaug::TensorShapeProto* p = _impl_.shape_;
+  return p != nullptr ? *p : reinterpret_cast<const ::smaug::TensorShapeProto&>(
+      ::smaug::_TensorShapeProto_default_instance_);
+}
+inline const ::smaug::TensorShapeProto& TensorProto::shape() const {
+  // @@protoc_insertion_point(field_get:smaug.TensorProto.shape)
+  return _internal_shape();
+}
+inline void TensorProto::unsafe_arena_set_allocated_shape(
+    ::smaug::TensorShapeProto* shape) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.shape_);
+  }
+  _impl_.shape_ = shape;
+  if (shape) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:smaug.TensorProto.shape)
+}
+inline ::smaug::TensorShapeProto* TensorProto::release_shape() {
+  
+  ::smaug::TensorShapeProto* temp = _impl_.shape_;
+  _impl_.shape_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::smaug::TensorShapeProto* TensorProto::unsafe_arena_release_shape() {
+  // @@protoc_insertion_point(field_release:smaug.TensorProto.shape)
+  
+  ::smaug::TensorShapeProto* temp = _impl_.shape_;
+  _impl_.shape_ = nullptr;
+  return temp;
+}
+inline ::smaug::TensorShapeProto* TensorProto::_internal_mutable_shape() {
+  
+  if (_impl_.shape_ == nullptr) {
+    auto* p = CreateMaybeMessage<::smaug::TensorShapeProto>(GetArenaForAllocation());
+    _impl_.shape_ = p;
+  }
+  return _impl_.shape_;
+}
+inline ::smaug::TensorShapeProto* TensorProto::mutable_shape() {
+  ::smaug::TensorShapeProto* _msg = _internal_mutable_shape();
+  // @@protoc_insertion_point(field_mutable:smaug.TensorProto.shape)
+  return _msg;
+}
+inline void TensorProto::set_allocated_shape(::smaug::TensorShapeProto* shape) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.shape_;
+  }
+  if (shape) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(shape);
+    if (message_arena != submessage_arena) {
+      shape = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, shape, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.shape_ = shape;
+  // @@protoc_insertion_point(field_set_allocated:smaug.TensorProto.shape)
+}
+
+// .smaug.DataStorageFormat data_format = 4;
+inline void TensorProto::clear_data_format() {
+  _impl_.data_format_ = 0;
+}
+inline ::smaug::DataStorageFormat TensorProto::_internal_data_format() const {
+  return static_cast< ::smaug::DataStorageFormat >(_impl_.data_format_);
+}
+inline ::smaug::DataStorageFormat TensorProto::data_format() const {
+  // @@protoc_insertion_point(field_get:smaug.TensorProto.data_format)
+  return _internal_data_format();
+}
+inline void TensorProto::_internal_set_data_format(::smaug::DataStorageFormat value) {
+  
+  _impl_.data_format_ = value;
+}
+inline void TensorProto::set_data_format(::smaug::DataStorageFormat value) {
+  _internal_set_data_format(value);
+  // @@protoc_insertion_point(field_set:smaug.TensorProto.data_format)
+}
+
+// .smaug.TensorData data = 5;
+inline bool TensorProto::_internal_has_data() const {
+  return this != internal_default_instance() && _impl_.data_ != nullptr;
+}
+inline bool TensorProto::has_data() const {
+  return _internal_has_data();
+}
+inline void TensorProto::clear_data() {
+  if (GetArenaForAllocation() == nullptr && _impl_.data_ != nullptr) {
+    delete _impl_.data_;
+  }
+  _impl_.data_ = nullptr;
+}
+inline const ::smaug::TensorData& TensorProto::_internal_data() const {
+  const ::smaug::TensorData* p = _impl_.data_;
+  return p != nullptr ? *p : reinterpret_cast<const ::smaug::TensorData&>(
+      ::smaug::_TensorData_default_instance_);
+}
+inline const ::smaug::TensorData& TensorProto::data() const {
+  // @@protoc_insertion_point(field_get:smaug.TensorProto.data)
+  return _internal_data();
+}
+inline void TensorProto::unsafe_arena_set_allocated_data(
+    ::smaug::TensorData* data) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.data_);
+  }
+  _impl_.data_ = data;
+  if (data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:smaug.TensorProto.data)
+}
+inline ::smaug::TensorData* TensorProto::release_data() {
+  
+  ::smaug::TensorData* temp = _impl_.data_;
+  _impl_.data_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::smaug::TensorData* TensorProto::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_release:smaug.TensorProto.data)
+  
+  ::smaug::TensorData* temp = _impl_.data_;
+  _impl_.data_ = nullptr;
+  return temp;
+}
+inline ::smaug::TensorData* TensorProto::_internal_mutable_data() {
+  
+  if (_impl_.data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::smaug::TensorData>(GetArenaForAllocation());
+    _impl_.data_ = p;
+  }
+  return _impl_.data_;
+}
+inline ::smaug::TensorData* TensorProto::mutable_data() {
+  ::smaug::TensorData* _msg = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:smaug.TensorProto.data)
+  return _msg;
+}
+inline void TensorProto::set_allocated_data(::smaug::TensorData* data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.data_;
+  }
+  if (data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(data);
+    if (message_arena != submessage_arena) {
+      data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.data_ = data;
+  // @@protoc_insertion_point(field_set_allocated:smaug.TensorProto.data)
+}
+
+// -------------------------------------------------------------------
+
+// TensorData
+
+// string name = 1;
+inline void TensorData::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& TensorData::name() const {
+  // @@protoc_insertion_point(field_get:smaug.TensorData.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TensorData::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:smaug.TensorData.name)
+}
+inline std::string* TensorData::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:smaug.TensorData.name)
+  return _s;
+}
+inline const std::string& TensorData::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void TensorData::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TensorData::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TensorData::release_name() {
+  // @@protoc_insertion_point(field_release:smaug.TensorData.name)
+  return _impl_.name_.Release();
+}
+inline void TensorData::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:smaug.TensorData.name)
+}
+
+// repeated int32 half_data = 2 [packed = true];
+inline int TensorData::_internal_half_data_size() const {
+  return _impl_.half_data_.size();
+}
+inline int TensorData::half_data_size() const {
+  return _internal_half_data_size();
+}
+inline void TensorData::clear_half_data() {
+  _impl_.half_data_.Clear();
+}
+inline int32_t TensorData::_internal_half_data(int index) const {
+  return _impl_.half_data_.Get(index);
+}
+inline int32_t TensorData::half_data(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.TensorData.half_data)
+  return _internal_half_data(index);
+}
+inline void TensorData::set_half_data(int index, int32_t value) {
+  _impl_.half_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:smaug.TensorData.half_data)
+}
+inline void TensorData::_internal_add_half_data(int32_t value) {
+  _impl_.half_data_.Add(value);
+}
+inline void TensorData::add_half_data(int32_t value) {
+  _internal_add_half_data(value);
+  // @@protoc_insertion_point(field_add:smaug.TensorData.half_data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TensorData::_internal_half_data() const {
+  return _impl_.half_data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TensorData::half_data() const {
+  // @@protoc_insertion_point(field_list:smaug.TensorData.half_data)
+  return _internal_half_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TensorData::_internal_mutable_half_data() {
+  return &_impl_.half_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TensorData::mutable_half_data() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.TensorData.half_data)
+  return _internal_mutable_half_data();
+}
+
+// repeated float float_data = 3 [packed = true];
+inline int TensorData::_internal_float_data_size() const {
+  return _impl_.float_data_.size();
+}
+inline int TensorData::float_data_size() const {
+  return _internal_float_data_size();
+}
+inline void TensorData::clear_float_data() {
+  _impl_.float_data_.Clear();
+}
+inline float TensorData::_internal_float_data(int index) const {
+  return _impl_.float_data_.Get(index);
+}
+inline float TensorData::float_data(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.TensorData.float_data)
+  return _internal_float_data(index);
+}
+inline void TensorData::set_float_data(int index, float value) {
+  _impl_.float_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:smaug.TensorData.float_data)
+}
+inline void TensorData::_internal_add_float_data(float value) {
+  _impl_.float_data_.Add(value);
+}
+inline void TensorData::add_float_data(float value) {
+  _internal_add_float_data(value);
+  // @@protoc_insertion_point(field_add:smaug.TensorData.float_data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TensorData::_internal_float_data() const {
+  return _impl_.float_data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+TensorData::float_data() const {
+  // @@protoc_insertion_point(field_list:smaug.TensorData.float_data)
+  return _internal_float_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TensorData::_internal_mutable_float_data() {
+  return &_impl_.float_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+TensorData::mutable_float_data() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.TensorData.float_data)
+  return _internal_mutable_float_data();
+}
+
+// repeated double double_data = 4 [packed = true];
+inline int TensorData::_internal_double_data_size() const {
+  return _impl_.double_data_.size();
+}
+inline int TensorData::double_data_size() const {
+  return _internal_double_data_size();
+}
+inline void TensorData::clear_double_data() {
+  _impl_.double_data_.Clear();
+}
+inline double TensorData::_internal_double_data(int index) const {
+  return _impl_.double_data_.Get(index);
+}
+inline double TensorData::double_data(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.TensorData.double_data)
+  return _internal_double_data(index);
+}
+inline void TensorData::set_double_data(int index, double value) {
+  _impl_.double_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:smaug.TensorData.double_data)
+}
+inline void TensorData::_internal_add_double_data(double value) {
+  _impl_.double_data_.Add(value);
+}
+inline void TensorData::add_double_data(double value) {
+  _internal_add_double_data(value);
+  // @@protoc_insertion_point(field_add:smaug.TensorData.double_data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+TensorData::_internal_double_data() const {
+  return _impl_.double_data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+TensorData::double_data() const {
+  // @@protoc_insertion_point(field_list:smaug.TensorData.double_data)
+  return _internal_double_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+TensorData::_internal_mutable_double_data() {
+  return &_impl_.double_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+TensorData::mutable_double_data() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.TensorData.double_data)
+  return _internal_mutable_double_data();
+}
+
+// repeated int32 int_data = 5 [packed = true];
+inline int TensorData::_internal_int_data_size() const {
+  return _impl_.int_data_.size();
+}
+inline int TensorData::int_data_size() const {
+  return _internal_int_data_size();
+}
+inline void TensorData::clear_int_data() {
+  _impl_.int_data_.Clear();
+}
+inline int32_t TensorData::_internal_int_data(int index) const {
+  return _impl_.int_data_.Get(index);
+}
+inline int32_t TensorData::int_data(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.TensorData.int_data)
+  return _internal_int_data(index);
+}
+inline void TensorData::set_int_data(int index, int32_t value) {
+  _impl_.int_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:smaug.TensorData.int_data)
+}
+inline void TensorData::_internal_add_int_data(int32_t value) {
+  _impl_.int_data_.Add(value);
+}
+inline void TensorData::add_int_data(int32_t value) {
+  _internal_add_int_data(value);
+  // @@protoc_insertion_point(field_add:smaug.TensorData.int_data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TensorData::_internal_int_data() const {
+  return _impl_.int_data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+TensorData::int_data() const {
+  // @@protoc_insertion_point(field_list:smaug.TensorData.int_data)
+  return _internal_int_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TensorData::_internal_mutable_int_data() {
+  return &_impl_.int_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+TensorData::mutable_int_data() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.TensorData.int_data)
+  return _internal_mutable_int_data();
+}
+
+// repeated int64 int64_data = 6 [packed = true];
+inline int TensorData::_internal_int64_data_size() const {
+  return _impl_.int64_data_.size();
+}
+inline int TensorData::int64_data_size() const {
+  return _internal_int64_data_size();
+}
+inline void TensorData::clear_int64_data() {
+  _impl_.int64_data_.Clear();
+}
+inline int64_t TensorData::_internal_int64_data(int index) const {
+  return _impl_.int64_data_.Get(index);
+}
+inline int64_t TensorData::int64_data(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.TensorData.int64_data)
+  return _internal_int64_data(index);
+}
+inline void TensorData::set_int64_data(int index, int64_t value) {
+  _impl_.int64_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:smaug.TensorData.int64_data)
+}
+inline void TensorData::_internal_add_int64_data(int64_t value) {
+  _impl_.int64_data_.Add(value);
+}
+inline void TensorData::add_int64_data(int64_t value) {
+  _internal_add_int64_data(value);
+  // @@protoc_insertion_point(field_add:smaug.TensorData.int64_data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+TensorData::_internal_int64_data() const {
+  return _impl_.int64_data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >&
+TensorData::int64_data() const {
+  // @@protoc_insertion_point(field_list:smaug.TensorData.int64_data)
+  return _internal_int64_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+TensorData::_internal_mutable_int64_data() {
+  return &_impl_.int64_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int64_t >*
+TensorData::mutable_int64_data() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.TensorData.int64_data)
+  return _internal_mutable_int64_data();
+}
+
+// repeated bool bool_data = 7 [packed = true];
+inline int TensorData::_internal_bool_data_size() const {
+  return _impl_.bool_data_.size();
+}
+inline int TensorData::bool_data_size() const {
+  return _internal_bool_data_size();
+}
+inline void TensorData::clear_bool_data() {
+  _impl_.bool_data_.Clear();
+}
+inline bool TensorData::_internal_bool_data(int index) const {
+  return _impl_.bool_data_.Get(index);
+}
+inline bool TensorData::bool_data(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.TensorData.bool_data)
+  return _internal_bool_data(index);
+}
+inline void TensorData::set_bool_data(int index, bool value) {
+  _impl_.bool_data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:smaug.TensorData.bool_data)
+}
+inline void TensorData::_internal_add_bool_data(bool value) {
+  _impl_.bool_data_.Add(value);
+}
+inline void TensorData::add_bool_data(bool value) {
+  _internal_add_bool_data(value);
+  // @@protoc_insertion_point(field_add:smaug.TensorData.bool_data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+TensorData::_internal_bool_data() const {
+  return _impl_.bool_data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >&
+TensorData::bool_data() const {
+  // @@protoc_insertion_point(field_list:smaug.TensorData.bool_data)
+  return _internal_bool_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+TensorData::_internal_mutable_bool_data() {
+  return &_impl_.bool_data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< bool >*
+TensorData::mutable_bool_data() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.TensorData.bool_data)
+  return _internal_mutable_bool_data();
+}
+
+// -------------------------------------------------------------------
+
+// TensorDataArray
+
+// repeated .smaug.TensorData data_array = 1;
+inline int TensorDataArray::_internal_data_array_size() const {
+  return _impl_.data_array_.size();
+}
+inline int TensorDataArray::data_array_size() const {
+  return _internal_data_array_size();
+}
+inline void TensorDataArray::clear_data_array() {
+  _impl_.data_array_.Clear();
+}
+inline ::smaug::TensorData* TensorDataArray::mutable_data_array(int index) {
+  // @@protoc_insertion_point(field_mutable:smaug.TensorDataArray.data_array)
+  return _impl_.data_array_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::TensorData >*
+TensorDataArray::mutable_data_array() {
+  // @@protoc_insertion_point(field_mutable_list:smaug.TensorDataArray.data_array)
+  return &_impl_.data_array_;
+}
+inline const ::smaug::TensorData& TensorDataArray::_internal_data_array(int index) const {
+  return _impl_.data_array_.Get(index);
+}
+inline const ::smaug::TensorData& TensorDataArray::data_array(int index) const {
+  // @@protoc_insertion_point(field_get:smaug.TensorDataArray.data_array)
+  return _internal_data_array(index);
+}
+inline ::smaug::TensorData* TensorDataArray::_internal_add_data_array() {
+  return _impl_.data_array_.Add();
+}
+inline ::smaug::TensorData* TensorDataArray::add_data_array() {
+  ::smaug::TensorData* _add = _internal_add_data_array();
+  // @@protoc_insertion_point(field_add:smaug.TensorDataArray.data_array)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::smaug::TensorData >&
+TensorDataArray::data_array() const {
+  // @@protoc_insertion_point(field_list:smaug.TensorDataArray.data_array)
+  return _impl_.data_array_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace smaug
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_smaug_2fcore_2ftensor_2eproto
@@ -0,0 +1 @@
+/root/repo/smaug/core/tensor_bench.cpp
\ No newline at end of file
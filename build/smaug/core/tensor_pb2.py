@@ -0,0 +1,44 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: smaug/core/tensor.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+from smaug.core import types_pb2 as smaug_dot_core_dot_types__pb2
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x17smaug/core/tensor.proto\x12\x05smaug\x1a\x16smaug/core/types.proto\"V\n\x10TensorShapeProto\x12\x0c\n\x04\x64ims\x18\x01 \x03(\x05\x12!\n\x06layout\x18\x02 \x01(\x0e\x32\x11.smaug.DataLayout\x12\x11\n\talignment\x18\x03 \x01(\x05\"\xb7\x01\n\x0bTensorProto\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\"\n\tdata_type\x18\x02 \x01(\x0e\x32\x0f.smaug.DataType\x12&\n\x05shape\x18\x03 \x01(\x0b\x32\x17.smaug.TensorShapeProto\x12-\n\x0b\x64\x61ta_format\x18\x04 \x01(\x0e\x32\x18.smaug.DataStorageFormat\x12\x1f\n\x04\x64\x61ta\x18\x05 \x01(\x0b\x32\x11.smaug.TensorData\"\xa7\x01\n\nTensorData\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x15\n\thalf_data\x18\x02 \x03(\x05\x42\x02\x10\x01\x12\x16\n\nfloat_data\x18\x03 \x03(\x02\x42\x02\x10\x01\x12\x17\n\x0b\x64ouble_data\x18\x04 \x03(\x01\x42\x02\x10\x01\x12\x14\n\x08int_data\x18\x05 \x03(\x05\x42\x02\x10\x01\x12\x16\n\nint64_data\x18\x06 \x03(\x03\x42\x02\x10\x01\x12\x15\n\tbool_data\x18\x07 \x03(\x08\x42\x02\x10\x01\"8\n\x0fTensorDataArray\x12%\n\ndata_array\x18\x01 \x03(\x0b\x32\x11.smaug.TensorDatab\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'smaug.core.tensor_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _TENSORDATA.fields_by_name['half_data']._options = None
+  _TENSORDATA.fields_by_name['half_data']._serialized_options = b'\020\001'
+  _TENSORDATA.fields_by_name['float_data']._options = None
+  _TENSORDATA.fields_by_name['float_data']._serialized_options = b'\020\001'
+  _TENSORDATA.fields_by_name['double_data']._options = None
+  _TENSORDATA.fields_by_name['double_data']._serialized_options = b'\020\001'
+  _TENSORDATA.fields_by_name['int_data']._options = None
+  _TENSORDATA.fields_by_name['int_data']._serialized_options = b'\020\001'
+  _TENSORDATA.fields_by_name['int64_data']._options = None
+  _TENSORDATA.fields_by_name['int64_data']._serialized_options = b'\020\001'
+  _TENSORDATA.fields_by_name['bool_data']._options = None
+  _TENSORDATA.fields_by_name['bool_data']._serialized_options = b'\020\001'
+  _TENSORSHAPEPROTO._serialized_start=58
+  _TENSORSHAPEPROTO._serialized_end=144
+  _TENSORPROTO._serialized_start=147
+  _TENSORPROTO._serialized_end=330
+  _TENSORDATA._serialized_start=333
+  _TENSORDATA._serialized_end=500
+  _TENSORDATAARRAY._serialized_start=502
+  _TENSORDATAARRAY._serialized_end=558
+# @@protoc_insertion_point(module_scope)
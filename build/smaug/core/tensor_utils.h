@@ -0,0 +1 @@
+/root/repo/smaug/core/tensor_utils.h
\ No newline at end of file
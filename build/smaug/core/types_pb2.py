@@ -0,0 +1,37 @@
+# -*- coding: utf-8 -*-
+# Generated by the protocol buffer compiler.  DO NOT EDIT!
+# source: smaug/core/types.proto
+"""Generated protocol buffer code."""
+from google.protobuf.internal import builder as _builder
+from google.protobuf import descriptor as _descriptor
+from google.protobuf import descriptor_pool as _descriptor_pool
+from google.protobuf import symbol_database as _symbol_database
+# @@protoc_insertion_point(imports)
+
+_sym_db = _symbol_database.Default()
+
+
+
+
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x16smaug/core/types.proto\x12\x05smaug*f\n\x08\x44\x61taType\x12\x13\n\x0fUnknownDataType\x10\x00\x12\t\n\x05Int32\x10\x01\x12\t\n\x05Int64\x10\x02\x12\x0b\n\x07\x46loat16\x10\x03\x12\x0b\n\x07\x46loat32\x10\x04\x12\x0b\n\x07\x46loat64\x10\x05\x12\x08\n\x04\x42ool\x10\x06*z\n\nDataLayout\x12\x11\n\rUnknownLayout\x10\x00\x12\x08\n\x04NCHW\x10\x01\x12\x08\n\x04NHWC\x10\x02\x12\x06\n\x02NC\x10\x04\x12\x06\n\x02\x43N\x10\x08\x12\x07\n\x03NCT\x10\x10\x12\x07\n\x03NTC\x10 \x12\x05\n\x01N\x10@\x12\x05\n\x01X\x10\x7f\x12\x11\n\rEndDataLayout\x10@\x1a\x02\x10\x01*v\n\x11\x44\x61taStorageFormat\x12\x18\n\x14UnknownStorageFormat\x10\x00\x12\x10\n\x0cUncompressed\x10\x01\x12\x07\n\x03\x43SR\x10\x02\x12\r\n\tPackedCSR\x10\x03\x12\x1d\n\x19UncompressedHalfPrecision\x10\x04*\xa6\x03\n\x06OpType\x12\r\n\tUnknownOp\x10\x00\x12\x11\n\rConvolution3d\x10\x01\x12\x18\n\x14\x43onvolutionDepthwise\x10\x02\x12\x0e\n\nMaxPooling\x10\x03\x12\x12\n\x0e\x41veragePooling\x10\x04\x12\x10\n\x0cInnerProduct\x10\x05\x12\r\n\tBatchNorm\x10\x06\x12\x08\n\x04\x44\x61ta\x10\x07\x12\x08\n\x04ReLU\x10\x08\x12\t\n\x05LReLU\x10\t\x12\x07\n\x03\x45LU\x10\n\x12\x08\n\x04SELU\x10\x0b\x12\x08\n\x04Tanh\x10\x0c\x12\x0c\n\x08HardTanh\x10\r\x12\x0b\n\x07Sigmoid\x10\x0e\x12\x0b\n\x07Softmax\x10\x0f\x12\x0e\n\nEltwiseAdd\x10\x10\x12\x0b\n\x07Reorder\x10\x11\x12\x0e\n\nEltwiseMul\x10\x12\x12\n\n\x06\x43oncat\x10\x13\x12\t\n\x05Split\x10\x14\x12\x0b\n\x07Reshape\x10\x15\x12\n\n\x06Repeat\x10\x16\x12\x08\n\x04Less\x10\x17\x12\r\n\tLessEqual\x10\x18\x12\x0b\n\x07Greater\x10\x19\x12\x10\n\x0cGreaterEqual\x10\x1a\x12\n\n\x06Switch\x10\x1b\x12\t\n\x05Merge\x10\x1c\x12\x0b\n\x07Padding\x10\x1d*D\n\x0bPaddingType\x12\x12\n\x0eUnknownPadding\x10\x00\x12\x0f\n\x0bSamePadding\x10\x01\x12\x10\n\x0cValidPadding\x10\x02*l\n\x16HostMemoryAccessPolicy\x12\x17\n\x13UnknownMemoryPolicy\x10\x00\x12\n\n\x06\x41llDma\x10\x01\x12\n\n\x06\x41llAcp\x10\x02\x12\x1b\n\x17\x41llAcpWithDmaForWeights\x10\x04\"\x04\x08\x03\x10\x03\x62\x06proto3')
+
+_builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
+_builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'smaug.core.types_pb2', globals())
+if _descriptor._USE_C_DESCRIPTORS == False:
+
+  DESCRIPTOR._options = None
+  _DATALAYOUT._options = None
+  _DATALAYOUT._serialized_options = b'\020\001'
+  _DATATYPE._serialized_start=33
+  _DATATYPE._serialized_end=135
+  _DATALAYOUT._serialized_start=137
+  _DATALAYOUT._serialized_end=259
+  _DATASTORAGEFORMAT._serialized_start=261
+  _DATASTORAGEFORMAT._serialized_end=379
+  _OPTYPE._serialized_start=382
+  _OPTYPE._serialized_end=804
+  _PADDINGTYPE._serialized_start=806
+  _PADDINGTYPE._serialized_end=874
+  _HOSTMEMORYACCESSPOLICY._serialized_start=876
+  _HOSTMEMORYACCESSPOLICY._serialized_end=984
+# @@protoc_insertion_point(module_scope)
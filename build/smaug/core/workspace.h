@@ -0,0 +1 @@
+/root/repo/smaug/core/workspace.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/batch_norm_op.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/common.h
\ No newline at end of file
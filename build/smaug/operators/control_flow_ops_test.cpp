@@ -0,0 +1 @@
+/root/repo/smaug/operators/control_flow_ops_test.cpp
\ No newline at end of file
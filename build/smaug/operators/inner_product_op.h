@@ -0,0 +1 @@
+/root/repo/smaug/operators/inner_product_op.h
\ No newline at end of file
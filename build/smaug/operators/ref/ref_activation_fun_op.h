@@ -0,0 +1 @@
+/root/repo/smaug/operators/ref/ref_activation_fun_op.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/ref/ref_convolution_op.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/ref/ref_eltwise_mul_op.cpp
\ No newline at end of file
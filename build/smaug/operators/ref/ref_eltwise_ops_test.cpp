@@ -0,0 +1 @@
+/root/repo/smaug/operators/ref/ref_eltwise_ops_test.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/ref/ref_ops_bench.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/ref/ref_relu_op.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/relu_op.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/reshape_op.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/sigmoid_op.h
\ No newline at end of file
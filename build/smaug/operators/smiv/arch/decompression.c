@@ -0,0 +1 @@
+/root/repo/smaug/operators/smiv/arch/decompression.c
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smiv/arch/smiv.cpp
\ No newline at end of file
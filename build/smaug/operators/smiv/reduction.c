@@ -0,0 +1 @@
+/root/repo/smaug/operators/smiv/reduction.c
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/kernels/batch_norm.c
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/kernels/eltwise_add.c
\ No newline at end of file
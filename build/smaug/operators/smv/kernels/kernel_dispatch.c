@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/kernels/kernel_dispatch.c
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/kernels/kernel_dispatch.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/kernels/load_store_fp16_data.c
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/kernels/matrix_multiply.c
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/kernels/smv_kernels_bench.cpp
\ No newline at end of file
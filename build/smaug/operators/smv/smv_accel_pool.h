@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_accel_pool.h
\ No newline at end of file
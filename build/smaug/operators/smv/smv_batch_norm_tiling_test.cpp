@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_batch_norm_tiling_test.cpp
\ No newline at end of file
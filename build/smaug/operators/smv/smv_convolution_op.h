@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_convolution_op.h
\ No newline at end of file
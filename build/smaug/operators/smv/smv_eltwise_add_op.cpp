@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_eltwise_add_op.cpp
\ No newline at end of file
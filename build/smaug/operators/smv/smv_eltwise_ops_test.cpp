@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_eltwise_ops_test.cpp
\ No newline at end of file
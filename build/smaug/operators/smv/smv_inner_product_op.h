@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_inner_product_op.h
\ No newline at end of file
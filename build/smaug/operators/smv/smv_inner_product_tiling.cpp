@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_inner_product_tiling.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_kernels.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_sigmoid_op.h
\ No newline at end of file
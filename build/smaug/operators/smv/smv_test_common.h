@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_test_common.h
\ No newline at end of file
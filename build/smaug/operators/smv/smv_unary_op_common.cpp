@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_unary_op_common.cpp
\ No newline at end of file
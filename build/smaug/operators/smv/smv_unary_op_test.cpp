@@ -0,0 +1 @@
+/root/repo/smaug/operators/smv/smv_unary_op_test.cpp
\ No newline at end of file
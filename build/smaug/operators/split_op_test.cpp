@@ -0,0 +1 @@
+/root/repo/smaug/operators/split_op_test.cpp
\ No newline at end of file
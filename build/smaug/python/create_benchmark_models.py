@@ -0,0 +1 @@
+/root/repo/smaug/python/create_benchmark_models.py
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/python/create_model_example.py
\ No newline at end of file
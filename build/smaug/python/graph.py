@@ -0,0 +1 @@
+/root/repo/smaug/python/graph.py
\ No newline at end of file
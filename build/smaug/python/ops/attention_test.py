@@ -0,0 +1 @@
+/root/repo/smaug/python/ops/attention_test.py
\ No newline at end of file
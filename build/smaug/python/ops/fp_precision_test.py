@@ -0,0 +1 @@
+/root/repo/smaug/python/ops/fp_precision_test.py
\ No newline at end of file
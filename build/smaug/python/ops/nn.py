@@ -0,0 +1 @@
+/root/repo/smaug/python/ops/nn.py
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/python/ops/recurrent.py
\ No newline at end of file
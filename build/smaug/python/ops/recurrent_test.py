@@ -0,0 +1 @@
+/root/repo/smaug/python/ops/recurrent_test.py
\ No newline at end of file
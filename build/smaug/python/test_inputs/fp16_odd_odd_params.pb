@@ -0,0 +1 @@
+/root/repo/smaug/python/test_inputs/fp16_odd_odd_params.pb
\ No newline at end of file
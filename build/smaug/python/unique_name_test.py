@@ -0,0 +1 @@
+/root/repo/smaug/python/unique_name_test.py
\ No newline at end of file
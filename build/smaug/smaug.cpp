@@ -0,0 +1 @@
+/root/repo/smaug/smaug.cpp
\ No newline at end of file
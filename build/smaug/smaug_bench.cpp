@@ -0,0 +1 @@
+/root/repo/smaug/smaug_bench.cpp
\ No newline at end of file
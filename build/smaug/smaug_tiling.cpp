@@ -0,0 +1 @@
+/root/repo/smaug/smaug_tiling.cpp
\ No newline at end of file
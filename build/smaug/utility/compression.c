@@ -0,0 +1 @@
+/root/repo/smaug/utility/compression.c
\ No newline at end of file
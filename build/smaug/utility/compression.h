@@ -0,0 +1 @@
+/root/repo/smaug/utility/compression.h
\ No newline at end of file
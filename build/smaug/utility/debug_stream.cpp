@@ -0,0 +1 @@
+/root/repo/smaug/utility/debug_stream.cpp
\ No newline at end of file
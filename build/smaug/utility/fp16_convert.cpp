@@ -0,0 +1 @@
+/root/repo/smaug/utility/fp16_convert.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/utility/fp16_convert.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/utility/fp16_utils.h
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/utility/task_thread.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+/root/repo/smaug/utility/task_thread.h
\ No newline at end of file
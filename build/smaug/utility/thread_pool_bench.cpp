@@ -0,0 +1 @@
+/root/repo/smaug/utility/thread_pool_bench.cpp
\ No newline at end of file
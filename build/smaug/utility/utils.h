@@ -0,0 +1 @@
+/root/repo/smaug/utility/utils.h
\ No newline at end of file
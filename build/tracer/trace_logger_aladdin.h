@@ -0,0 +1 @@
+/tmp/stub/tracer/profile-func/trace_logger_aladdin.h
\ No newline at end of file
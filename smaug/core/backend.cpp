@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "smaug/core/backend.h"
 #include "smaug/operators/batch_norm_op.h"
 #include "smaug/operators/concat_op.h"
@@ -139,9 +141,65 @@ const unsigned kPoolingHw = 0x0003;
 // The systolic array is implemented in gem5 instead of Aladdin, so it needs to
 // have a different accelerator id.
 const unsigned kSystolicArrayHw = 0x0004;
+Scratchpads accelSpads[maxNumAccelerators];
 float* spad0;
 float* spad1;
 float* spad2;
 }  // namespace smv
 
+int SmvBackend::SpadSize() {
+    int size = SpadSize(0);
+    for (int i = 1; i < numAcceleratorsAvailable; i++)
+        size = std::min(size, SpadSize(i));
+    return size;
+}
+
+int SmvBackend::SpadSize(int accelIdx) {
+    assert(accelIdx >= 0 && accelIdx < maxNumAccelerators);
+    // Accelerators without scratchpads of their own yet (e.g., when only
+    // tiling the operators) have the default size.
+    const smv::Scratchpads& spads = smv::accelSpads[accelIdx];
+    return spads.spad0 ? spads.size : smv::kSpadSize;
+}
+
+void SmvBackend::setSpadSize(int accelIdx, int size) {
+    assert(accelIdx >= 0 && accelIdx < maxNumAccelerators);
+    smv::Scratchpads& spads = smv::accelSpads[accelIdx];
+    free(spads.spad0);
+    free(spads.spad1);
+    free(spads.spad2);
+    // The size is in bytes of float16 data, while the scratchpads store
+    // float32 data (see smv::Scratchpads), which is why the allocated memory
+    // size is double the scratchpad size.
+    spads.spad0 = (float*)malloc_aligned(size * 2);
+    spads.spad1 = (float*)malloc_aligned(size * 2);
+    spads.spad2 = (float*)malloc_aligned(size * 2);
+    spads.size = size;
+    if (accelIdx == 0) {
+        smv::spad0 = spads.spad0;
+        smv::spad1 = spads.spad1;
+        smv::spad2 = spads.spad2;
+    }
+}
+
+void SmvBackend::initGlobals() {
+    // kSpadSize is in bytes of float16 data.
+    smv::kSpadSize = 32 * 1024;
+    for (int i = 0; i < maxNumAccelerators; i++)
+        setSpadSize(i, smv::kSpadSize);
+}
+
+void SmvBackend::freeGlobals() {
+    for (int i = 0; i < maxNumAccelerators; i++) {
+        smv::Scratchpads& spads = smv::accelSpads[i];
+        free(spads.spad0);
+        free(spads.spad1);
+        free(spads.spad2);
+        spads = smv::Scratchpads();
+    }
+    smv::spad0 = nullptr;
+    smv::spad1 = nullptr;
+    smv::spad2 = nullptr;
+}
+
 }  // namespace smaug
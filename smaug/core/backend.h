@@ -4,6 +4,7 @@
 #include <string>
 
 #include "smaug/core/datatypes.h"
+#include "smaug/core/globals.h"
 #include "smaug/utility/utils.h"
 
 // These are compile-time switches that selectively build a copy of SMAUG with
@@ -141,8 +142,33 @@ extern const unsigned kEltwiseOpHw;
 extern const unsigned kBatchNormHw;
 extern const unsigned kPoolingHw;
 extern const unsigned kSystolicArrayHw;
+
+/**
+ * The scratchpads of one accelerator.
+ *
+ * Scratchpad sizes are in bytes of float16 data. In SMV, all tensors store
+ * float16 data, but due to the modelling restriction of Aladdin, we actually
+ * store float32 data in the scratchpads, so every scratchpad is allocated
+ * with twice its size.
+ */
+struct Scratchpads {
+    float* spad0;
+    float* spad1;
+    float* spad2;
+    /** The size of each scratchpad, in bytes of float16 data. */
+    int size;
+};
+
+/**
+ * The scratchpads of every accelerator, indexed by the accelerator's index in
+ * SmvAcceleratorPool. Each accelerator owns its scratchpads, so the tiles
+ * running on different accelerators never share SRAM.
+ */
+extern Scratchpads accelSpads[maxNumAccelerators];
+
 // Note that these naked pointers are never to be used except when invoking the
-// kernels themselves.
+// kernels themselves. They are the scratchpads of the first accelerator, which
+// operators that don't use an SmvAcceleratorPool run on.
 extern float* spad0;
 extern float* spad1;
 extern float* spad2;
@@ -194,23 +220,21 @@ class SmvBackend {
     static const std::string Name;
     static const DataLayout DefaultInputDataLayout = DataLayout::NHWC;
 
-    static int SpadSize() { return smv::kSpadSize; }
-    static void initGlobals() {
-        // kSpadSize is in terms of float16 data.
-        smv::kSpadSize = 32 * 1024;
-        // In SMV, all tensors store float16 data, but due to the modelling
-        // restriction of Aladdin, we actually store float32 data in the
-        // scratchpads. This why the allocated memory size here is double
-        // kSpadSize.
-        smv::spad0 = (float*)malloc_aligned(smv::kSpadSize * 2);
-        smv::spad1 = (float*)malloc_aligned(smv::kSpadSize * 2);
-        smv::spad2 = (float*)malloc_aligned(smv::kSpadSize * 2);
-    }
-    static void freeGlobals() {
-        free(smv::spad0);
-        free(smv::spad1);
-        free(smv::spad2);
-    }
+    /**
+     * Returns the scratchpad size that tiles must fit in, in bytes. Since
+     * tiles can be scheduled on any of the available accelerators, this is
+     * the smallest of their scratchpads.
+     */
+    static int SpadSize();
+    /** Returns the scratchpad size of the given accelerator, in bytes. */
+    static int SpadSize(int accelIdx);
+    /**
+     * Resizes the scratchpads of the given accelerator, in bytes. This must
+     * not be called while any kernel is running on the accelerator.
+     */
+    static void setSpadSize(int accelIdx, int size);
+    static void initGlobals();
+    static void freeGlobals();
 
     DECL_CREATE_SMV_OP(ConvolutionOp);
     DECL_CREATE_SMV_OP(InnerProductOp);
@@ -6,4 +6,6 @@ bool fastForwardMode = true;
 int numAcceleratorsAvailable;
 ThreadPool* threadPool = nullptr;
 bool useSystolicArrayWhenAvailable;
+bool useAcceleratorThreads = true;
+bool pipelineTileCopies = true;
 }  // namespace smaug
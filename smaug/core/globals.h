@@ -40,6 +40,19 @@ extern ThreadPool* threadPool;
  */
 extern bool useSystolicArrayWhenAvailable;
 
+/**
+ * If true, native (non-simulated) runs give each accelerator a host thread
+ * with scratchpads of its own, so that independent tiles run concurrently.
+ */
+extern bool useAcceleratorThreads;
+
+/**
+ * If true, native runs of the SMV operators copy data into the next tiles on a
+ * helper thread while the current tiles are computed, and copy every output
+ * tile back as soon as its results are final.
+ */
+extern bool pipelineTileCopies;
+
 }  // namespace smaug
 
 #endif
@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "smaug/core/inference_server.h"
+#include "smaug/core/tensor.h"
+
+namespace smaug {
+
+namespace {
+
+/** Tensor names longer than this are taken as a corrupted message. */
+constexpr uint32_t kMaxNameSize = 1 << 16;
+
+bool readFully(int fd, void* buf, size_t size) {
+    char* ptr = reinterpret_cast<char*>(buf);
+    while (size > 0) {
+        ssize_t count = recv(fd, ptr, size, 0);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+        ptr += count;
+        size -= count;
+    }
+    return true;
+}
+
+bool writeFully(int fd, const void* buf, size_t size) {
+    const char* ptr = reinterpret_cast<const char*>(buf);
+    while (size > 0) {
+        // A client that hangs up must not kill the server with SIGPIPE.
+        ssize_t count = send(fd, ptr, size, MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR)
+            continue;
+        if (count <= 0)
+            return false;
+        ptr += count;
+        size -= count;
+    }
+    return true;
+}
+
+/** Reads and drops size bytes, without buffering more than a page of them. */
+bool skipFully(int fd, uint64_t size) {
+    char buf[4096];
+    while (size > 0) {
+        size_t count = std::min<uint64_t>(size, sizeof(buf));
+        if (!readFully(fd, buf, count))
+            return false;
+        size -= count;
+    }
+    return true;
+}
+
+/**
+ * Returns the size in bytes that the data of the named blob must have, or -1
+ * if there is no such blob.
+ */
+typedef std::function<int64_t(const std::string&)> BlobSizeFunc;
+
+/**
+ * A message is the number of blobs, followed by the name size, data size,
+ * name and data of every blob, in host byte order.
+ *
+ * Messages of more than maxBlobs blobs are taken as corrupted. If blobSize is
+ * given, the data of blobs of unknown names or of the wrong size is skipped
+ * instead of read, and *rejected is set, so that the sizes in the message
+ * never decide how much is allocated.
+ */
+bool readBlobs(int fd,
+               std::vector<TensorBlob>* blobs,
+               uint32_t maxBlobs,
+               const BlobSizeFunc& blobSize = BlobSizeFunc(),
+               bool* rejected = nullptr) {
+    uint32_t numBlobs;
+    if (!readFully(fd, &numBlobs, sizeof(numBlobs)) || numBlobs > maxBlobs)
+        return false;
+    blobs->resize(numBlobs);
+    if (rejected)
+        *rejected = false;
+    for (TensorBlob& blob : *blobs) {
+        uint32_t nameSize;
+        uint64_t dataSize;
+        if (!readFully(fd, &nameSize, sizeof(nameSize)) ||
+            !readFully(fd, &dataSize, sizeof(dataSize)) ||
+            nameSize > kMaxNameSize)
+            return false;
+        blob.name.resize(nameSize);
+        if (!readFully(fd, &blob.name[0], nameSize))
+            return false;
+        if (blobSize && blobSize(blob.name) != (int64_t)dataSize) {
+            assert(rejected && "Rejected blobs must be reported!");
+            *rejected = true;
+            blob.data.clear();
+            if (!skipFully(fd, dataSize))
+                return false;
+            continue;
+        }
+        blob.data.resize(dataSize);
+        if (!readFully(fd, &blob.data[0], dataSize))
+            return false;
+    }
+    return true;
+}
+
+bool writeBlobs(int fd, const std::vector<TensorBlob>& blobs) {
+    uint32_t numBlobs = blobs.size();
+    if (!writeFully(fd, &numBlobs, sizeof(numBlobs)))
+        return false;
+    for (const TensorBlob& blob : blobs) {
+        uint32_t nameSize = blob.name.size();
+        uint64_t dataSize = blob.data.size();
+        if (!writeFully(fd, &nameSize, sizeof(nameSize)) ||
+            !writeFully(fd, &dataSize, sizeof(dataSize)) ||
+            !writeFully(fd, blob.name.data(), nameSize) ||
+            !writeFully(fd, blob.data.data(), dataSize))
+            return false;
+    }
+    return true;
+}
+
+bool makeSocketAddress(const std::string& socketPath, sockaddr_un* addr) {
+    memset(addr, 0, sizeof(*addr));
+    addr->sun_family = AF_UNIX;
+    if (socketPath.size() >= sizeof(addr->sun_path))
+        return false;
+    strcpy(addr->sun_path, socketPath.c_str());
+    return true;
+}
+
+size_t getStorageBytes(const Tensor* tensor) {
+    return (size_t)tensor->getShape().storageSize() *
+           tensor->getDataTypeSize();
+}
+
+}  // namespace
+
+void InferenceServer::start() {
+    assert(workers.empty() && "The inference server is running already!");
+    scheduler->tileNetwork();
+    sockaddr_un addr;
+    if (!makeSocketAddress(socketPath, &addr)) {
+        std::cout << socketPath << ": the socket path is too long.\n";
+        exit(1);
+    }
+    unlink(socketPath.c_str());
+    listenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0 ||
+        bind(listenFd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) <
+                0 ||
+        listen(listenFd, SOMAXCONN) < 0) {
+        std::cout << socketPath << ": cannot listen on the socket.\n";
+        exit(1);
+    }
+    std::cout << "Serving inference on " << socketPath << " with "
+              << numWorkers << " worker processes.\n";
+    // Anything buffered would be printed again by every worker.
+    std::cout.flush();
+    for (int i = 0; i < numWorkers; i++) {
+        pid_t pid = startWorker();
+        if (pid < 0) {
+            std::cout << "Failed to fork an inference worker.\n";
+            stop();
+            exit(1);
+        }
+        workers.push_back(pid);
+    }
+}
+
+pid_t InferenceServer::startWorker() {
+    pid_t pid = fork();
+    if (pid == 0) {
+        // The parent may block signals to wait for them, or handle them (as
+        // test frameworks do), but the workers must still terminate on them.
+        sigset_t noSignals;
+        sigemptyset(&noSignals);
+        sigprocmask(SIG_SETMASK, &noSignals, NULL);
+        signal(SIGINT, SIG_DFL);
+        signal(SIGTERM, SIG_DFL);
+        serveClients();
+    }
+    return pid;
+}
+
+int InferenceServer::restartWorkers() {
+    int numRestarted = 0;
+    for (int i = 0; i < workers.size(); i++) {
+        int status;
+        if (waitpid(workers[i], &status, WNOHANG) != workers[i])
+            continue;
+        std::cout << "Inference worker " << workers[i] << " "
+                  << (WIFSIGNALED(status) ? "was killed by signal "
+                                          : "exited with status ")
+                  << (WIFSIGNALED(status) ? WTERMSIG(status)
+                                          : WEXITSTATUS(status))
+                  << ", restarting it.\n";
+        std::cout.flush();
+        pid_t pid = startWorker();
+        if (pid < 0) {
+            std::cout << "Failed to fork an inference worker.\n";
+            workers.erase(workers.begin() + i);
+            stop();
+            exit(1);
+        }
+        workers[i] = pid;
+        numRestarted++;
+    }
+    return numRestarted;
+}
+
+void InferenceServer::stop() {
+    for (pid_t pid : workers)
+        kill(pid, SIGTERM);
+    for (pid_t pid : workers)
+        waitpid(pid, NULL, 0);
+    workers.clear();
+    if (listenFd >= 0) {
+        close(listenFd);
+        unlink(socketPath.c_str());
+        listenFd = -1;
+    }
+}
+
+void InferenceServer::run() {
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    sigaddset(&signals, SIGCHLD);
+    sigprocmask(SIG_BLOCK, &signals, NULL);
+    start();
+    int signal;
+    do {
+        sigwait(&signals, &signal);
+        if (signal == SIGCHLD)
+            restartWorkers();
+    } while (signal == SIGCHLD);
+    std::cout << "Stopping the inference server.\n";
+    stop();
+}
+
+void InferenceServer::serveClients() {
+    while (true) {
+        int fd = accept(listenFd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            _exit(1);
+        }
+        serveConnection(fd);
+        close(fd);
+    }
+}
+
+void InferenceServer::serveConnection(int fd) {
+    std::vector<TensorBlob> inputs;
+    auto blobSize = [this](const std::string& name) -> int64_t {
+        Tensor* tensor = workspace->getTensor(name);
+        if (!tensor || !tensor->containsData())
+            return -1;
+        return getStorageBytes(tensor);
+    };
+    bool rejected;
+    while (readBlobs(fd, &inputs, workspace->getNumTensors(), blobSize,
+                     &rejected)) {
+        if (rejected) {
+            std::cout << "Rejected a request for a tensor that does not "
+                         "exist or has a different size.\n";
+        }
+        if (!writeBlobs(fd, rejected ? std::vector<TensorBlob>()
+                                     : runRequest(inputs)))
+            return;
+    }
+}
+
+std::vector<TensorBlob> InferenceServer::runRequest(
+        const std::vector<TensorBlob>& inputs) {
+    for (const TensorBlob& input : inputs) {
+        Tensor* tensor = workspace->getTensor(input.name);
+        memcpy(const_cast<void*>(tensor->rawData()), input.data.data(),
+               input.data.size());
+        tensor->markDataChanged();
+    }
+    Tensor* output = scheduler->executeNetwork();
+    TensorBlob result;
+    result.name = output->getName();
+    result.data.assign(reinterpret_cast<const char*>(output->rawData()),
+                       getStorageBytes(output));
+    return { result };
+}
+
+InferenceClient::InferenceClient(const std::string& socketPath) {
+    sockaddr_un addr;
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (!makeSocketAddress(socketPath, &addr) || fd < 0 ||
+        connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0) {
+        std::cout << socketPath
+                  << ": cannot connect to the inference server.\n";
+        exit(1);
+    }
+}
+
+InferenceClient::~InferenceClient() { close(fd); }
+
+std::vector<TensorBlob> InferenceClient::infer(
+        const std::vector<TensorBlob>& inputs) {
+    std::vector<TensorBlob> outputs;
+    // The server replies with the network output only.
+    if (!writeBlobs(fd, inputs) || !readBlobs(fd, &outputs, 1)) {
+        std::cout << "Lost the connection to the inference server.\n";
+        exit(1);
+    }
+    return outputs;
+}
+
+}  // namespace smaug
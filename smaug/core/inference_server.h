@@ -0,0 +1,131 @@
+#ifndef _CORE_INFERENCE_SERVER_H_
+#define _CORE_INFERENCE_SERVER_H_
+
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+#include "smaug/core/scheduler.h"
+#include "smaug/core/workspace.h"
+
+namespace smaug {
+
+/**
+ * The raw storage of a named Tensor, exactly as the Tensor stores it
+ * (including any alignment padding), as sent over the inference socket.
+ */
+struct TensorBlob {
+    std::string name;
+    std::string data;
+};
+
+/**
+ * InferenceServer serves a Network to local clients from a set of worker
+ * processes.
+ *
+ * The Network is loaded and tiled once, and then the workers are forked off,
+ * so they share all of its memory copy-on-write instead of building it again.
+ * Weights are never written, so they stay shared: with a network image, they
+ * are pages of the mapped file, shared by every worker through the page
+ * cache. Each worker only gets private copies of the activations it writes.
+ *
+ * All the workers accept connections on the same Unix domain socket, so each
+ * connection is served by one worker, and concurrent clients are served in
+ * parallel. On a connection, every request is a list of TensorBlobs to fill
+ * Tensors of the Workspace with (usually the network inputs). The worker
+ * then runs the Network and replies with the output Tensor, or with an empty
+ * list if the request names a Tensor that does not exist or has a different
+ * size. A request of more blobs than there are Tensors is taken as corrupted,
+ * and its connection is closed.
+ *
+ * The Network must not have run in this process before the workers are
+ * started, since worker threads (of the thread pool, for example) do not
+ * survive the fork. Each worker starts its own on its first request.
+ */
+class InferenceServer {
+   public:
+    /**
+     * Create a server for the Network of the given Scheduler. The server does
+     * not take ownership of the Scheduler or the Workspace.
+     */
+    InferenceServer(Scheduler* _scheduler,
+                    Workspace* _workspace,
+                    const std::string& _socketPath,
+                    int _numWorkers)
+            : scheduler(_scheduler), workspace(_workspace),
+              socketPath(_socketPath), numWorkers(_numWorkers),
+              listenFd(-1) {}
+    ~InferenceServer() { stop(); }
+
+    /**
+     * Tiles the Network, listens on the socket (replacing any stale socket
+     * file), and forks the workers. Exits on errors.
+     */
+    void start();
+
+    /** Terminates the workers and removes the socket. */
+    void stop();
+
+    /**
+     * Starts the server and serves until this process receives SIGINT or
+     * SIGTERM, then stops it. Workers that die are restarted.
+     */
+    void run();
+
+    /**
+     * Reaps the workers that have exited and forks new ones in their place.
+     * Returns the number of workers restarted.
+     */
+    int restartWorkers();
+
+    const std::vector<pid_t>& getWorkers() const { return workers; }
+
+   protected:
+    /** Forks a worker process and returns its pid, or -1 on errors. */
+    pid_t startWorker();
+
+    /** The loop of a worker process, which never returns. */
+    void serveClients();
+
+    /** Serves the requests of one connection until the client hangs up. */
+    void serveConnection(int fd);
+
+    /**
+     * Fills the Tensors of a request, whose blobs have already been checked
+     * against them, and runs the Network.
+     */
+    std::vector<TensorBlob> runRequest(const std::vector<TensorBlob>& inputs);
+
+    Scheduler* scheduler;
+    Workspace* workspace;
+    std::string socketPath;
+    int numWorkers;
+    int listenFd;
+    std::vector<pid_t> workers;
+};
+
+/**
+ * InferenceClient is a client of an InferenceServer, for local use and
+ * testing. Each client has a connection of its own, so clients on different
+ * threads are served in parallel.
+ */
+class InferenceClient {
+   public:
+    /** Connects to the server socket. Exits on errors. */
+    InferenceClient(const std::string& socketPath);
+    ~InferenceClient();
+
+    /**
+     * Sends the Tensors to fill and returns the network output, or an empty
+     * list if the server rejected the request. Exits if the connection
+     * fails.
+     */
+    std::vector<TensorBlob> infer(const std::vector<TensorBlob>& inputs);
+
+   protected:
+    int fd;
+};
+
+}  // namespace smaug
+
+#endif
@@ -0,0 +1,236 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+#include "catch.hpp"
+#include "smaug/core/backend.h"
+#include "smaug/core/inference_server.h"
+#include "smaug/core/scheduler.h"
+#include "smaug/core/smaug_test.h"
+#include "smaug/core/tensor.h"
+#include "smaug/operators/data_op.h"
+#include "smaug/operators/relu_op.h"
+#include "smaug/operators/smv/smv_convolution_op.h"
+#include "smaug/operators/smv/smv_test_common.h"
+
+using namespace smaug;
+
+namespace {
+
+TensorBlob makeBlob(const std::string& name, const std::vector<float>& values) {
+    TensorBlob blob;
+    blob.name = name;
+    blob.data.assign(reinterpret_cast<const char*>(values.data()),
+                     values.size() * sizeof(float));
+    return blob;
+}
+
+/** Returns a blob of the storage of the Tensor. */
+TensorBlob makeBlob(const Tensor* tensor) {
+    TensorBlob blob;
+    blob.name = tensor->getName();
+    blob.data.assign(reinterpret_cast<const char*>(tensor->rawData()),
+                     (size_t)tensor->getShape().storageSize() *
+                             tensor->getDataTypeSize());
+    return blob;
+}
+
+std::vector<float> blobValues(const TensorBlob& blob) {
+    const float* data = reinterpret_cast<const float*>(blob.data.data());
+    return std::vector<float>(data, data + blob.data.size() / sizeof(float));
+}
+
+/**
+ * Sends the raw bytes of a request to the server, hangs up the sending side,
+ * and returns the number of bytes of the reply.
+ */
+size_t sendRawRequest(const std::string& socketPath, const std::string& bytes) {
+    sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, socketPath.c_str());
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    REQUIRE(fd >= 0);
+    REQUIRE(connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) ==
+            0);
+    REQUIRE(send(fd, bytes.data(), bytes.size(), MSG_NOSIGNAL) ==
+            bytes.size());
+    shutdown(fd, SHUT_WR);
+    size_t replySize = 0;
+    char buf[256];
+    ssize_t count;
+    while ((count = recv(fd, buf, sizeof(buf), 0)) > 0)
+        replySize += count;
+    close(fd);
+    return replySize;
+}
+
+template <typename T>
+void appendValue(std::string* bytes, T value) {
+    bytes->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool isRunning(pid_t pid) { return waitpid(pid, NULL, WNOHANG) == 0; }
+
+}  // namespace
+
+TEST_CASE_METHOD(SmaugTest, "Inference server", "[inferenceserver]") {
+    // input --> relu
+    TensorShape shape({ 1, 8 }, DataLayout::NC);
+    Tensor* input = workspace()->addTensor(new Tensor("input", shape));
+    input->allocateStorage<float>();
+    auto inputOp = new DataOp<ReferenceBackend>("input", workspace());
+    inputOp->setData(input);
+    auto relu = new ReluOp<ReferenceBackend>("relu", workspace());
+    relu->setInput(input, 0);
+    relu->createAllTensors();
+    relu->getOutput(0)->allocateStorage<float>();
+    Network* net = network();
+    net->addOperator(inputOp);
+    net->addOperator(relu);
+    net->addEdge(inputOp, relu, { 0, 0 });
+
+    TempDir tempDir;
+    std::string socketPath = tempDir.file("server.sock");
+    Scheduler scheduler(net, workspace());
+    InferenceServer server(&scheduler, workspace(), socketPath, 2);
+    server.start();
+    REQUIRE(server.getWorkers().size() == 2);
+
+    SECTION("Every request is answered with the network output") {
+        // Each client has a connection, and so a worker, of its own.
+        InferenceClient client(socketPath);
+        InferenceClient client2(socketPath);
+        for (int i = 0; i < 4; i++) {
+            InferenceClient& current = i % 2 ? client2 : client;
+            std::vector<float> inputValues;
+            std::vector<float> expected;
+            for (int j = 0; j < 8; j++) {
+                inputValues.push_back(j - 4 + i);
+                expected.push_back(std::max(j - 4 + i, 0));
+            }
+            std::vector<TensorBlob> outputs =
+                    current.infer({ makeBlob("input", inputValues) });
+            REQUIRE(outputs.size() == 1);
+            REQUIRE(outputs[0].name == "relu");
+            REQUIRE(blobValues(outputs[0]) == expected);
+        }
+    }
+
+    SECTION("Requests for unknown or mismatched tensors are rejected") {
+        InferenceClient client(socketPath);
+        REQUIRE(client.infer({ makeBlob("weights", { 1, 2 }) }).empty());
+        REQUIRE(client.infer({ makeBlob("input", { 1, 2 }) }).empty());
+        // The connection stays usable.
+        std::vector<TensorBlob> outputs = client.infer(
+                { makeBlob("input", { -1, 1, -2, 2, -3, 3, -4, 4 }) });
+        REQUIRE(outputs.size() == 1);
+        REQUIRE(blobValues(outputs[0]) ==
+                std::vector<float>{ 0, 1, 0, 2, 0, 3, 0, 4 });
+    }
+
+    SECTION("Malformed requests do not kill the workers") {
+        // More blobs than there are tensors.
+        std::string tooManyBlobs;
+        appendValue<uint32_t>(&tooManyBlobs, 0xffffffff);
+        REQUIRE(sendRawRequest(socketPath, tooManyBlobs) == 0);
+        // A blob far larger than its tensor, whose data never comes.
+        std::string hugeBlob;
+        appendValue<uint32_t>(&hugeBlob, 1);
+        appendValue<uint32_t>(&hugeBlob, 5);
+        appendValue<uint64_t>(&hugeBlob, uint64_t(1) << 62);
+        hugeBlob += "input";
+        REQUIRE(sendRawRequest(socketPath, hugeBlob) == 0);
+
+        InferenceClient client(socketPath);
+        REQUIRE(client.infer({ makeBlob("input", std::vector<float>(8, 1)) })
+                        .size() == 1);
+        for (pid_t pid : server.getWorkers())
+            REQUIRE(isRunning(pid));
+    }
+
+    SECTION("Dead workers are restarted") {
+        pid_t deadWorker = server.getWorkers()[0];
+        kill(deadWorker, SIGKILL);
+        int numRestarted = 0;
+        for (int i = 0; i < 5000 && numRestarted == 0; i++) {
+            numRestarted = server.restartWorkers();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(numRestarted == 1);
+        REQUIRE(server.getWorkers().size() == 2);
+        REQUIRE(server.getWorkers()[0] != deadWorker);
+        for (pid_t pid : server.getWorkers())
+            REQUIRE(isRunning(pid));
+        InferenceClient client(socketPath);
+        InferenceClient client2(socketPath);
+        REQUIRE(client.infer({ makeBlob("input", std::vector<float>(8, 1)) })
+                        .size() == 1);
+        REQUIRE(client2.infer({ makeBlob("input", std::vector<float>(8, 1)) })
+                        .size() == 1);
+    }
+
+    server.stop();
+    REQUIRE(server.getWorkers().empty());
+    REQUIRE(access(socketPath.c_str(), F_OK) != 0);
+}
+
+TEST_CASE_METHOD(SmaugTest, "SMV inference server", "[inferenceserver]") {
+    // input --> conv, with the inputs tiled channelwise, so that the input
+    // tiles are copies rather than views of the input.
+    TensorShape inputShape(
+            { 1, 16, 16, 256 }, DataLayout::NHWC, SmvBackend::Alignment);
+    Tensor* input = workspace()->addTensor(new Tensor("input", inputShape));
+    input->allocateStorage<float16>();
+    auto conv = new SmvConvolutionOp("conv", workspace());
+    conv->setStride(1, 1);
+    conv->setPadding(SamePadding);
+    conv->setInput(input, 0);
+    conv->setWeightDims(5, 5, 8);
+    createAndFillTensorsWithData<float16>(conv, fillTensorWithRandomData);
+    auto inputOp = new DataOp<SmvBackend>("input", workspace());
+    inputOp->setData(input);
+    Tensor* weights = conv->getInput(1);
+    auto weightsOp = new DataOp<SmvBackend>(weights->getName(), workspace());
+    weightsOp->setData(weights);
+    Network* net = network();
+    net->addOperator(inputOp);
+    net->addOperator(weightsOp);
+    net->addOperator(conv);
+    net->addEdge(inputOp, conv, { 0, 0 });
+    net->addEdge(weightsOp, conv, { 0, 1 });
+
+    // Two inputs, one the negative of the other.
+    TensorBlob request = makeBlob(input);
+    TensorBlob request2 = request;
+    float16* request2Data = reinterpret_cast<float16*>(&request2.data[0]);
+    for (int i = 0; i < inputShape.storageSize(); i++)
+        request2Data[i] ^= 0x8000;
+
+    TempDir tempDir;
+    std::string socketPath = tempDir.file("server.sock");
+    Scheduler scheduler(net, workspace());
+    InferenceServer server(&scheduler, workspace(), socketPath, 1);
+    server.start();
+
+    SECTION("Every request runs on its own inputs") {
+        InferenceClient client(socketPath);
+        std::vector<TensorBlob> outputs = client.infer({ request });
+        std::vector<TensorBlob> outputs2 = client.infer({ request2 });
+        std::vector<TensorBlob> outputs3 = client.infer({ request });
+        REQUIRE(outputs.size() == 1);
+        REQUIRE(outputs2.size() == 1);
+        REQUIRE(outputs3.size() == 1);
+        bool sameOutputs = outputs2[0].data == outputs[0].data;
+        REQUIRE(!sameOutputs);
+        bool repeatedOutputs = outputs3[0].data == outputs[0].data;
+        REQUIRE(repeatedOutputs);
+    }
+
+    server.stop();
+}
@@ -66,6 +66,10 @@ class Network {
     }
     SamplingInfo& getSamplingInfo() { return sampling; }
 
+    /** Set the name of the backend that the operators were created for. */
+    void setBackend(const std::string& _backend) { backend = _backend; }
+    const std::string& getBackend() const { return backend; }
+
    protected:
     struct OperatorInsertion {
         Operator* newOp;
@@ -84,6 +88,9 @@ class Network {
 
     /** Name of the model. */
     std::string name;
+
+    /** Name of the backend of the operators, empty if it is not known. */
+    std::string backend;
 };
 
 }  // namespace smaug
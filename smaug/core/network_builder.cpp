@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <cmath>
 #include <fcntl.h>
 #include <fstream>
 #include <iostream>
+#include <map>
 
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <google/protobuf/text_format.h>
@@ -51,6 +54,7 @@
 #include "smaug/operators/split_op.h"
 #include "smaug/operators/tanh_op.h"
 #include "smaug/utility/debug_stream.h"
+#include "smaug/utility/fp16_convert.h"
 #include "smaug/utility/utils.h"
 
 using namespace smaug;
@@ -99,7 +103,7 @@ ActivationInfo getActivationInfo(const ActivationParams& params) {
 // network.
 template <typename Backend>
 static void createAndAddOperator(const NodeProto& node,
-                                 const TensorDataArray& tensorDataArray,
+                                 const DataTensorFactory& createDataTensor,
                                  HostMemoryAccessPolicy memPolicy,
                                  Network* network,
                                  Workspace* workspace) {
@@ -109,17 +113,8 @@ static void createAndAddOperator(const NodeProto& node,
     dout(0) << "Adding " << name << " (" << OpType_Name(type) << ").\n";
 
     if (type == OpType::Data) {
-        // Find the tensor data from the tensor data array.
-        TensorData tensorData;
-        for (int i = 0; i < tensorDataArray.data_array_size(); i++) {
-            if (tensorDataArray.data_array(i).name() ==
-                node.input_tensors(0).name()) {
-                tensorData = tensorDataArray.data_array(i);
-                break;
-            }
-        }
-        auto inputTensor = workspace->addTensor(
-                new Tensor(node.input_tensors(0), tensorData));
+        auto inputTensor =
+                workspace->addTensor(createDataTensor(node.input_tensors(0)));
         auto inputTensorOp = Backend::createDataOp(name, workspace);
         inputTensorOp->setData(inputTensor);
         network->addOperator(inputTensorOp);
@@ -315,16 +310,18 @@ static void createAndAddOperator(const NodeProto& node,
 // Create the network by deserializing the graph stored in the
 // protobuf model.
 template <typename Backend>
-static Network* createNetworkFromProto(const GraphProto& graphProto,
-                                       const TensorDataArray& tensorDataArray,
-                                       SamplingInfo& sampling,
-                                       Workspace* workspace) {
+static Network* createNetworkFromProto(
+        const GraphProto& graphProto,
+        const DataTensorFactory& createDataTensor,
+        SamplingInfo& sampling,
+        Workspace* workspace) {
     Network* network = new Network(graphProto.name());
     network->setSamplingInfo(sampling);
+    network->setBackend(Backend::Name);
     for (int i = 0; i < graphProto.nodes_size(); i++) {
         const NodeProto& node = graphProto.nodes(i);
         createAndAddOperator<Backend>(node,
-                                      tensorDataArray,
+                                      createDataTensor,
                                       graphProto.mem_policy(),
                                       network,
                                       workspace);
@@ -367,43 +364,137 @@ static Network* createNetworkFromProto(const GraphProto& graphProto,
     return network;
 }
 
-Network* smaug::buildNetwork(const std::string& modelTopo,
-                             const std::string& modelParams,
-                             SamplingInfo& sampling,
-                             Workspace* workspace) {
+void smaug::parseModelTopo(const std::string& modelTopo, GraphProto* graph) {
     // Parse the network topology from the protobuf text file.
-    GraphProto graph;
     int modelTopoDescriptor = open(modelTopo.c_str(), O_RDONLY);
     if (modelTopoDescriptor < 0) {
         cout << modelTopo << ": network topology file not found." << endl;
         exit(1);
     }
     google::protobuf::io::FileInputStream modelTopoInput(modelTopoDescriptor);
-    if (!google::protobuf::TextFormat::Parse(&modelTopoInput, &graph)) {
+    if (!google::protobuf::TextFormat::Parse(&modelTopoInput, graph)) {
         cout << "Failed to parse the network topology file!" << endl;
         exit(1);
     }
+}
+
+void smaug::parseModelParams(const std::string& modelParams,
+                             TensorDataArray* tensorDataArray) {
     // Parse the network parameters from the protobuf binary file.
-    TensorDataArray tensorDataArray;
     fstream modelParamsFile(modelParams, ios::in | ios::binary);
     if (!modelParamsFile) {
         cout << modelParams << ": network parameters file not found." << endl;
         exit(1);
-    } else if (!tensorDataArray.ParseFromIstream(&modelParamsFile)) {
+    } else if (!tensorDataArray->ParseFromIstream(&modelParamsFile)) {
         cout << "Failed to parse the network parameters file.\n";
         exit(1);
     }
+}
+
+// Replaces the Float32 data of a Float16 tensor with its half-precision
+// conversion, packed two to an int32 and zero padded up to the storage size.
+// Returns the number of finite values too large for Float16, which become
+// infinite.
+static int convertTensorDataToFp16(const TensorProto& tensorProto,
+                                   TensorData* tensorData) {
+    int numElems = tensorData->float_data_size();
+    int storageSize = TensorShape(tensorProto.shape()).storageSize();
+    auto halfData = tensorData->mutable_half_data();
+    halfData->Clear();
+    halfData->Resize(FRAC_CEIL(std::max(numElems, storageSize), 2), 0);
+    float16* dst = reinterpret_cast<float16*>(halfData->mutable_data());
+    const float* src = tensorData->float_data().data();
+    convertFp32ToFp16(dst, src, numElems);
+    int numOverflowed = 0;
+    for (int i = 0; i < numElems; i++) {
+        // Infinity has all exponent bits set and a zero mantissa.
+        if ((dst[i] & 0x7fff) == 0x7c00 && std::isfinite(src[i]))
+            numOverflowed++;
+    }
+    tensorData->clear_float_data();
+    return numOverflowed;
+}
+
+int smaug::convertSmvGraphToFp16(GraphProto* graph,
+                                 TensorDataArray* tensorDataArray) {
+    if (graph->backend() != SmvBackend::Name)
+        return 0;
+    std::map<std::string, TensorData*> tensorDataByName;
+    for (TensorData& tensorData : *tensorDataArray->mutable_data_array())
+        tensorDataByName[tensorData.name()] = &tensorData;
+    int numConverted = 0;
+    int numOverflowed = 0;
+    for (NodeProto& node : *graph->mutable_nodes()) {
+        for (TensorProto& tensorProto : *node.mutable_input_tensors()) {
+            if (tensorProto.data_type() == Float32)
+                tensorProto.set_data_type(Float16);
+        }
+        for (TensorProto& tensorProto : *node.mutable_output_tensors()) {
+            if (tensorProto.data_type() == Float32)
+                tensorProto.set_data_type(Float16);
+        }
+        if (node.op() != OpType::Data)
+            continue;
+        const TensorProto& tensorProto = node.input_tensors(0);
+        auto tensorData = tensorDataByName.find(tensorProto.name());
+        if (tensorProto.data_type() != Float16 ||
+            tensorData == tensorDataByName.end() ||
+            tensorData->second->float_data_size() == 0)
+            continue;
+        int tensorOverflowed =
+                convertTensorDataToFp16(tensorProto, tensorData->second);
+        if (tensorOverflowed > 0) {
+            cout << "Warning: " << tensorOverflowed << " values of "
+                 << tensorProto.name()
+                 << " exceed the Float16 range and became infinite.\n";
+        }
+        numOverflowed += tensorOverflowed;
+        numConverted++;
+    }
+    if (numConverted > 0) {
+        cout << "Converted " << numConverted
+             << " Float32 parameter tensors to Float16 for the SMV backend.\n";
+    }
+    return numOverflowed;
+}
+
+Network* smaug::buildNetwork(const std::string& modelTopo,
+                             const std::string& modelParams,
+                             SamplingInfo& sampling,
+                             Workspace* workspace) {
+    GraphProto graph;
+    parseModelTopo(modelTopo, &graph);
+    TensorDataArray tensorDataArray;
+    parseModelParams(modelParams, &tensorDataArray);
+    convertSmvGraphToFp16(&graph, &tensorDataArray);
+    std::map<std::string, const TensorData*> tensorDataByName;
+    for (const TensorData& tensorData : tensorDataArray.data_array())
+        tensorDataByName[tensorData.name()] = &tensorData;
+    auto createDataTensor = [&](const TensorProto& tensorProto) {
+        // Find the tensor data from the tensor data array.
+        auto tensorData = tensorDataByName.find(tensorProto.name());
+        return new Tensor(tensorProto,
+                          tensorData != tensorDataByName.end()
+                                  ? *tensorData->second
+                                  : TensorData());
+    };
+    return buildNetwork(graph, createDataTensor, sampling, workspace);
+}
 
+Network* smaug::buildNetwork(const GraphProto& graph,
+                             const DataTensorFactory& createDataTensor,
+                             SamplingInfo& sampling,
+                             Workspace* workspace) {
     cout << "======================================================\n";
     cout << "      Loading the network model...\n";
     cout << "======================================================\n";
     Network* network = nullptr;
     if (graph.backend() == ReferenceBackend::Name) {
         network = createNetworkFromProto<ReferenceBackend>(
-                graph, tensorDataArray, sampling, workspace);
+                graph, createDataTensor, sampling, workspace);
     } else if (graph.backend() == SmvBackend::Name) {
         network = createNetworkFromProto<SmvBackend>(
-                graph, tensorDataArray, sampling, workspace);
+                graph, createDataTensor, sampling, workspace);
     } else {
         assert(false && "Unknown backend!");
     }
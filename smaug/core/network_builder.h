@@ -1,8 +1,11 @@
 #ifndef _CORE_NETWORK_BUILDER_H_
 #define _CORE_NETWORK_BUILDER_H_
 
+#include <functional>
 #include <string>
 
+#include "smaug/core/graph.pb.h"
+#include "smaug/core/tensor.pb.h"
 #include "smaug/core/workspace.h"
 #include "smaug/core/network.h"
 #include "smaug/operators/common.h"
@@ -25,6 +28,44 @@ Network* buildNetwork(const std::string& modelTopoFile,
                       const std::string& modelParamsFile,
                       SamplingInfo& sampling,
                       Workspace* workspace);
+
+/**
+ * Creates the Tensor exposed by a Data operator, with its data, from the
+ * TensorProto that describes it.
+ */
+typedef std::function<Tensor*(const TensorProto&)> DataTensorFactory;
+
+/**
+ * Builds a Network from an already parsed model topology, getting the Tensors
+ * of the Data operators from createDataTensor.
+ */
+Network* buildNetwork(const GraphProto& graph,
+                      const DataTensorFactory& createDataTensor,
+                      SamplingInfo& sampling,
+                      Workspace* workspace);
+
+/** Parses a model topology protobuf text file, exiting on errors. */
+void parseModelTopo(const std::string& modelTopoFile, GraphProto* graph);
+
+/** Parses a model parameters protobuf binary file, exiting on errors. */
+void parseModelParams(const std::string& modelParamsFile,
+                      TensorDataArray* tensorDataArray);
+
+/**
+ * SMV operators only work on Float16 data. For an SMV graph, this changes
+ * every Float32 tensor of the topology to Float16, and converts the Float32
+ * data of its Data tensors to Float16, so that models can be exported in full
+ * precision regardless of the backend. Large tensors are converted in
+ * parallel. Graphs of other backends are left as they are.
+ *
+ * Values beyond the Float16 range become infinite, with a warning. Returns
+ * the number of such values.
+ *
+ * buildNetwork() and writeNetworkImage() call this, so compiling a model into
+ * a network image caches the converted parameters on disk.
+ */
+int convertSmvGraphToFp16(GraphProto* graph, TensorDataArray* tensorDataArray);
+
 }  // namespace smaug
 
 #endif
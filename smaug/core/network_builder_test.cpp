@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+
+#include <google/protobuf/text_format.h>
+
+#include "catch.hpp"
+#include "smaug/core/backend.h"
+#include "smaug/core/graph.pb.h"
+#include "smaug/core/network_builder.h"
+#include "smaug/core/network_image.h"
+#include "smaug/core/scheduler.h"
+#include "smaug/core/smaug_test.h"
+#include "smaug/core/tensor.h"
+#include "smaug/core/tensor.pb.h"
+
+using namespace smaug;
+
+namespace {
+
+void addTensorProto(NodeProto* node,
+                    bool isInput,
+                    const std::string& name,
+                    DataType dataType) {
+    TensorProto* tensorProto =
+            isInput ? node->add_input_tensors() : node->add_output_tensors();
+    tensorProto->set_name(name);
+    tensorProto->set_data_type(dataType);
+    tensorProto->set_data_format(Uncompressed);
+    TensorShapeProto* shape = tensorProto->mutable_shape();
+    shape->add_dims(1);
+    shape->add_dims(5);
+    shape->set_layout(NC);
+    shape->set_alignment(8);
+}
+
+/** input --> relu, exported with the given backend and data type. */
+GraphProto makeGraph(const std::string& backend,
+                     DataType dataType = Float32) {
+    GraphProto graph;
+    graph.set_name("builder_test");
+    graph.set_backend(backend);
+    graph.set_mem_policy(AllDma);
+    NodeProto* inputNode = graph.add_nodes();
+    inputNode->set_name("input");
+    inputNode->set_op(OpType::Data);
+    addTensorProto(inputNode, true, "input", dataType);
+    addTensorProto(inputNode, false, "input", dataType);
+    NodeProto* reluNode = graph.add_nodes();
+    reluNode->set_name("relu");
+    reluNode->set_op(OpType::ReLU);
+    reluNode->add_parents("input");
+    reluNode->add_src_tensors_indices(0);
+    addTensorProto(reluNode, true, "input", dataType);
+    addTensorProto(reluNode, false, "relu", dataType);
+    return graph;
+}
+
+void writeModel(const GraphProto& graph,
+                const TensorDataArray& tensorDataArray,
+                const std::string& topoFile,
+                const std::string& paramsFile) {
+    std::string topoText;
+    google::protobuf::TextFormat::PrintToString(graph, &topoText);
+    std::ofstream(topoFile) << topoText;
+    std::ofstream params(paramsFile, std::ios::out | std::ios::binary);
+    tensorDataArray.SerializeToOstream(&params);
+}
+
+/** Builds the model, or loads it from the image, and runs it. */
+std::vector<float16> runModel(const std::string& topoFile,
+                              const std::string& paramsFile,
+                              const std::string& imageFile) {
+    Workspace workspace;
+    SamplingInfo sampling = { NoSampling, 1 };
+    Network* network =
+            imageFile.empty()
+                    ? smaug::buildNetwork(
+                              topoFile, paramsFile, sampling, &workspace)
+                    : loadNetworkImage(imageFile, sampling, &workspace);
+    REQUIRE(workspace.getTensor("input")->getDataType() == Float16);
+    Scheduler scheduler(network, &workspace);
+    Tensor* output = scheduler.runNetwork();
+    const float16* outputPtr = output->data<float16>();
+    std::vector<float16> outputs(
+            outputPtr, outputPtr + output->getShape().storageSize());
+    delete network;
+    return outputs;
+}
+
+}  // namespace
+
+TEST_CASE_METHOD(SmaugTest, "Float32 parameters of SMV graphs", "[builder]") {
+    // The exported data is padded to the alignment of the last dimension.
+    std::vector<float> inputValues{ -1.5, 2.25, -3, 4.1, 1000, 0, 0, 0 };
+    TensorDataArray tensorDataArray;
+    TensorData* inputData = tensorDataArray.add_data_array();
+    inputData->set_name("input");
+    for (float value : inputValues)
+        inputData->add_float_data(value);
+
+    SECTION("SMV graphs are converted to Float16") {
+        GraphProto graph = makeGraph(SmvBackend::Name);
+        TensorDataArray converted = tensorDataArray;
+        REQUIRE(convertSmvGraphToFp16(&graph, &converted) == 0);
+        for (const NodeProto& node : graph.nodes()) {
+            for (const TensorProto& tensorProto : node.input_tensors())
+                REQUIRE(tensorProto.data_type() == Float16);
+            for (const TensorProto& tensorProto : node.output_tensors())
+                REQUIRE(tensorProto.data_type() == Float16);
+        }
+        const TensorData& data = converted.data_array(0);
+        REQUIRE(data.float_data_size() == 0);
+        REQUIRE(data.half_data_size() == inputValues.size() / 2);
+        const float16* halfData =
+                reinterpret_cast<const float16*>(data.half_data().data());
+        for (int i = 0; i < inputValues.size(); i++)
+            REQUIRE(halfData[i] == fp16(inputValues[i]));
+    }
+
+    SECTION("Values beyond the Float16 range are counted") {
+        GraphProto graph = makeGraph(SmvBackend::Name);
+        TensorDataArray converted = tensorDataArray;
+        TensorData* data = converted.mutable_data_array(0);
+        data->set_float_data(1, 65536);
+        data->set_float_data(2, -1e10);
+        data->set_float_data(3, INFINITY);
+        REQUIRE(convertSmvGraphToFp16(&graph, &converted) == 2);
+        const float16* halfData =
+                reinterpret_cast<const float16*>(data->half_data().data());
+        REQUIRE(fp32(halfData[1]) == INFINITY);
+        REQUIRE(fp32(halfData[2]) == -INFINITY);
+        REQUIRE(fp32(halfData[3]) == INFINITY);
+    }
+
+    SECTION("Other graphs are left as they are") {
+        GraphProto graph = makeGraph(ReferenceBackend::Name);
+        TensorDataArray converted = tensorDataArray;
+        REQUIRE(convertSmvGraphToFp16(&graph, &converted) == 0);
+        REQUIRE(graph.nodes(1).output_tensors(0).data_type() == Float32);
+        REQUIRE(converted.data_array(0).float_data_size() ==
+                inputValues.size());
+        REQUIRE(converted.data_array(0).half_data_size() == 0);
+    }
+
+    SECTION("Networks run as if they were exported in Float16") {
+        // The same model, exported with Float16 parameters.
+        TensorDataArray fp16DataArray;
+        TensorData* fp16Data = fp16DataArray.add_data_array();
+        fp16Data->set_name("input");
+        for (int i = 0; i < inputValues.size(); i += 2) {
+            fp16Data->add_half_data(fp16(inputValues[i]) |
+                                    (fp16(inputValues[i + 1]) << 16));
+        }
+
+        TempDir tempDir;
+        std::string fp32Topo = tempDir.file("fp32_topo.pbtxt");
+        std::string fp32Params = tempDir.file("fp32_params.pb");
+        std::string fp32Image = tempDir.file("fp32.img");
+        std::string fp16Topo = tempDir.file("fp16_topo.pbtxt");
+        std::string fp16Params = tempDir.file("fp16_params.pb");
+        writeModel(makeGraph(SmvBackend::Name), tensorDataArray, fp32Topo,
+                   fp32Params);
+        writeModel(makeGraph(SmvBackend::Name, Float16), fp16DataArray,
+                   fp16Topo, fp16Params);
+        writeNetworkImage(fp32Topo, fp32Params, fp32Image);
+
+        std::vector<float16> expected = runModel(fp16Topo, fp16Params, "");
+        REQUIRE(expected.size() == inputValues.size());
+        for (int i = 0; i < 5; i++)
+            REQUIRE(expected[i] == fp16(std::max(inputValues[i], 0.0f)));
+        REQUIRE(runModel(fp32Topo, fp32Params, "") == expected);
+        REQUIRE(runModel(fp32Topo, fp32Params, fp32Image) == expected);
+    }
+}
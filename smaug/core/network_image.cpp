@@ -0,0 +1,224 @@
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "smaug/core/graph.pb.h"
+#include "smaug/core/network_builder.h"
+#include "smaug/core/network_image.h"
+#include "smaug/core/tensor.h"
+#include "smaug/core/tensor.pb.h"
+
+namespace smaug {
+
+namespace {
+
+constexpr char kImageMagic[8] = { 'S', 'M', 'A', 'U', 'G', 'I', 'M', 'G' };
+constexpr uint32_t kImageVersion = 1;
+/** Tensor data is aligned to pages, so that it can be mapped directly. */
+constexpr uint64_t kImageAlignment = 4096;
+
+/** The header at the start of every network image. */
+struct ImageHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t numTensors;
+    /** The binary GraphProto. */
+    uint64_t graphOffset;
+    uint64_t graphSize;
+    /** A TensorEntry and the tensor name for every Data tensor. */
+    uint64_t indexOffset;
+};
+
+/** The index entry of a Data tensor, followed by nameSize bytes of name. */
+struct TensorEntry {
+    uint64_t dataOffset;
+    uint64_t dataSize;
+    uint32_t nameSize;
+};
+
+uint64_t alignUp(uint64_t offset) {
+    return (offset + kImageAlignment - 1) / kImageAlignment * kImageAlignment;
+}
+
+/**
+ * Returns true if size bytes at offset are within a file of fileSize bytes,
+ * without overflowing on corrupted offsets and sizes.
+ */
+bool fitsInImage(uint64_t offset, uint64_t size, uint64_t fileSize) {
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+}  // namespace
+
+void writeNetworkImage(const std::string& modelTopoFile,
+                       const std::string& modelParamsFile,
+                       const std::string& imageFile) {
+    GraphProto graph;
+    parseModelTopo(modelTopoFile, &graph);
+    TensorDataArray tensorDataArray;
+    parseModelParams(modelParamsFile, &tensorDataArray);
+    convertSmvGraphToFp16(&graph, &tensorDataArray);
+    std::map<std::string, const TensorData*> tensorDataByName;
+    for (const TensorData& tensorData : tensorDataArray.data_array())
+        tensorDataByName[tensorData.name()] = &tensorData;
+
+    // Build the Data tensors just like the network builder does, so that
+    // their storage is final.
+    std::vector<std::unique_ptr<Tensor>> tensors;
+    for (const NodeProto& node : graph.nodes()) {
+        if (node.op() != OpType::Data)
+            continue;
+        const TensorProto& tensorProto = node.input_tensors(0);
+        auto tensorData = tensorDataByName.find(tensorProto.name());
+        tensors.emplace_back(new Tensor(tensorProto,
+                                        tensorData != tensorDataByName.end()
+                                                ? *tensorData->second
+                                                : TensorData()));
+    }
+
+    std::string graphBytes;
+    graph.SerializeToString(&graphBytes);
+    ImageHeader header;
+    memcpy(header.magic, kImageMagic, sizeof(kImageMagic));
+    header.version = kImageVersion;
+    header.numTensors = tensors.size();
+    header.graphOffset = sizeof(ImageHeader);
+    header.graphSize = graphBytes.size();
+    header.indexOffset = header.graphOffset + header.graphSize;
+    uint64_t dataOffset = header.indexOffset;
+    for (auto& tensor : tensors)
+        dataOffset += sizeof(TensorEntry) + tensor->getName().size();
+    std::string index;
+    std::vector<TensorEntry> entries;
+    for (auto& tensor : tensors) {
+        dataOffset = alignUp(dataOffset);
+        TensorEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        entry.dataOffset = dataOffset;
+        entry.dataSize = (uint64_t)tensor->getShape().storageSize() *
+                         tensor->getDataTypeSize();
+        entry.nameSize = tensor->getName().size();
+        index.append(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        index.append(tensor->getName());
+        entries.push_back(entry);
+        dataOffset += entry.dataSize;
+    }
+
+    std::ofstream out(imageFile, std::ios::out | std::ios::binary);
+    if (!out) {
+        std::cout << imageFile << ": cannot create the network image.\n";
+        exit(1);
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(graphBytes.data(), graphBytes.size());
+    out.write(index.data(), index.size());
+    for (int i = 0; i < tensors.size(); i++) {
+        uint64_t padding = entries[i].dataOffset - out.tellp();
+        out.write(std::string(padding, '\0').data(), padding);
+        out.write(reinterpret_cast<const char*>(tensors[i]->rawData()),
+                  entries[i].dataSize);
+    }
+    if (!out) {
+        std::cout << imageFile << ": failed to write the network image.\n";
+        exit(1);
+    }
+    std::cout << "Wrote the network image " << imageFile << " ("
+              << tensors.size() << " tensors, " << out.tellp()
+              << " bytes).\n";
+}
+
+bool isNetworkImage(const std::string& file) {
+    std::ifstream in(file, std::ios::in | std::ios::binary);
+    char magic[sizeof(kImageMagic)];
+    return in.read(magic, sizeof(magic)) &&
+           memcmp(magic, kImageMagic, sizeof(magic)) == 0;
+}
+
+Network* loadNetworkImage(const std::string& imageFile,
+                          SamplingInfo& sampling,
+                          Workspace* workspace) {
+    int fd = open(imageFile.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cout << imageFile << ": network image not found.\n";
+        exit(1);
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) < 0) {
+        std::cout << imageFile << ": cannot stat the network image.\n";
+        exit(1);
+    }
+    size_t fileSize = fileStat.st_size;
+    // A private writable mapping lets operators write to the Data tensors
+    // without touching the file.
+    void* mapping = fileSize < sizeof(ImageHeader)
+                            ? MAP_FAILED
+                            : mmap(NULL, fileSize, PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        std::cout << imageFile << ": failed to map the network image.\n";
+        exit(1);
+    }
+    // The Data tensors share the ownership of the mapping.
+    std::shared_ptr<void> image(
+            mapping, [fileSize](void* addr) { munmap(addr, fileSize); });
+    const char* base = reinterpret_cast<const char*>(mapping);
+
+    const ImageHeader* header = reinterpret_cast<const ImageHeader*>(base);
+    if (memcmp(header->magic, kImageMagic, sizeof(kImageMagic)) != 0 ||
+        header->version != kImageVersion) {
+        std::cout << imageFile << ": not a supported network image.\n";
+        exit(1);
+    }
+    GraphProto graph;
+    if (!fitsInImage(header->graphOffset, header->graphSize, fileSize) ||
+        !graph.ParseFromArray(base + header->graphOffset, header->graphSize)) {
+        std::cout << "Failed to parse the network image topology.\n";
+        exit(1);
+    }
+    std::map<std::string, TensorEntry> entries;
+    uint64_t indexOffset = header->indexOffset;
+    for (int i = 0; i < header->numTensors; i++) {
+        TensorEntry entry;
+        if (!fitsInImage(indexOffset, sizeof(entry), fileSize)) {
+            std::cout << "The network image is truncated.\n";
+            exit(1);
+        }
+        memcpy(&entry, base + indexOffset, sizeof(entry));
+        indexOffset += sizeof(entry);
+        if (!fitsInImage(indexOffset, entry.nameSize, fileSize) ||
+            !fitsInImage(entry.dataOffset, entry.dataSize, fileSize)) {
+            std::cout << "The network image is truncated.\n";
+            exit(1);
+        }
+        std::string name(base + indexOffset, entry.nameSize);
+        indexOffset += entry.nameSize;
+        entries[name] = entry;
+    }
+
+    auto createDataTensor = [&](const TensorProto& tensorProto) {
+        Tensor* tensor = new Tensor(tensorProto);
+        auto entry = entries.find(tensorProto.name());
+        uint64_t dataSize = (uint64_t)tensor->getShape().storageSize() *
+                            tensor->getDataTypeSize();
+        if (entry == entries.end() || entry->second.dataSize != dataSize) {
+            std::cout << "The network image has no data for "
+                      << tensorProto.name() << ".\n";
+            exit(1);
+        }
+        tensor->setExternalStorage(
+                image, const_cast<char*>(base) + entry->second.dataOffset,
+                tensorProto.data_type());
+        return tensor;
+    };
+    return buildNetwork(graph, createDataTensor, sampling, workspace);
+}
+
+}  // namespace smaug
@@ -0,0 +1,43 @@
+#ifndef _CORE_NETWORK_IMAGE_H_
+#define _CORE_NETWORK_IMAGE_H_
+
+#include <string>
+
+#include "smaug/core/network.h"
+#include "smaug/core/workspace.h"
+#include "smaug/operators/common.h"
+
+namespace smaug {
+
+/**
+ * A network image is a model precompiled into a single file that can be
+ * memory mapped. It holds the model topology as a binary protobuf, an index of
+ * the Data tensors, and the storage of every Data tensor, already converted
+ * and padded exactly as the Tensor stores it, at page-aligned offsets.
+ *
+ * Loading an image parses no text and copies no weights: the Data tensors use
+ * the mapped file as their storage, copy-on-write.
+ */
+
+/**
+ * Compiles a model topology and parameters protobuf pair into a network
+ * image. Exits on errors.
+ */
+void writeNetworkImage(const std::string& modelTopoFile,
+                       const std::string& modelParamsFile,
+                       const std::string& imageFile);
+
+/** Returns true if the file is a network image. */
+bool isNetworkImage(const std::string& file);
+
+/**
+ * Loads a network image and returns the Network, just like buildNetwork()
+ * does for the protobuf files. Exits on errors.
+ */
+Network* loadNetworkImage(const std::string& imageFile,
+                          SamplingInfo& sampling,
+                          Workspace* workspace);
+
+}  // namespace smaug
+
+#endif
@@ -0,0 +1,123 @@
+#include <cstdint>
+#include <fstream>
+
+#include <google/protobuf/text_format.h>
+
+#include "catch.hpp"
+#include "smaug/core/backend.h"
+#include "smaug/core/graph.pb.h"
+#include "smaug/core/network_image.h"
+#include "smaug/core/scheduler.h"
+#include "smaug/core/smaug_test.h"
+#include "smaug/core/tensor.h"
+#include "smaug/core/tensor.pb.h"
+
+using namespace smaug;
+
+namespace {
+
+TensorProto* addTensorProto(NodeProto* node,
+                            bool isInput,
+                            const std::string& name,
+                            DataType dataType,
+                            const std::vector<int>& dims,
+                            int alignment) {
+    TensorProto* tensorProto =
+            isInput ? node->add_input_tensors() : node->add_output_tensors();
+    tensorProto->set_name(name);
+    tensorProto->set_data_type(dataType);
+    tensorProto->set_data_format(Uncompressed);
+    TensorShapeProto* shape = tensorProto->mutable_shape();
+    for (int dim : dims)
+        shape->add_dims(dim);
+    shape->set_layout(NC);
+    shape->set_alignment(alignment);
+    return tensorProto;
+}
+
+}  // namespace
+
+TEST_CASE_METHOD(SmaugTest, "Network images", "[networkimage]") {
+    // input (fp32) --> relu, and an unconnected fp16 constant, which is
+    // padded from 5 to 8 columns.
+    GraphProto graph;
+    graph.set_name("image_test");
+    graph.set_backend(ReferenceBackend::Name);
+    graph.set_mem_policy(AllDma);
+    NodeProto* inputNode = graph.add_nodes();
+    inputNode->set_name("input");
+    inputNode->set_op(OpType::Data);
+    addTensorProto(inputNode, true, "input", Float32, { 2, 5 }, 0);
+    addTensorProto(inputNode, false, "input", Float32, { 2, 5 }, 0);
+    NodeProto* constNode = graph.add_nodes();
+    constNode->set_name("const");
+    constNode->set_op(OpType::Data);
+    addTensorProto(constNode, true, "const", Float16, { 1, 5 }, 8);
+    addTensorProto(constNode, false, "const", Float16, { 1, 5 }, 8);
+    NodeProto* reluNode = graph.add_nodes();
+    reluNode->set_name("relu");
+    reluNode->set_op(OpType::ReLU);
+    reluNode->add_parents("input");
+    reluNode->add_src_tensors_indices(0);
+    addTensorProto(reluNode, true, "input", Float32, { 2, 5 }, 0);
+    addTensorProto(reluNode, false, "relu", Float32, { 2, 5 }, 0);
+
+    std::vector<float> inputValues{ -1, 2, -3, 4, -5, 6, -7, 8, -9, 10 };
+    std::vector<float16> constValues{ fp16(1), fp16(2), fp16(3), fp16(4),
+                                      fp16(5), 0,       0,       0 };
+    TensorDataArray tensorDataArray;
+    TensorData* inputData = tensorDataArray.add_data_array();
+    inputData->set_name("input");
+    for (float value : inputValues)
+        inputData->add_float_data(value);
+    TensorData* constData = tensorDataArray.add_data_array();
+    constData->set_name("const");
+    for (int i = 0; i < constValues.size(); i += 2)
+        constData->add_half_data(constValues[i] | (constValues[i + 1] << 16));
+
+    TempDir tempDir;
+    std::string topoFile = tempDir.file("topo.pbtxt");
+    std::string paramsFile = tempDir.file("params.pb");
+    std::string imageFile = tempDir.file("network.img");
+    std::string topoText;
+    google::protobuf::TextFormat::PrintToString(graph, &topoText);
+    std::ofstream(topoFile) << topoText;
+    std::ofstream params(paramsFile, std::ios::out | std::ios::binary);
+    tensorDataArray.SerializeToOstream(&params);
+    params.close();
+
+    writeNetworkImage(topoFile, paramsFile, imageFile);
+    REQUIRE(isNetworkImage(imageFile));
+    REQUIRE(!isNetworkImage(topoFile));
+    REQUIRE(!isNetworkImage(paramsFile));
+
+    delete network_;
+    SamplingInfo sampling = { NoSampling, 1 };
+    network_ = loadNetworkImage(imageFile, sampling, workspace());
+    REQUIRE(network_->getOperators().size() == 3);
+
+    SECTION("Data tensors are mapped from the image") {
+        Tensor* input = workspace()->getTensor("input");
+        Tensor* constant = workspace()->getTensor("const");
+        REQUIRE(input->getShape().storageSize() == inputValues.size());
+        REQUIRE((uintptr_t)input->rawData() % 4096 == 0);
+        REQUIRE((uintptr_t)constant->rawData() % 4096 == 0);
+        const float* inputPtr = input->data<float>();
+        for (int i = 0; i < inputValues.size(); i++)
+            REQUIRE(inputPtr[i] == inputValues[i]);
+        const float16* constPtr = constant->data<float16>();
+        for (int i = 0; i < constValues.size(); i++)
+            REQUIRE(constPtr[i] == constValues[i]);
+    }
+
+    SECTION("The loaded network runs") {
+        Scheduler scheduler(network_, workspace());
+        Tensor* output = scheduler.runNetwork();
+        REQUIRE(output->getName() == "relu");
+        const float* outputPtr = output->data<float>();
+        std::vector<float> expected{ 0, 2, 0, 4, 0, 6, 0, 8, 0, 10 };
+        auto idx = output->startIndex();
+        for (int i = 0; !idx.end(); ++idx, ++i)
+            REQUIRE(outputPtr[idx] == expected[i]);
+    }
+}
@@ -13,6 +13,33 @@ bool Operator::isDead() {
     return anyInputDead;
 }
 
+void Operator::resolveTensors() {
+    resolvedInputs.resize(inputs.size());
+    for (int i = 0; i < inputs.size(); i++)
+        resolvedInputs[i] = dynamic_cast<Tensor*>(inputs[i]);
+    resolvedOutputs.resize(outputs.size());
+    for (int i = 0; i < outputs.size(); i++)
+        resolvedOutputs[i] = dynamic_cast<Tensor*>(outputs[i]);
+}
+
+/**
+ * Returns the total storage size in bytes of all the tensors with a known data
+ * type.
+ */
+static int64_t getStorageBytes(const std::vector<TensorBase*>& tensors) {
+    int64_t bytes = 0;
+    for (auto tensor : tensors) {
+        if (tensor && tensor->getDataType() != UnknownDataType)
+            bytes += (int64_t)tensor->getShape().storageSize() *
+                     tensor->getDataTypeSize();
+    }
+    return bytes;
+}
+
+int64_t Operator::getBytesRead() const { return getStorageBytes(inputs); }
+
+int64_t Operator::getBytesWritten() const { return getStorageBytes(outputs); }
+
 void Operator::printSummary(std::ostream& out) const {
     boost::format fmter(kLayerFormat);
     out << fmter % (this->name + " (" + OpType_Name(opType) + ")") %
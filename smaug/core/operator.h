@@ -87,12 +87,63 @@ class Operator {
 
     /** This returns the number of parameterizable weights in the operator. */
     virtual int getNumParameters() const { return 0; }
+
+    /**
+     * Returns the number of multiply-accumulate operations performed by a
+     * single run of this operator.
+     */
+    virtual int64_t getNumMacs() const { return 0; }
+
+    /**
+     * Returns the number of arithmetic operations performed by a single run of
+     * this operator. By default, every MAC counts as two operations.
+     */
+    virtual int64_t getNumFlops() const { return 2 * getNumMacs(); }
+
+    /**
+     * Returns the number of bytes this operator must read from memory, which
+     * by default is the storage size of all its inputs. Data movement caused
+     * by tiling is not included here; see RooflineProfiler.
+     */
+    virtual int64_t getBytesRead() const;
+
+    /**
+     * Returns the number of bytes this operator must write to memory, which by
+     * default is the storage size of all its outputs.
+     */
+    virtual int64_t getBytesWritten() const;
+
+    /**
+     * Returns true if every element of the output is computed only from the
+     * same element of the inputs, so that the output can be written over an
+     * input of the same shape. The Scheduler does this for inputs that nothing
+     * else reads when in-place execution is on.
+     */
+    virtual bool supportsInPlace() const { return false; }
+
     virtual bool isSamplingSupported() const { return false; }
     virtual void setSamplingInfo(const SamplingInfo& sampling) {}
 
     void printSummary(std::ostream& out) const;
-    void setInput(TensorBase* op, int index) { inputs[index] = op; }
-    void setOutput(TensorBase* op, int index) { outputs[index] = op; }
+    void setInput(TensorBase* op, int index) {
+        inputs[index] = op;
+        if (index < resolvedInputs.size())
+            resolvedInputs[index] = dynamic_cast<Tensor*>(op);
+    }
+    void setOutput(TensorBase* op, int index) {
+        outputs[index] = op;
+        if (index < resolvedOutputs.size())
+            resolvedOutputs[index] = dynamic_cast<Tensor*>(op);
+    }
+
+    /**
+     * Resolves every input and output to a Tensor once, so that getInput()
+     * and getOutput() don't have to dynamic_cast on every call. The Scheduler
+     * does this when it compiles its execution plan. Changes made through
+     * setInput() and setOutput() are picked up; anything that modifies the
+     * inputs or outputs directly afterwards must call this again.
+     */
+    void resolveTensors();
 
     /**
      * Set the number of input tensors that this operator is waiting on. When
@@ -108,11 +159,15 @@ class Operator {
     Workspace* getWorkspace() { return workspace; }
 
     Tensor* getInput(int index) const {
+        if (index < resolvedInputs.size())
+            return resolvedInputs[index];
         return dynamic_cast<Tensor*>(inputs.at(index));
     }
     const std::vector<TensorBase*>& getInputs() const { return inputs; }
 
     Tensor* getOutput(int index) const {
+        if (index < resolvedOutputs.size())
+            return resolvedOutputs[index];
         return dynamic_cast<Tensor*>(outputs.at(index));
     }
     const std::vector<TensorBase*>& getOutputs() const { return outputs; }
@@ -140,6 +195,13 @@ class Operator {
      */
     std::vector<TensorBase*> outputs;
 
+    /**
+     * The inputs and outputs as Tensors (or nullptr for anything else), as of
+     * the last resolveTensors(). Empty until then.
+     */
+    std::vector<Tensor*> resolvedInputs;
+    std::vector<Tensor*> resolvedOutputs;
+
     std::string name;
     OpType opType;
     /** The BGL Vertex corresponding to this Operator. */
@@ -0,0 +1,230 @@
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+
+#include "smaug/core/backend.h"
+#include "smaug/core/pipeline_scheduler.h"
+#include "smaug/core/tensor_utils.h"
+#include "smaug/core/types.pb.h"
+#include "smaug/utility/debug_stream.h"
+#include "smaug/utility/task_thread.h"
+
+namespace smaug {
+
+bool PipelineScheduler::supportsNetwork(const Network* network) {
+    return network->getBackend() == ReferenceBackend::Name;
+}
+
+void PipelineScheduler::compileStages(
+        const std::vector<Tensor*>& streamInputs) {
+    assert(stages.empty() && "The stages are compiled already!");
+    assert(supportsNetwork(network) &&
+           "Only Reference networks can be pipelined!");
+    compileNetwork();
+    CriticalPathPolicy defaultCostModel;
+    const CriticalPathPolicy* model = costModel ? costModel : &defaultCostModel;
+
+    // The Data operators do no work, and all go in the first stage, so that
+    // the stream inputs are filled by the thread that reads them first.
+    std::vector<Operator*> dataOps;
+    std::vector<Operator*> computeOps;
+    std::vector<double> costs;
+    for (auto& planned : plan) {
+        Operator* op = planned.op;
+        assert(op->getOpType() != OpType::Switch &&
+               op->getOpType() != OpType::Merge &&
+               "Control flow operators cannot be pipelined!");
+        if (op->getOpType() == OpType::Data) {
+            dataOps.push_back(op);
+        } else {
+            computeOps.push_back(op);
+            costs.push_back(model->getCost(op));
+        }
+    }
+    std::vector<int> stageStarts = balanceStages(costs);
+    stages.resize(std::max<int>(stageStarts.size(), 1));
+    // The stage, operator index in the stage and output index of every tensor
+    // that later stages need their own copies of.
+    std::map<const Tensor*, std::tuple<int, int, int>> producers;
+    auto addOperator = [&](int stage, Operator* op) {
+        int opIndex = stages[stage].ops.size();
+        stages[stage].ops.push_back(
+                { op, std::vector<std::vector<Handoff>>(
+                              op->getOutputs().size()) });
+        bool isData = op->getOpType() == OpType::Data;
+        for (int i = 0; i < op->getOutputs().size(); i++) {
+            Tensor* output = op->getOutput(i);
+            if (!output)
+                continue;
+            if (!isData || std::count(streamInputs.begin(),
+                                      streamInputs.end(), output))
+                producers[output] = std::make_tuple(stage, opIndex, i);
+        }
+    };
+    for (Operator* op : dataOps)
+        addOperator(0, op);
+    for (int stage = 0; stage < stageStarts.size(); stage++) {
+        int end = stage + 1 < stageStarts.size() ? stageStarts[stage + 1]
+                                                 : computeOps.size();
+        for (int i = stageStarts[stage]; i < end; i++)
+            addOperator(stage, computeOps[i]);
+    }
+
+    // Give every stage its own copy of the tensors it reads from earlier
+    // stages.
+    std::map<std::pair<const Tensor*, int>, Tensor*> copies;
+    for (int stage = 1; stage < stages.size(); stage++) {
+        std::set<int> stageProducers;
+        for (StageOperator& stageOp : stages[stage].ops) {
+            Operator* op = stageOp.op;
+            for (int i = 0; i < op->getInputs().size(); i++) {
+                Tensor* input = op->getInput(i);
+                auto producer = producers.find(input);
+                if (!input || producer == producers.end() ||
+                    std::get<0>(producer->second) == stage)
+                    continue;
+                int producerStage, opIndex, outputIndex;
+                std::tie(producerStage, opIndex, outputIndex) =
+                        producer->second;
+                Tensor*& copy = copies[std::make_pair(input, stage)];
+                if (!copy) {
+                    copy = new Tensor(
+                            input->getName() + "/stage" + std::to_string(stage),
+                            input->getShape());
+                    copy->allocateStorage(input->getDataType());
+                    workspace->addTensor(copy);
+                    stages[producerStage]
+                            .ops[opIndex]
+                            .handoffs[outputIndex]
+                            .push_back({ copy, stage });
+                }
+                op->setInput(copy, i);
+                stageProducers.insert(producerStage);
+            }
+        }
+        stages[stage].producers.assign(
+                stageProducers.begin(), stageProducers.end());
+    }
+    for (int stage = 0; stage < stages.size(); stage++) {
+        dout(0) << "Pipeline stage " << stage << ":";
+        for (StageOperator& stageOp : stages[stage].ops)
+            dout(0) << " " << stageOp.op->getName();
+        dout(0) << "\n";
+    }
+
+    // The copies are in place now, so the tiles can refer to them.
+    tileNetwork();
+}
+
+std::vector<int> PipelineScheduler::balanceStages(
+        const std::vector<double>& costs) const {
+    int numOps = costs.size();
+    int numRanges = std::min(numStages, numOps);
+    if (numRanges <= 0)
+        return std::vector<int>();
+    std::vector<double> prefix(numOps + 1, 0);
+    for (int i = 0; i < numOps; i++)
+        prefix[i + 1] = prefix[i] + costs[i];
+    // bottleneck[k][j] is the smallest maximum cost of cutting the first j
+    // operators into k + 1 ranges, and cut[k][j] is where its last range
+    // starts.
+    std::vector<std::vector<double>> bottleneck(
+            numRanges,
+            std::vector<double>(numOps + 1,
+                                std::numeric_limits<double>::infinity()));
+    std::vector<std::vector<int>> cut(numRanges,
+                                      std::vector<int>(numOps + 1, 0));
+    for (int j = 1; j <= numOps; j++)
+        bottleneck[0][j] = prefix[j];
+    for (int k = 1; k < numRanges; k++) {
+        for (int j = k + 1; j <= numOps; j++) {
+            for (int i = k; i < j; i++) {
+                double cost =
+                        std::max(bottleneck[k - 1][i], prefix[j] - prefix[i]);
+                if (cost < bottleneck[k][j]) {
+                    bottleneck[k][j] = cost;
+                    cut[k][j] = i;
+                }
+            }
+        }
+    }
+    std::vector<int> starts(numRanges, 0);
+    for (int k = numRanges - 1, j = numOps; k > 0; k--) {
+        j = cut[k][j];
+        starts[k] = j;
+    }
+    return starts;
+}
+
+void PipelineScheduler::runStream(int numInputs,
+                                  const FeedFunc& feed,
+                                  const DrainFunc& drain) {
+    if (stages.empty())
+        compileStages(std::vector<Tensor*>());
+    endFastForward();
+
+    std::cout << "======================================================\n";
+    std::cout << "      Streaming " << numInputs << " inputs through "
+              << stages.size() << " pipeline stages...\n";
+    std::cout << "======================================================\n";
+    numFinished.reset(new std::atomic<int>[stages.size()]);
+    for (int stage = 0; stage < stages.size(); stage++)
+        numFinished[stage].store(0);
+    std::vector<std::unique_ptr<TaskThread>> threads;
+    for (int stage = 0; stage < stages.size(); stage++) {
+        threads.emplace_back(new TaskThread());
+        threads.back()->enqueue([this, stage, numInputs, &feed, &drain]() {
+            for (int input = 0; input < numInputs; input++)
+                runStage(stage, input, feed, drain);
+        });
+    }
+    for (auto& thread : threads)
+        thread->join();
+}
+
+void PipelineScheduler::runStage(int stage,
+                                 int input,
+                                 const FeedFunc& feed,
+                                 const DrainFunc& drain) {
+    Stage& current = stages[stage];
+    for (int producer : current.producers)
+        waitForStage(producer, input + 1);
+    if (stage == 0 && feed)
+        feed(input);
+    for (StageOperator& stageOp : current.ops) {
+        stageOp.op->run();
+        for (int i = 0; i < stageOp.handoffs.size(); i++) {
+            Tensor* output = stageOp.op->getOutput(i);
+            for (const Handoff& handoff : stageOp.handoffs[i]) {
+                // The consumer must be done with the previous input before its
+                // copy is written over.
+                waitForStage(handoff.consumer, input);
+                copyRawTensorData(handoff.copy, output, 0, 0,
+                                  output->getShape().storageSize());
+            }
+        }
+    }
+    if (stage == stages.size() - 1 && drain)
+        drain(input, current.ops.back().op->getOutput(0));
+    numFinished[stage].store(input + 1, std::memory_order_release);
+}
+
+void PipelineScheduler::waitForStage(int stage, int numInputs) const {
+    while (numFinished[stage].load(std::memory_order_acquire) < numInputs)
+        std::this_thread::yield();
+}
+
+std::vector<Operator*> PipelineScheduler::getStageOperators(int stage) const {
+    std::vector<Operator*> ops;
+    for (const StageOperator& stageOp : stages.at(stage).ops)
+        ops.push_back(stageOp.op);
+    return ops;
+}
+
+}  // namespace smaug
@@ -0,0 +1,134 @@
+#ifndef _CORE_PIPELINE_SCHEDULER_H_
+#define _CORE_PIPELINE_SCHEDULER_H_
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "smaug/core/scheduler.h"
+#include "smaug/core/scheduling_policy.h"
+#include "smaug/core/tensor.h"
+
+namespace smaug {
+
+/**
+ * PipelineScheduler runs a stream of inputs through the Network as a
+ * pipeline, for throughput rather than latency.
+ *
+ * The execution plan is cut into contiguous stages of roughly equal cost, and
+ * every stage runs on a host thread of its own, so that while input i is in
+ * stage 2, input i+1 can already be in stage 1. All the Data operators go in
+ * the first stage.
+ *
+ * Every tensor that a stage reads from an earlier stage is double buffered:
+ * the reading stage gets a copy of its own, which the producing stage fills
+ * right after computing the tensor, once the reader is done with the
+ * previous input. So the producer writes input i+1 into its own tensor while
+ * the reader still works on input i out of its copy. The stages hand inputs
+ * over through lock-free counters of the inputs each stage has finished.
+ *
+ * Operators of different stages run at the same time, so this is only for
+ * native runs of the Reference backend, whose operators share no global
+ * state. SMV operators share the scratchpads, the accelerator threads and
+ * the tile prefetch thread, so SMV networks are refused. Operators may still
+ * split their own work over the thread pool, which all stages share. Control
+ * flow operators are not supported.
+ */
+class PipelineScheduler : public Scheduler {
+   public:
+    /** Fills the stream inputs of the network for the given input number. */
+    typedef std::function<void(int)> FeedFunc;
+    /** Consumes the network output for the given input number. */
+    typedef std::function<void(int, Tensor*)> DrainFunc;
+
+    PipelineScheduler(Network* _network, Workspace* _workspace, int _numStages)
+            : Scheduler(_network, _workspace), numStages(_numStages),
+              costModel(nullptr) {}
+
+    /**
+     * Set the cost model used to balance the stages. Without one, the
+     * operators are costed by their FLOP and byte counts against equal
+     * peaks. The PipelineScheduler does not take ownership of it.
+     */
+    void setCostModel(const CriticalPathPolicy* _costModel) {
+        costModel = _costModel;
+    }
+
+    /** Returns true if the operators of the Network can run as a pipeline. */
+    static bool supportsNetwork(const Network* network);
+
+    /**
+     * Partitions the execution plan into stages, gives every stage its own
+     * copies of the tensors it reads from earlier stages, and tiles the
+     * Network. The Data tensors in streamInputs change with every input, so
+     * they are copied too; the other Data tensors are shared by all stages.
+     *
+     * This rewires the Network, which must only be run with runStream()
+     * afterwards.
+     */
+    void compileStages(const std::vector<Tensor*>& streamInputs);
+
+    /**
+     * Runs numInputs inputs through the pipeline. Before each input enters
+     * the first stage, feed is called on that stage's thread to fill the
+     * stream inputs; after it leaves the last stage, drain is called on that
+     * stage's thread with the network output. Either may be empty. Calls
+     * compileStages() without stream inputs if it was not called yet.
+     */
+    void runStream(int numInputs,
+                   const FeedFunc& feed = FeedFunc(),
+                   const DrainFunc& drain = DrainFunc());
+
+    int getNumStages() const { return stages.size(); }
+
+    /** Returns the Operators of a stage, in the order they run. */
+    std::vector<Operator*> getStageOperators(int stage) const;
+
+   protected:
+    /** A copy of a tensor for a later stage. */
+    struct Handoff {
+        Tensor* copy;
+        /** The stage that reads the copy. */
+        int consumer;
+    };
+
+    /** An Operator in a stage, and the copies of its outputs to fill. */
+    struct StageOperator {
+        Operator* op;
+        /** The copies of every output of the Operator, by output index. */
+        std::vector<std::vector<Handoff>> handoffs;
+    };
+
+    struct Stage {
+        std::vector<StageOperator> ops;
+        /** The earlier stages that this stage reads tensors of. */
+        std::vector<int> producers;
+    };
+
+    /**
+     * Cuts the costs of the Operators into at most numStages contiguous
+     * ranges with the smallest possible maximum cost, and returns the index
+     * of the first Operator of every range.
+     */
+    std::vector<int> balanceStages(const std::vector<double>& costs) const;
+
+    /** Runs one input through a stage. */
+    void runStage(int stage,
+                  int input,
+                  const FeedFunc& feed,
+                  const DrainFunc& drain);
+
+    /** Spins until the stage has finished the given number of inputs. */
+    void waitForStage(int stage, int numInputs) const;
+
+    int numStages;
+    const CriticalPathPolicy* costModel;
+    std::vector<Stage> stages;
+    /** The number of inputs that every stage has finished in this stream. */
+    std::unique_ptr<std::atomic<int>[]> numFinished;
+};
+
+}  // namespace smaug
+
+#endif
@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <fstream>
+
+#include <google/protobuf/text_format.h>
+
+#include "catch.hpp"
+#include "smaug/core/backend.h"
+#include "smaug/core/graph.pb.h"
+#include "smaug/core/network_builder.h"
+#include "smaug/core/pipeline_scheduler.h"
+#include "smaug/core/smaug_test.h"
+#include "smaug/core/tensor.h"
+#include "smaug/core/tensor.pb.h"
+#include "smaug/operators/data_op.h"
+#include "smaug/operators/eltwise_add_op.h"
+#include "smaug/operators/eltwise_mul_op.h"
+#include "smaug/operators/relu_op.h"
+
+using namespace smaug;
+
+TEST_CASE_METHOD(SmaugTest, "Pipeline stages", "[scheduler]") {
+    // input --> relu --> add --> lrelu --> mul
+    //   \   \-----------/                 /
+    //    \-------------------------------/
+    // Every operator streams over the same number of elements, so they cost
+    // about the same.
+    TensorShape shape({ 1, 16 }, DataLayout::NC);
+    Tensor* input = workspace()->addTensor(new Tensor("input", shape));
+    input->allocateStorage<float>();
+    auto inputOp = new DataOp<ReferenceBackend>("input", workspace());
+    inputOp->setData(input);
+    auto relu = new ReluOp<ReferenceBackend>("relu", workspace());
+    relu->setInput(input, 0);
+    relu->createAllTensors();
+    relu->getOutput(0)->allocateStorage<float>();
+    auto add = new EltwiseAddOp<ReferenceBackend>("add", workspace());
+    add->setInput(relu->getOutput(0), 0);
+    add->setInput(input, 1);
+    add->createAllTensors();
+    add->getOutput(0)->allocateStorage<float>();
+    auto lrelu = new ReluOp<ReferenceBackend>("lrelu", workspace(), 0.5);
+    lrelu->setInput(add->getOutput(0), 0);
+    lrelu->createAllTensors();
+    lrelu->getOutput(0)->allocateStorage<float>();
+    auto mul = new EltwiseMulOp<ReferenceBackend>("mul", workspace());
+    mul->setInput(lrelu->getOutput(0), 0);
+    mul->setInput(input, 1);
+    mul->createAllTensors();
+    mul->getOutput(0)->allocateStorage<float>();
+
+    Network* net = network();
+    net->setBackend(ReferenceBackend::Name);
+    for (Operator* op :
+         std::vector<Operator*>{ inputOp, relu, add, lrelu, mul })
+        net->addOperator(op);
+    net->addEdge(inputOp, relu, { 0, 0 });
+    net->addEdge(relu, add, { 0, 0 });
+    net->addEdge(inputOp, add, { 0, 1 });
+    net->addEdge(add, lrelu, { 0, 0 });
+    net->addEdge(lrelu, mul, { 0, 0 });
+    net->addEdge(inputOp, mul, { 0, 1 });
+
+    auto inputValue = [](int item, int i) {
+        return (float)((item + i) % 9 - 4);
+    };
+    auto expectedValue = [&](int item, int i) {
+        float x = inputValue(item, i);
+        float sum = std::max(x, 0.0f) + x;
+        return (sum > 0 ? sum : sum * 0.5f) * x;
+    };
+
+    SECTION("Stages are contiguous and balanced") {
+        PipelineScheduler scheduler(net, workspace(), 2);
+        scheduler.compileStages({ input });
+        REQUIRE(scheduler.getNumStages() == 2);
+        std::vector<std::vector<std::string>> expectedStages{
+            { "input", "relu", "add" }, { "lrelu", "mul" }
+        };
+        for (int stage = 0; stage < expectedStages.size(); stage++) {
+            std::vector<Operator*> ops = scheduler.getStageOperators(stage);
+            REQUIRE(ops.size() == expectedStages[stage].size());
+            for (int i = 0; i < ops.size(); i++)
+                REQUIRE(ops[i]->getName() == expectedStages[stage][i]);
+        }
+        // The second stage reads copies of the tensors of the first.
+        REQUIRE(lrelu->getInput(0) != add->getOutput(0));
+        REQUIRE(mul->getInput(1) != input);
+        REQUIRE(add->getInput(1) == input);
+    }
+
+    SECTION("There are no more stages than operators") {
+        PipelineScheduler scheduler(net, workspace(), 8);
+        scheduler.compileStages({ input });
+        REQUIRE(scheduler.getNumStages() == 4);
+    }
+
+    SECTION("Streaming gives the results of running every input alone") {
+        int numInputs = 50;
+        for (int numStages : { 1, 2, 4 }) {
+            PipelineScheduler scheduler(net, workspace(), numStages);
+            scheduler.compileStages({ input });
+            std::vector<std::vector<float>> outputs(numInputs);
+            scheduler.runStream(
+                    numInputs,
+                    [&](int item) {
+                        float* inputData = input->data<float>();
+                        for (int i = 0; i < shape.storageSize(); i++)
+                            inputData[i] = inputValue(item, i);
+                    },
+                    [&](int item, Tensor* output) {
+                        const float* outputData = output->data<float>();
+                        outputs[item].assign(
+                                outputData, outputData + shape.storageSize());
+                    });
+            for (int item = 0; item < numInputs; item++) {
+                REQUIRE(outputs[item].size() == shape.storageSize());
+                for (int i = 0; i < shape.storageSize(); i++)
+                    REQUIRE(outputs[item][i] == expectedValue(item, i));
+            }
+            // Compiling the stages rewires the network, so start over from
+            // the original tensors.
+            relu->setInput(input, 0);
+            add->setInput(relu->getOutput(0), 0);
+            add->setInput(input, 1);
+            lrelu->setInput(add->getOutput(0), 0);
+            mul->setInput(input, 1);
+        }
+    }
+}
+
+TEST_CASE_METHOD(SmaugTest, "Pipelined backends", "[scheduler]") {
+    // input --> relu, built from a model of the given backend.
+    auto buildModel = [this](const std::string& backend) {
+        GraphProto graph;
+        graph.set_name("pipeline_test");
+        graph.set_backend(backend);
+        graph.set_mem_policy(AllDma);
+        NodeProto* inputNode = graph.add_nodes();
+        inputNode->set_name("input");
+        inputNode->set_op(OpType::Data);
+        NodeProto* reluNode = graph.add_nodes();
+        reluNode->set_name("relu");
+        reluNode->set_op(OpType::ReLU);
+        reluNode->add_parents("input");
+        reluNode->add_src_tensors_indices(0);
+        for (TensorProto* tensorProto :
+             { inputNode->add_input_tensors(), inputNode->add_output_tensors(),
+               reluNode->add_input_tensors(),
+               reluNode->add_output_tensors() }) {
+            tensorProto->set_name("input");
+            tensorProto->set_data_type(Float32);
+            tensorProto->set_data_format(Uncompressed);
+            tensorProto->mutable_shape()->add_dims(1);
+            tensorProto->mutable_shape()->add_dims(8);
+            tensorProto->mutable_shape()->set_layout(NC);
+        }
+        reluNode->mutable_output_tensors(0)->set_name("relu");
+        TensorDataArray tensorDataArray;
+        TensorData* inputData = tensorDataArray.add_data_array();
+        inputData->set_name("input");
+        for (int i = 0; i < 8; i++)
+            inputData->add_float_data(i - 4);
+
+        TempDir tempDir;
+        std::string topoFile = tempDir.file("topo.pbtxt");
+        std::string paramsFile = tempDir.file("params.pb");
+        std::string topoText;
+        google::protobuf::TextFormat::PrintToString(graph, &topoText);
+        std::ofstream(topoFile) << topoText;
+        std::ofstream params(paramsFile, std::ios::out | std::ios::binary);
+        tensorDataArray.SerializeToOstream(&params);
+        params.close();
+        SamplingInfo sampling = { NoSampling, 1 };
+        delete network_;
+        network_ = smaug::buildNetwork(
+                topoFile, paramsFile, sampling, workspace());
+        return network_;
+    };
+
+    SECTION("Reference networks can be pipelined") {
+        Network* net = buildModel(ReferenceBackend::Name);
+        REQUIRE(PipelineScheduler::supportsNetwork(net));
+    }
+
+    SECTION("SMV networks are refused") {
+        // SMV operators share the scratchpads and the accelerator threads.
+        Network* net = buildModel(SmvBackend::Name);
+        REQUIRE(!PipelineScheduler::supportsNetwork(net));
+    }
+}
@@ -0,0 +1,119 @@
+#include <chrono>
+#include <string>
+
+#include <boost/format.hpp>
+
+#include "smaug/core/operator.h"
+#include "smaug/core/roofline.h"
+
+namespace smaug {
+
+namespace roofline {
+std::atomic<bool> countDataMovement(false);
+std::atomic<uint64_t> tileCopyBytes(0);
+std::atomic<uint64_t> spadBytes(0);
+}  // namespace roofline
+
+static double wallClockSeconds() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+RooflineProfiler::RooflineProfiler(double _peakGflops, double _peakGbps)
+        : peakGflops(_peakGflops), peakGbps(_peakGbps), startTime(0),
+          startTileCopyBytes(0), startSpadBytes(0) {
+    roofline::countDataMovement = true;
+}
+
+RooflineProfiler::~RooflineProfiler() { roofline::countDataMovement = false; }
+
+void RooflineProfiler::beginOperator() {
+    startTileCopyBytes = roofline::tileCopyBytes.load();
+    startSpadBytes = roofline::spadBytes.load();
+    startTime = wallClockSeconds();
+}
+
+void RooflineProfiler::endOperator(const Operator* op) {
+    double elapsed = wallClockSeconds() - startTime;
+    records.push_back({ op, elapsed,
+                        roofline::tileCopyBytes.load() - startTileCopyBytes,
+                        roofline::spadBytes.load() - startSpadBytes });
+}
+
+void RooflineProfiler::printReport(std::ostream& out) const {
+    static const std::string hline(
+            "______________________________________________"
+            "______________________________________________"
+            "______________________________________________");
+    static const char* kHeaderFormat =
+            "%-40s %12s %12s %12s %12s %12s %10s %10s %10s %-6s\n";
+    static const char* kRowFormat =
+            "%-40s %12.3f %12.3f %12.1f %12.1f %12.1f %10.2f %10.3f %10.2f "
+            "%-6s\n";
+    auto bound = [&](double intensity) -> std::string {
+        if (peakGflops <= 0 || peakGbps <= 0)
+            return "-";
+        // The ridge point is where the memory roof meets the compute roof.
+        return intensity < peakGflops / peakGbps ? "memory" : "compute";
+    };
+    auto gflops = [](int64_t flops, double seconds) {
+        return seconds > 0 ? flops / seconds / 1e9 : 0;
+    };
+    auto intensity = [](int64_t flops, int64_t bytes) {
+        return bytes > 0 ? (double)flops / bytes : 0;
+    };
+
+    out << hline << "\n";
+    out << boost::format(kHeaderFormat) % "Layer (type)" % "MMACs" %
+                    "MFLOPs" % "R+W (KB)" % "Tile cp (KB)" % "Spad (KB)" %
+                    "FLOP/byte" % "Time (ms)" % "GFLOP/s" % "Bound";
+    out << hline << "\n";
+    int64_t totalMacs = 0, totalFlops = 0, totalBytes = 0;
+    uint64_t totalTileBytes = 0, totalSpadBytes = 0;
+    double totalSeconds = 0;
+    for (const Record& record : records) {
+        const Operator* op = record.op;
+        int64_t macs = op->getNumMacs();
+        int64_t flops = op->getNumFlops();
+        int64_t bytes = op->getBytesRead() + op->getBytesWritten();
+        double ai = intensity(flops, bytes);
+        out << boost::format(kRowFormat) %
+                        (op->getName() + " (" + OpType_Name(op->getOpType()) +
+                         ")") %
+                        (macs / 1e6) % (flops / 1e6) % (bytes / 1024.0) %
+                        (record.tileCopyBytes / 1024.0) %
+                        (record.spadBytes / 1024.0) % ai %
+                        (record.seconds * 1e3) %
+                        gflops(flops, record.seconds) % bound(ai);
+        totalMacs += macs;
+        totalFlops += flops;
+        totalBytes += bytes;
+        totalTileBytes += record.tileCopyBytes;
+        totalSpadBytes += record.spadBytes;
+        totalSeconds += record.seconds;
+    }
+    out << hline << "\n";
+    double totalAi = intensity(totalFlops, totalBytes);
+    out << boost::format(kRowFormat) % "Total" % (totalMacs / 1e6) %
+                    (totalFlops / 1e6) % (totalBytes / 1024.0) %
+                    (totalTileBytes / 1024.0) % (totalSpadBytes / 1024.0) %
+                    totalAi % (totalSeconds * 1e3) %
+                    gflops(totalFlops, totalSeconds) % bound(totalAi);
+    out << hline << "\n";
+}
+
+std::map<const Operator*, double> RooflineProfiler::getOperatorSeconds()
+        const {
+    std::map<const Operator*, std::pair<double, int>> totals;
+    for (const Record& record : records) {
+        auto& total = totals[record.op];
+        total.first += record.seconds;
+        total.second++;
+    }
+    std::map<const Operator*, double> seconds;
+    for (auto& total : totals)
+        seconds[total.first] = total.second.first / total.second.second;
+    return seconds;
+}
+
+}  // namespace smaug
@@ -0,0 +1,95 @@
+#ifndef _CORE_ROOFLINE_H_
+#define _CORE_ROOFLINE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace smaug {
+
+class Operator;
+
+namespace roofline {
+
+/**
+ * If true, tile copies and scratchpad mappings update the data movement
+ * counters. This is off by default so that normal runs don't pay for the
+ * atomic updates. The copies run on worker threads as well, which is why the
+ * flag and the counters are atomic.
+ */
+extern std::atomic<bool> countDataMovement;
+
+/** Bytes copied between TiledTensor tiles and their original Tensors. */
+extern std::atomic<uint64_t> tileCopyBytes;
+
+/** Bytes mapped into accelerator scratchpads via mapArrayToAccel(). */
+extern std::atomic<uint64_t> spadBytes;
+
+inline void recordTileCopy(uint64_t bytes) {
+    if (countDataMovement.load(std::memory_order_relaxed))
+        tileCopyBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+inline void recordSpadTraffic(uint64_t bytes) {
+    if (countDataMovement.load(std::memory_order_relaxed))
+        spadBytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+}  // namespace roofline
+
+/**
+ * RooflineProfiler combines the analytical compute and memory costs reported
+ * by each Operator with its measured execution time and data movement, and
+ * prints a per-layer roofline report.
+ *
+ * The Scheduler calls beginOperator()/endOperator() around every Operator it
+ * runs.
+ */
+class RooflineProfiler {
+   public:
+    /**
+     * Create a profiler.
+     *
+     * @param _peakGflops Peak compute throughput of the target, in GFLOP/s.
+     * @param _peakGbps Peak memory bandwidth of the target, in GB/s.
+     *
+     * If either peak is zero, the report does not classify layers as compute
+     * or memory bound.
+     */
+    RooflineProfiler(double _peakGflops = 0, double _peakGbps = 0);
+    ~RooflineProfiler();
+
+    void beginOperator();
+    void endOperator(const Operator* op);
+
+    /** Print the per-layer report, in execution order, followed by totals. */
+    void printReport(std::ostream& out) const;
+
+    /**
+     * Returns the mean measured execution time of every recorded Operator,
+     * in seconds.
+     */
+    std::map<const Operator*, double> getOperatorSeconds() const;
+
+   protected:
+    struct Record {
+        const Operator* op;
+        double seconds;
+        uint64_t tileCopyBytes;
+        uint64_t spadBytes;
+    };
+
+    double peakGflops;
+    double peakGbps;
+    /** Wall clock time of the last beginOperator() call, in seconds. */
+    double startTime;
+    uint64_t startTileCopyBytes;
+    uint64_t startSpadBytes;
+    std::vector<Record> records;
+};
+
+}  // namespace smaug
+
+#endif
@@ -0,0 +1,107 @@
+#include <thread>
+#include <vector>
+
+#include "catch.hpp"
+#include "smaug/core/backend.h"
+#include "smaug/core/roofline.h"
+#include "smaug/core/tensor.h"
+#include "smaug/core/smaug_test.h"
+#include "smaug/operators/convolution_op.h"
+#include "smaug/operators/depthwise_convolution_op.h"
+#include "smaug/operators/inner_product_op.h"
+#include "smaug/operators/relu_op.h"
+
+using namespace smaug;
+
+TEST_CASE_METHOD(SmaugTest, "Operator FLOP and byte accounting", "[roofline]") {
+    SECTION("Convolution") {
+        auto convOp = new ConvolutionOp<ReferenceBackend>("conv", workspace());
+        TensorShape inputShape({ 1, 8, 8, 4 }, DataLayout::NHWC);
+        Tensor* input = new Tensor("input", inputShape);
+        input->allocateStorage<float>();
+        workspace()->addTensor(input);
+        convOp->setInput(input, 0);
+        convOp->setPadding(SamePadding);
+        convOp->setWeightDims(3, 3, 16);
+        convOp->setStride(1, 1);
+        convOp->createAllTensors();
+        allocateAllTensors<float>(convOp);
+        // 8x8x16 outputs, each a dot product over a 3x3x4 window.
+        REQUIRE(convOp->getNumMacs() == 8 * 8 * 16 * 3 * 3 * 4);
+        REQUIRE(convOp->getNumFlops() == 2 * convOp->getNumMacs());
+        REQUIRE(convOp->getBytesRead() ==
+                (8 * 8 * 4 + 16 * 3 * 3 * 4) * sizeof(float));
+        REQUIRE(convOp->getBytesWritten() == 8 * 8 * 16 * sizeof(float));
+    }
+
+    SECTION("Depthwise convolution") {
+        auto convOp = new DepthwiseConvolutionOp<ReferenceBackend>(
+                "conv", workspace());
+        TensorShape inputShape({ 1, 4, 8, 8 }, DataLayout::NCHW);
+        Tensor* input = new Tensor("input", inputShape);
+        input->allocateStorage<float>();
+        workspace()->addTensor(input);
+        convOp->setInput(input, 0);
+        convOp->setPadding(SamePadding);
+        convOp->setWeightDims(3, 3, 4);
+        convOp->setStride(1, 1);
+        convOp->createAllTensors();
+        allocateAllTensors<float>(convOp);
+        REQUIRE(convOp->getNumMacs() == 4 * 8 * 8 * 3 * 3);
+    }
+
+    SECTION("Inner product") {
+        auto fcOp = new InnerProductOp<ReferenceBackend>("fc", workspace());
+        TensorShape inputShape({ 2, 32 }, DataLayout::NC);
+        Tensor* input = new Tensor("input", inputShape);
+        input->allocateStorage<float>();
+        workspace()->addTensor(input);
+        fcOp->setInput(input, 0);
+        fcOp->setNumOutputs(10);
+        fcOp->createAllTensors();
+        allocateAllTensors<float>(fcOp);
+        REQUIRE(fcOp->getNumMacs() == 2 * 32 * 10);
+    }
+}
+
+TEST_CASE_METHOD(SmaugTest, "Tile copy traffic accounting", "[roofline]") {
+    RooflineProfiler profiler;
+    auto reluOp = new ReluOp<ReferenceBackend>("relu", workspace());
+    TensorShape inputShape({ 1, 8, 8, 4 }, DataLayout::NHWC);
+    Tensor* input = new Tensor("input", inputShape);
+    input->allocateStorage<float>();
+    workspace()->addTensor(input);
+    TensorShape tileShape({ 1, 4, 8, 4 }, DataLayout::NHWC);
+    TiledTensor tiledTensor = generateTiledTensor(input, tileShape, reluOp);
+    uint64_t before = roofline::tileCopyBytes.load();
+    tiledTensor.copyDataToAllTiles();
+    REQUIRE(roofline::tileCopyBytes.load() - before ==
+            inputShape.size() * sizeof(float));
+    tiledTensor.untile();
+    REQUIRE(roofline::tileCopyBytes.load() - before ==
+            2 * inputShape.size() * sizeof(float));
+}
+
+TEST_CASE_METHOD(SmaugTest, "Data movement from worker threads", "[roofline]") {
+    const int numThreads = 4;
+    const int numCopies = 10000;
+    std::vector<std::thread> threads;
+    {
+        RooflineProfiler profiler;
+        uint64_t before = roofline::tileCopyBytes.load();
+        for (int i = 0; i < numThreads; i++) {
+            threads.emplace_back([]() {
+                for (int j = 0; j < numCopies; j++)
+                    roofline::recordTileCopy(64);
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        REQUIRE(roofline::tileCopyBytes.load() - before ==
+                (uint64_t)numThreads * numCopies * 64);
+    }
+    // Nothing is counted without a profiler.
+    uint64_t before = roofline::tileCopyBytes.load();
+    roofline::recordTileCopy(64);
+    REQUIRE(roofline::tileCopyBytes.load() == before);
+}
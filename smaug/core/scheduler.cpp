@@ -1,5 +1,12 @@
+#include <algorithm>
+#include <cassert>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <queue>
+#include <set>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "smaug/utility/debug_stream.h"
@@ -11,18 +18,95 @@
 namespace smaug {
 
 Tensor* Scheduler::runNetwork() {
+    tileNetwork();
+    return executeNetwork();
+}
+
+void Scheduler::tileNetwork() {
     std::cout << "======================================================\n";
     std::cout << "      Tiling operators of the network...\n";
     std::cout << "======================================================\n";
+    // Drop the tiles of any previous tiling of the network.
+    workspace->releaseTiledTensors();
+    // Storage is shared before tiling, since tiles may refer to it.
+    if (inPlace)
+        planInPlace();
     for (auto nameOp : network->getOperators()) {
         Operator* op = nameOp.second;
         dout(0) << "Tiling " << op->getName() << " ("
                 << OpType_Name(op->getOpType()) << ").\n";
         op->tile();
     }
+}
+
+void Scheduler::planInPlace() {
+    // An input dies with the Operator if nothing else reads it. Data tensors
+    // are never written over, since they are the inputs of the next run.
+    std::map<const TensorBase*, int> numReaders;
+    std::set<const TensorBase*> dataTensors;
+    for (auto nameOp : network->getOperators()) {
+        Operator* op = nameOp.second;
+        for (auto input : op->getInputs())
+            numReaders[input]++;
+        if (op->getOpType() == OpType::Data) {
+            for (auto output : op->getOutputs())
+                dataTensors.insert(output);
+        }
+    }
+    // Visit the Operators in dependency order, so that a chain of in-place
+    // Operators ends up sharing a single buffer.
+    const Graph& graph = network->getGraph();
+    std::vector<Vertex> vertices;
+    boost::topological_sort(graph, std::back_inserter(vertices));
+    for (auto it = vertices.rbegin(); it != vertices.rend(); ++it) {
+        Operator* op = get(boost::vertex_op, graph, *it);
+        if (!op->supportsInPlace() || op->getOutputs().size() != 1)
+            continue;
+        Tensor* output = op->getOutput(0);
+        for (int i = 0; i < op->getInputs().size(); i++) {
+            Tensor* input = op->getInput(i);
+            if (numReaders[input] != 1 || dataTensors.count(input) ||
+                !input->containsData() ||
+                input->getDataType() != output->getDataType() ||
+                input->getShape().storageSize() !=
+                        output->getShape().storageSize())
+                continue;
+            dout(1) << op->getName() << " runs in place over "
+                    << input->getName() << ".\n";
+            output->shareStorage(input);
+            break;
+        }
+    }
+}
+
+Tensor* Scheduler::executeNetwork() {
+    endFastForward();
+
+    std::cout << "======================================================\n";
+    std::cout << "      Scheduling operators of the network...\n";
+    std::cout << "======================================================\n";
+    if (plan.empty() || plan.size() != network->getOperators().size())
+        compileNetwork();
+    // Tensors marked dead by a previous run are revived, since liveness is
+    // decided anew on every run.
+    for (auto& planned : plan) {
+        for (auto output : planned.op->getOutputs())
+            output->setDead(false);
+    }
+    Tensor* output;
+    {
+        auto stats =
+                gem5::ScopedStats(stats::kNetworkStart, stats::kNetworkEnd);
+        output = runPlan();
+    }
+    return output;
+}
 
-    // We have finished loading the model and building the network, as well as
-    // the tiling of all the operators. Now we can stop fast forwarding.
+void Scheduler::endFastForward() {
+    if (!fastForwardMode)
+        return;
+    // We have finished loading the model and building the network, as well
+    // as the tiling of all the operators. Now we can stop fast forwarding.
     gem5::switchCpu();
 
     fastForwardMode = false;
@@ -33,66 +117,131 @@ Tensor* Scheduler::runNetwork() {
     // incorrect.
     if (threadPool)
         threadPool->initThreadPool();
+}
 
-    std::cout << "======================================================\n";
-    std::cout << "      Scheduling operators of the network...\n";
-    std::cout << "======================================================\n";
-    // Initialize number of pending inputs for every operator and put Data
-    // operators into the ready queue.
+void Scheduler::compileNetwork() {
+    // Order the operators the way a ready queue would run them: Data
+    // operators first, then every operator once all its inputs are ready.
+    // The policy picks among the ready operators; ties go to the one that
+    // became ready first.
+    const Graph& graph = network->getGraph();
+    int numOps = boost::num_vertices(graph);
+    if (policy)
+        policy->prepare(network);
+    typedef std::tuple<double, int, Vertex> ReadyOp;
+    // Highest priority first, then lowest sequence number.
+    auto runsLater = [](const ReadyOp& a, const ReadyOp& b) {
+        if (std::get<0>(a) != std::get<0>(b))
+            return std::get<0>(a) < std::get<0>(b);
+        return std::get<1>(a) > std::get<1>(b);
+    };
+    std::priority_queue<ReadyOp, std::vector<ReadyOp>, decltype(runsLater)>
+            readyQueue(runsLater);
+    int numReady = 0;
+    auto pushReady = [&](Vertex vertex) {
+        double priority = policy ? policy->getPriority(get(
+                                           boost::vertex_op, graph, vertex))
+                                 : 0;
+        readyQueue.emplace(priority, numReady++, vertex);
+    };
+    std::vector<int> numPendingInputs(numOps);
     for (auto nameOp : network->getOperators()) {
-        Operator* op = nameOp.second;
-        Vertex vertex = op->getVertex();
-        int numPendingInputs = boost::in_degree(vertex, network->getGraph());
-        op->setNumPendingInputs(numPendingInputs);
-        if (numPendingInputs == 0)
-            readyQueue.push_back(op);
+        Vertex vertex = nameOp.second->getVertex();
+        numPendingInputs[vertex] = boost::in_degree(vertex, graph);
+        if (numPendingInputs[vertex] == 0)
+            pushReady(vertex);
     }
-    Tensor* output;
-    {
-        auto stats =
-                gem5::ScopedStats(stats::kNetworkStart, stats::kNetworkEnd);
-        output = scheduleReady();
+    plan.clear();
+    plan.reserve(numOps);
+    std::vector<int> planIndices(numOps, -1);
+    // The plan index of the last parent of every planned operator.
+    std::vector<int> lastParents;
+    lastParents.reserve(numOps);
+    while (!readyQueue.empty()) {
+        Vertex vertex = std::get<2>(readyQueue.top());
+        readyQueue.pop();
+        Operator* op = get(boost::vertex_op, graph, vertex);
+        op->resolveTensors();
+        int lastParent = -1;
+        in_edge_iter inEdgeIt, inEdgeEnd;
+        for (boost::tie(inEdgeIt, inEdgeEnd) = in_edges(vertex, graph);
+             inEdgeIt != inEdgeEnd;
+             ++inEdgeIt) {
+            lastParent = std::max(
+                    lastParent, planIndices[source(*inEdgeIt, graph)]);
+        }
+        planIndices[vertex] = plan.size();
+        plan.push_back({ op, (int)plan.size() + 1 });
+        lastParents.push_back(lastParent);
+
+        out_edge_iter outEdgeIt, outEdgeEnd;
+        for (boost::tie(outEdgeIt, outEdgeEnd) = out_edges(vertex, graph);
+             outEdgeIt != outEdgeEnd;
+             ++outEdgeIt) {
+            Vertex childVertex = target(*outEdgeIt, graph);
+            if (--numPendingInputs[childVertex] == 0)
+                pushReady(childVertex);
+        }
     }
-    return output;
+    assert(plan.size() == numOps && "The network has a cycle!");
+    computeSkipTargets(lastParents);
 }
 
-Tensor* Scheduler::scheduleReady() {
-    Tensor* output;
-    for (auto op : readyQueue) {
+void Scheduler::computeSkipTargets(const std::vector<int>& lastParents) {
+    // If operator i is dead, then so is every later operator j that is not a
+    // merge and has a parent in [i, j), by induction over j. The skip target
+    // of i is the first j where that fails: a merge, or an operator whose
+    // parents all come before i. As i grows, more operators fail, so they are
+    // collected in a set as they start to fail, and the skip target is the
+    // first one of them after i.
+    int numOps = plan.size();
+    std::vector<std::vector<int>> failingFrom(numOps);
+    for (int j = 0; j < numOps; j++) {
+        bool isMerge = plan[j].op->getOpType() == OpType::Merge;
+        failingFrom[isMerge ? 0 : lastParents[j] + 1].push_back(j);
+    }
+    std::set<int> failing = { numOps };
+    for (int i = 0; i < numOps; i++) {
+        failing.insert(failingFrom[i].begin(), failingFrom[i].end());
+        plan[i].skipTo = *failing.upper_bound(i);
+    }
+}
+
+Tensor* Scheduler::runPlan() {
+    Tensor* output = nullptr;
+    for (int i = 0; i < plan.size();) {
+        Operator* op = plan[i].op;
         dout(0) << "Scheduling " << op->getName() << " ("
                 << OpType_Name(op->getOpType()) << ").\n";
-        maybeRunOperator(op);
-        updateChildren(op);
-        output = op->getOutput(0);
+        if (!op->isDead()) {
+            runOperator(op);
+            i++;
+        } else {
+            for (int skipTo = plan[i].skipTo; i < skipTo; i++) {
+                for (auto tensor : plan[i].op->getOutputs())
+                    tensor->setDead();
+            }
+        }
+        output = plan[i - 1].op->getOutput(0);
         dout(2) << *output << "\n";
     }
     return output;
 }
 
-void Scheduler::maybeRunOperator(Operator* op) {
-    if (!op->isDead()) {
+void Scheduler::runOperator(Operator* op) {
+    if (profiler) {
+        profiler->beginOperator();
         op->run();
+        profiler->endOperator(op);
     } else {
-        for (auto output : op->getOutputs())
-            output->setDead();
-    }
-}
-
-void Scheduler::updateChildren(Operator* op) {
-    const Graph& graph = network->getGraph();
-    Vertex vertex = op->getVertex();
-    out_edge_iter outEdgeIt, outEdgeEnd;
-    for (boost::tie(outEdgeIt, outEdgeEnd) = out_edges(vertex, graph);
-         outEdgeIt != outEdgeEnd;
-         ++outEdgeIt) {
-        Vertex childVertex = target(*outEdgeIt, graph);
-        Operator* child = get(boost::vertex_op, graph, childVertex);
-        if (child->getNumPendingInputs() > 0) {
-            child->decrNumPendingInputs();
-            if (child->getNumPendingInputs() == 0)
-                readyQueue.push_back(child);
-        }
+        op->run();
     }
+    // The tiles of the outputs, wherever they are inputs of later Operators,
+    // hold the data of the previous run. Data tensors are never written.
+    if (op->getOpType() == OpType::Data)
+        return;
+    for (int i = 0; i < op->getOutputs().size(); i++)
+        op->getOutput(i)->markDataChanged();
 }
 
 }  // namespace smaug
@@ -1,8 +1,13 @@
-#include <list>
+#ifndef _CORE_SCHEDULER_H_
+#define _CORE_SCHEDULER_H_
+
+#include <vector>
 
 #include "smaug/core/network.h"
 #include "smaug/core/workspace.h"
 #include "smaug/core/operator.h"
+#include "smaug/core/roofline.h"
+#include "smaug/core/scheduling_policy.h"
 
 namespace smaug {
 
@@ -12,38 +17,122 @@ namespace smaug {
 class Scheduler {
    public:
     Scheduler(Network* _network, Workspace* _workspace)
-            : network(_network), workspace(_workspace) {}
+            : network(_network), workspace(_workspace), profiler(nullptr),
+              policy(nullptr), inPlace(false) {}
     virtual ~Scheduler(){};
-    /** Runs the Network to completion. The final output tensor is returned. */
+    /**
+     * Runs the Network to completion. The final output tensor is returned.
+     *
+     * This is equivalent to tileNetwork() followed by executeNetwork(), and
+     * can be called repeatedly on the same Network.
+     */
     Tensor* runNetwork();
 
+    /**
+     * Tiles every Operator in the Network. With in-place execution on, this
+     * first lets Operators share storage between outputs and dead inputs.
+     */
+    void tileNetwork();
+
+    /**
+     * Runs all the Operators of an already tiled Network in dependency order.
+     * The final output tensor is returned.
+     *
+     * The first call ends the fast-forwarded (model loading and tiling) part
+     * of the simulation and starts the thread pool. It also compiles the
+     * execution plan, unless compileNetwork() was called already.
+     */
+    Tensor* executeNetwork();
+
+    /**
+     * Lowers the Network into a flat execution plan: all the Operators in the
+     * order they will run, with their tensors resolved, so that running the
+     * Network is a linear walk over an array instead of a graph traversal.
+     * Whenever several Operators are ready, the SchedulingPolicy picks the
+     * one to run next.
+     *
+     * executeNetwork() calls this when there is no plan yet or the number of
+     * Operators changed. It must be called again if the Network is modified
+     * in any other way.
+     */
+    void compileNetwork();
+
+    /**
+     * Attach a RooflineProfiler that will record every Operator this
+     * Scheduler runs. The Scheduler does not take ownership of it.
+     */
+    void setProfiler(RooflineProfiler* _profiler) { profiler = _profiler; }
+
+    /**
+     * Set the SchedulingPolicy that orders the Operators that are ready at
+     * the same time, and drop the current execution plan. Without a policy,
+     * they run in the order they became ready. The Scheduler does not take
+     * ownership of it.
+     */
+    void setPolicy(SchedulingPolicy* _policy) {
+        policy = _policy;
+        plan.clear();
+    }
+
+    /**
+     * Turn in-place execution on or off. When it is on, every Operator that
+     * supports it writes its output over an input of the same shape and type
+     * that no other Operator reads and that is not Data, so the input's
+     * storage is reused instead of a new buffer being written. This takes
+     * effect at the next tileNetwork(), and cannot be undone by turning it
+     * off again.
+     */
+    void setInPlace(bool _inPlace) { inPlace = _inPlace; }
+
    protected:
+    /** An Operator in the execution plan. */
+    struct PlannedOperator {
+        Operator* op;
+        /**
+         * The plan index of the first Operator that could still be alive if
+         * this one is dead. All the Operators in between depend on this one
+         * through operators that die with any of their inputs, so if this
+         * Operator is dead, they are all skipped.
+         */
+        int skipTo;
+    };
+
     /**
-     * Runs the operators in the ready queue. This may add new operators to
-     * the ready queue by calling updateChildren().
+     * Runs the Operators of the execution plan in order. An Operator runs if
+     * none of its inputs are dead; otherwise, it and the Operators up to its
+     * skip target are skipped, and their outputs are marked as dead tensors.
+     * The only exception is MergeOp, which can run with dead inputs.
      */
-    Tensor* scheduleReady();
+    Tensor* runPlan();
 
     /**
-     * If none of the inputs to the current Operator are dead, then this will
-     * run the Operator; otherwise, otherwise, all of the Operator's outputs
-     * will be marked as dead tensors. The only exception is MergeOp, which can
-     * run with dead inputs.
+     * Ends the fast-forwarded part of the simulation and starts the thread
+     * pool, unless that was done already.
      */
-    void maybeRunOperator(Operator* op);
+    void endFastForward();
+
+    /** Runs an Operator, recording it in the profiler if there is one. */
+    void runOperator(Operator* op);
+
+    /** Fills in the skip target of every Operator in the plan. */
+    void computeSkipTargets(const std::vector<int>& lastParents);
 
     /**
-     * After an Operator is run, this updates the number of pending inputs on
-     * all its children. Any child Operator with no more pending inputs is then
-     * added to the ready queue.
+     * Makes the output of every Operator that supports in-place execution
+     * share the storage of one of its inputs that dies with it.
      */
-    void updateChildren(Operator* op);
+    void planInPlace();
 
     Network* network;
     Workspace* workspace;
+    RooflineProfiler* profiler;
+    SchedulingPolicy* policy;
+    bool inPlace;
 
-    /** The queue of all Operators ready to be executed. */
-    std::list<Operator*> readyQueue;
+    /** The Operators of the Network in the order they run. */
+    std::vector<PlannedOperator> plan;
 };
 
 }  // namespace smaug
+
+#endif
@@ -0,0 +1,249 @@
+#include "catch.hpp"
+#include "smaug/core/backend.h"
+#include "smaug/core/roofline.h"
+#include "smaug/core/scheduler.h"
+#include "smaug/core/scheduling_policy.h"
+#include "smaug/core/smaug_test.h"
+#include "smaug/core/tensor.h"
+#include "smaug/operators/control_flow_ops.h"
+#include "smaug/operators/data_op.h"
+#include "smaug/operators/eltwise_add_op.h"
+#include "smaug/operators/relu_op.h"
+
+using namespace smaug;
+
+/** Exposes the execution plan of a Scheduler. */
+class PlanInspector : public Scheduler {
+   public:
+    PlanInspector(Network* network, Workspace* workspace)
+            : Scheduler(network, workspace) {}
+
+    int planSize() const { return plan.size(); }
+    const std::string& opName(int i) const { return plan.at(i).op->getName(); }
+    int skipTo(int i) const { return plan.at(i).skipTo; }
+};
+
+TEST_CASE_METHOD(SmaugTest, "Execution plan", "[scheduler]") {
+    // input --> switch --(false)--> false_relu --------------> merge
+    //  pred -->        \--(true)--> true_relu --> true_relu2 -->/
+    TensorShape shape({ 1, 2, 2, 2 }, DataLayout::NCHW);
+    Tensor* input = workspace()->addTensor(new Tensor("input", shape));
+    Tensor* pred = workspace()->addTensor(
+            new Tensor("pred", TensorShape({ 1 }, DataLayout::N)));
+    input->allocateStorage<float>();
+    pred->allocateStorage<bool>();
+    std::vector<float> inputValues{ -4, -2, -1, 0, 1, 2, 3, 4 };
+    input->fillData(inputValues.data(), inputValues.size());
+
+    auto inputOp = new DataOp<ReferenceBackend>("input", workspace());
+    auto predOp = new DataOp<ReferenceBackend>("pred", workspace());
+    inputOp->setData(input);
+    predOp->setData(pred);
+    auto switchOp = new SwitchOp<ReferenceBackend>("switch", workspace());
+    switchOp->setInput(input, 0);
+    switchOp->setInput(pred, 1);
+    switchOp->createAllTensors();
+    allocateAllTensors<float>(switchOp);
+    auto falseRelu =
+            new ReluOp<ReferenceBackend>("false_relu", workspace(), 0.5);
+    falseRelu->setInput(switchOp->getOutput(0), 0);
+    falseRelu->createAllTensors();
+    falseRelu->getOutput(0)->allocateStorage<float>();
+    auto trueRelu = new ReluOp<ReferenceBackend>("true_relu", workspace());
+    trueRelu->setInput(switchOp->getOutput(1), 0);
+    trueRelu->createAllTensors();
+    trueRelu->getOutput(0)->allocateStorage<float>();
+    auto trueRelu2 = new ReluOp<ReferenceBackend>("true_relu2", workspace());
+    trueRelu2->setInput(trueRelu->getOutput(0), 0);
+    trueRelu2->createAllTensors();
+    trueRelu2->getOutput(0)->allocateStorage<float>();
+    auto mergeOp = new MergeOp<ReferenceBackend>("merge", workspace());
+    mergeOp->setNumInputs(2);
+    mergeOp->setInput(falseRelu->getOutput(0), 0);
+    mergeOp->setInput(trueRelu2->getOutput(0), 1);
+    mergeOp->createAllTensors();
+    mergeOp->getOutput(0)->allocateStorage<float>();
+
+    Network* net = network();
+    for (Operator* op : std::vector<Operator*>{ inputOp, predOp, switchOp,
+                                                falseRelu, trueRelu, trueRelu2,
+                                                mergeOp })
+        net->addOperator(op);
+    net->addEdge(inputOp, switchOp, { 0, 0 });
+    net->addEdge(predOp, switchOp, { 0, 1 });
+    net->addEdge(switchOp, falseRelu, { 0, 0 });
+    net->addEdge(switchOp, trueRelu, { 1, 0 });
+    net->addEdge(trueRelu, trueRelu2, { 0, 0 });
+    net->addEdge(falseRelu, mergeOp, { 0, 0 });
+    net->addEdge(trueRelu2, mergeOp, { 0, 1 });
+
+    PlanInspector scheduler(net, workspace());
+    scheduler.compileNetwork();
+
+    SECTION("Operators are planned in FIFO ready order") {
+        std::vector<std::string> expectedOrder{
+            "input",     "pred",       "switch", "false_relu",
+            "true_relu", "true_relu2", "merge"
+        };
+        REQUIRE(scheduler.planSize() == expectedOrder.size());
+        for (int i = 0; i < expectedOrder.size(); i++)
+            REQUIRE(scheduler.opName(i) == expectedOrder[i]);
+    }
+
+    SECTION("Dead branches are skipped up to the merge") {
+        std::vector<int> expectedSkipTo{ 1, 6, 6, 4, 6, 6, 7 };
+        for (int i = 0; i < expectedSkipTo.size(); i++)
+            REQUIRE(scheduler.skipTo(i) == expectedSkipTo[i]);
+    }
+
+    SECTION("Running the plan takes the live branch on every run") {
+        std::vector<float> trueValues{ 0, 0, 0, 0, 1, 2, 3, 4 };
+        std::vector<float> falseValues{ -2, -1, -0.5, 0, 1, 2, 3, 4 };
+        for (bool predValue : { true, false, true }) {
+            pred->fillData({ predValue });
+            Tensor* output = scheduler.executeNetwork();
+            REQUIRE(output == mergeOp->getOutput(0));
+            REQUIRE(falseRelu->getOutput(0)->isDead() == predValue);
+            REQUIRE(trueRelu->getOutput(0)->isDead() == !predValue);
+            REQUIRE(trueRelu2->getOutput(0)->isDead() == !predValue);
+            REQUIRE(!output->isDead());
+            const std::vector<float>& expected =
+                    predValue ? trueValues : falseValues;
+            float* outputData = output->data<float>();
+            for (int i = 0; i < expected.size(); i++)
+                REQUIRE(outputData[i] == Approx(expected[i]));
+        }
+    }
+}
+
+TEST_CASE_METHOD(SmaugTest, "Scheduling policies", "[scheduler]") {
+    // A cheap branch, a --> a_relu, next to an expensive chain, b --> b_relu
+    // --> b_relu2.
+    Network* net = network();
+    auto addRelus = [&](const std::string& name, int size, int chainLength) {
+        Tensor* data = workspace()->addTensor(
+                new Tensor(name, TensorShape({ 1, size }, DataLayout::NC)));
+        data->allocateStorage<float>();
+        auto dataOp = new DataOp<ReferenceBackend>(name, workspace());
+        dataOp->setData(data);
+        net->addOperator(dataOp);
+        Operator* parent = dataOp;
+        for (int i = 0; i < chainLength; i++) {
+            std::string reluName = name + "_relu" + (i ? "2" : "");
+            auto reluOp = new ReluOp<ReferenceBackend>(reluName, workspace());
+            reluOp->setInput(parent->getOutput(0), 0);
+            reluOp->createAllTensors();
+            reluOp->getOutput(0)->allocateStorage<float>();
+            net->addOperator(reluOp);
+            net->addEdge(parent, reluOp, { 0, 0 });
+            parent = reluOp;
+        }
+    };
+    addRelus("a", 8, 1);
+    addRelus("b", 4096, 2);
+
+    PlanInspector scheduler(net, workspace());
+    auto checkOrder = [&](const std::vector<std::string>& expectedOrder) {
+        scheduler.compileNetwork();
+        REQUIRE(scheduler.planSize() == expectedOrder.size());
+        for (int i = 0; i < expectedOrder.size(); i++)
+            REQUIRE(scheduler.opName(i) == expectedOrder[i]);
+    };
+
+    SECTION("FIFO runs operators in the order they became ready") {
+        checkOrder({ "a", "b", "a_relu", "b_relu", "b_relu2" });
+        FifoPolicy policy;
+        scheduler.setPolicy(&policy);
+        checkOrder({ "a", "b", "a_relu", "b_relu", "b_relu2" });
+    }
+
+    SECTION("Critical path runs the longest chain first") {
+        CriticalPathPolicy policy(10, 10);
+        scheduler.setPolicy(&policy);
+        checkOrder({ "b", "b_relu", "b_relu2", "a", "a_relu" });
+        policy.prepare(net);
+        Operator* bRelu = net->getOperator("b_relu");
+        Operator* bRelu2 = net->getOperator("b_relu2");
+        // 16KB read and 16KB written at 10GB/s.
+        REQUIRE(policy.getCost(bRelu) > 2 * 4096 * 4 / 10e9);
+        REQUIRE(policy.getPriority(bRelu) ==
+                Approx(policy.getCost(bRelu) + policy.getCost(bRelu2)));
+    }
+
+    SECTION("Critical path uses the measured costs of a profiled run") {
+        RooflineProfiler profiler;
+        scheduler.setProfiler(&profiler);
+        scheduler.executeNetwork();
+        CriticalPathPolicy policy;
+        policy.setProfile(profiler);
+        std::map<const Operator*, double> measured =
+                profiler.getOperatorSeconds();
+        REQUIRE(measured.size() == 5);
+        for (auto& opSeconds : measured)
+            REQUIRE(policy.getCost(opSeconds.first) == opSeconds.second);
+    }
+}
+
+TEST_CASE_METHOD(SmaugTest, "In-place execution", "[scheduler]") {
+    // input --> relu --> relu2 --> add
+    //   \-------------------------/
+    TensorShape shape({ 1, 8 }, DataLayout::NC);
+    Tensor* input = workspace()->addTensor(new Tensor("input", shape));
+    input->allocateStorage<float>();
+    std::vector<float> inputValues{ -4, -2, -1, 0, 1, 2, 3, 4 };
+    input->fillData(inputValues.data(), inputValues.size());
+    auto inputOp = new DataOp<ReferenceBackend>("input", workspace());
+    inputOp->setData(input);
+    auto relu = new ReluOp<ReferenceBackend>("relu", workspace());
+    relu->setInput(input, 0);
+    relu->createAllTensors();
+    relu->getOutput(0)->allocateStorage<float>();
+    auto relu2 = new ReluOp<ReferenceBackend>("relu2", workspace());
+    relu2->setInput(relu->getOutput(0), 0);
+    relu2->createAllTensors();
+    relu2->getOutput(0)->allocateStorage<float>();
+    auto add = new EltwiseAddOp<ReferenceBackend>("add", workspace());
+    add->setInput(relu2->getOutput(0), 0);
+    add->setInput(input, 1);
+    add->createAllTensors();
+    add->getOutput(0)->allocateStorage<float>();
+
+    Network* net = network();
+    for (Operator* op : std::vector<Operator*>{ inputOp, relu, relu2, add })
+        net->addOperator(op);
+    net->addEdge(inputOp, relu, { 0, 0 });
+    net->addEdge(relu, relu2, { 0, 0 });
+    net->addEdge(relu2, add, { 0, 0 });
+    net->addEdge(inputOp, add, { 0, 1 });
+
+    Scheduler scheduler(net, workspace());
+    std::vector<float> expected{ -4, -2, -1, 0, 2, 4, 6, 8 };
+    auto checkOutput = [&]() {
+        Tensor* output = scheduler.runNetwork();
+        REQUIRE(output == add->getOutput(0));
+        float* outputData = output->data<float>();
+        for (int i = 0; i < expected.size(); i++)
+            REQUIRE(outputData[i] == expected[i]);
+    };
+
+    SECTION("Outputs have their own storage by default") {
+        checkOutput();
+        REQUIRE(relu2->getOutput(0)->rawData() !=
+                relu->getOutput(0)->rawData());
+        REQUIRE(add->getOutput(0)->rawData() !=
+                relu2->getOutput(0)->rawData());
+    }
+
+    SECTION("Outputs share the storage of inputs that die with them") {
+        scheduler.setInPlace(true);
+        // Running the network twice checks that the Data input is intact.
+        checkOutput();
+        checkOutput();
+        // The Data tensor is never written over.
+        REQUIRE(relu->getOutput(0)->rawData() != input->rawData());
+        REQUIRE(relu2->getOutput(0)->rawData() ==
+                relu->getOutput(0)->rawData());
+        REQUIRE(add->getOutput(0)->rawData() ==
+                relu2->getOutput(0)->rawData());
+    }
+}
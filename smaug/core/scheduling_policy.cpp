@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <iterator>
+
+#include "smaug/core/scheduling_policy.h"
+
+namespace smaug {
+
+/**
+ * The fixed cost of running any Operator, in seconds. This makes a chain of
+ * Operators that do next to no work still count for its length.
+ */
+static constexpr double kOperatorOverheadSeconds = 1e-6;
+
+CriticalPathPolicy::CriticalPathPolicy(double _peakGflops, double _peakGbps)
+        : peakGflops(_peakGflops), peakGbps(_peakGbps) {
+    if (peakGflops <= 0 || peakGbps <= 0)
+        peakGflops = peakGbps = 1;
+}
+
+void CriticalPathPolicy::setProfile(const RooflineProfiler& profiler) {
+    measuredSeconds = profiler.getOperatorSeconds();
+}
+
+double CriticalPathPolicy::getCost(const Operator* op) const {
+    auto measured = measuredSeconds.find(op);
+    if (measured != measuredSeconds.end())
+        return measured->second;
+    double computeSeconds = op->getNumFlops() / (peakGflops * 1e9);
+    double memorySeconds =
+            (op->getBytesRead() + op->getBytesWritten()) / (peakGbps * 1e9);
+    return kOperatorOverheadSeconds + std::max(computeSeconds, memorySeconds);
+}
+
+void CriticalPathPolicy::prepare(const Network* network) {
+    const Graph& graph = network->getGraph();
+    // The topological sort comes out in reverse, so every Operator is visited
+    // after all its children.
+    std::vector<Vertex> vertices;
+    boost::topological_sort(graph, std::back_inserter(vertices));
+    ranks.assign(boost::num_vertices(graph), 0);
+    for (Vertex vertex : vertices) {
+        double longestChild = 0;
+        out_edge_iter outEdgeIt, outEdgeEnd;
+        for (boost::tie(outEdgeIt, outEdgeEnd) = out_edges(vertex, graph);
+             outEdgeIt != outEdgeEnd;
+             ++outEdgeIt) {
+            longestChild =
+                    std::max(longestChild, ranks[target(*outEdgeIt, graph)]);
+        }
+        ranks[vertex] =
+                getCost(get(boost::vertex_op, graph, vertex)) + longestChild;
+    }
+}
+
+double CriticalPathPolicy::getPriority(const Operator* op) const {
+    return ranks.at(op->getVertex());
+}
+
+}  // namespace smaug
@@ -0,0 +1,87 @@
+#ifndef _CORE_SCHEDULING_POLICY_H_
+#define _CORE_SCHEDULING_POLICY_H_
+
+#include <map>
+#include <vector>
+
+#include "smaug/core/network.h"
+#include "smaug/core/operator.h"
+#include "smaug/core/roofline.h"
+
+namespace smaug {
+
+/**
+ * SchedulingPolicy decides which of the Operators that are ready at the same
+ * time the Scheduler runs first.
+ *
+ * The Scheduler calls prepare() once before it plans the Network, and then
+ * repeatedly picks the ready Operator with the highest priority. Operators
+ * with equal priorities run in the order they became ready.
+ */
+class SchedulingPolicy {
+   public:
+    virtual ~SchedulingPolicy() {}
+
+    /** Computes whatever the priorities of the Network's Operators need. */
+    virtual void prepare(const Network* network) {}
+
+    /** Returns the priority of a ready Operator. Higher runs first. */
+    virtual double getPriority(const Operator* op) const = 0;
+};
+
+/**
+ * Runs the ready Operators in the order they became ready. This is what the
+ * Scheduler does without a policy.
+ */
+class FifoPolicy : public SchedulingPolicy {
+   public:
+    double getPriority(const Operator* op) const override { return 0; }
+};
+
+/**
+ * Prioritizes the Operators on the longest remaining path to the end of the
+ * Network, as HEFT does: the priority of an Operator is its own estimated
+ * cost plus the highest priority of its children. This keeps long chains of
+ * Operators from starving behind cheap side branches.
+ *
+ * The cost of an Operator is its measured time from a profiled run if there
+ * is one, and otherwise a roofline estimate from its FLOP and byte counts.
+ */
+class CriticalPathPolicy : public SchedulingPolicy {
+   public:
+    /**
+     * Create a policy for a target with the given peaks.
+     *
+     * @param _peakGflops Peak compute throughput of the target, in GFLOP/s.
+     * @param _peakGbps Peak memory bandwidth of the target, in GB/s.
+     *
+     * If either peak is zero, one FLOP and one byte are taken to cost the
+     * same.
+     */
+    CriticalPathPolicy(double _peakGflops = 0, double _peakGbps = 0);
+
+    /**
+     * Use the measured times of a profiled run as the costs of the Operators
+     * it ran.
+     */
+    void setProfile(const RooflineProfiler& profiler);
+
+    void prepare(const Network* network) override;
+
+    double getPriority(const Operator* op) const override;
+
+    /** Returns the estimated cost of an Operator, in seconds. */
+    double getCost(const Operator* op) const;
+
+   protected:
+    double peakGflops;
+    double peakGbps;
+    /** Measured Operator times from a profiled run, in seconds. */
+    std::map<const Operator*, double> measuredSeconds;
+    /** The priority of every Operator, indexed by vertex. */
+    std::vector<double> ranks;
+};
+
+}  // namespace smaug
+
+#endif
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+#include <boost/format.hpp>
+
+#include "smaug/core/smaug_bench.h"
+
+namespace smaug {
+
+static const char* kBenchHeaderFormat =
+        "%-48s %6s %12s %12s %9s %10s %10s\n";
+static const char* kBenchRowFormat =
+        "%-48s %6d %12.4f %12.4f %8.1f%% %10.3f %10.3f\n";
+
+SmaugBenchmark::SmaugBenchmark(int argc, char* argv[])
+        : reps(20), warmup(3), out(std::cout) {
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--reps") == 0 && hasValue) {
+            reps = std::max(1, atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--warmup") == 0 && hasValue) {
+            warmup = std::max(0, atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--filter") == 0 && hasValue) {
+            filter = argv[++i];
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--reps N] [--warmup N] [--filter substring]\n";
+            exit(1);
+        }
+    }
+}
+
+void SmaugBenchmark::printHeader(const std::string& title) {
+    static const std::string hline(
+            "______________________________________________"
+            "______________________________________________"
+            "________________");
+    out << hline << "\n" << title << "\n" << hline << "\n";
+    out << boost::format(kBenchHeaderFormat) % "Benchmark" % "Reps" %
+                    "Median (ms)" % "Min (ms)" % "Stddev" % "GFLOP/s" %
+                    "GB/s";
+}
+
+BenchmarkStats SmaugBenchmark::run(const std::string& name,
+                                   int64_t flops,
+                                   int64_t bytes,
+                                   const std::function<void()>& fn) {
+    BenchmarkStats stats = { 0, 0, 0, 0, 0 };
+    if (!filter.empty() && name.find(filter) == std::string::npos)
+        return stats;
+
+    for (int i = 0; i < warmup; i++)
+        fn();
+    std::vector<double> samples(reps);
+    for (int i = 0; i < reps; i++) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        samples[i] =
+                std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double sample : samples)
+        sum += sample;
+    stats.reps = reps;
+    stats.minMs = samples.front();
+    stats.meanMs = sum / reps;
+    stats.medianMs = reps % 2 ? samples[reps / 2]
+                              : (samples[reps / 2 - 1] + samples[reps / 2]) / 2;
+    double variance = 0;
+    for (double sample : samples)
+        variance += (sample - stats.meanMs) * (sample - stats.meanMs);
+    stats.stddevMs = std::sqrt(variance / reps);
+
+    double seconds = stats.medianMs / 1e3;
+    double gflops = seconds > 0 ? flops / seconds / 1e9 : 0;
+    double gbps = seconds > 0 ? bytes / seconds / 1e9 : 0;
+    double relStddev =
+            stats.meanMs > 0 ? 100 * stats.stddevMs / stats.meanMs : 0;
+    out << boost::format(kBenchRowFormat) % name % reps % stats.medianMs %
+                    stats.minMs % relStddev % gflops % gbps;
+    return stats;
+}
+
+}  // namespace smaug
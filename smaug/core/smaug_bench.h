@@ -0,0 +1,70 @@
+/**
+ * \file smaug_bench.h
+ * \brief SMAUG micro-benchmark harness.
+ */
+
+#ifndef _CORE_SMAUG_BENCH_H_
+#define _CORE_SMAUG_BENCH_H_
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace smaug {
+
+/** Timing statistics of one benchmark, in milliseconds. */
+struct BenchmarkStats {
+    int reps;
+    double minMs;
+    double medianMs;
+    double meanMs;
+    double stddevMs;
+};
+
+/**
+ * The harness used by all kernel micro-benchmarks.
+ *
+ * Each benchmark is a callable that performs one unit of work, along with the
+ * number of arithmetic operations and bytes that unit of work moves. The
+ * harness runs a few untimed warmup iterations, then times the callable
+ * repeatedly and prints one row per benchmark with the median time, the
+ * spread, and the derived GFLOP/s and GB/s.
+ *
+ * Benchmark binaries accept the following options:
+ *   --reps N     Number of timed repetitions (default 20).
+ *   --warmup N   Number of untimed warmup runs (default 3).
+ *   --filter S   Only run benchmarks whose name contains S.
+ */
+class SmaugBenchmark {
+   public:
+    SmaugBenchmark(int argc, char* argv[]);
+
+    /**
+     * Runs and reports one benchmark.
+     *
+     * @param name A unique name, usually the kernel name followed by the
+     *        shape.
+     * @param flops Arithmetic operations per call of fn.
+     * @param bytes Bytes read and written per call of fn.
+     * @param fn The work to time.
+     */
+    BenchmarkStats run(const std::string& name,
+                       int64_t flops,
+                       int64_t bytes,
+                       const std::function<void()>& fn);
+
+    /** Prints a section header followed by the column names. */
+    void printHeader(const std::string& title);
+
+   protected:
+    int reps;
+    int warmup;
+    std::string filter;
+    std::ostream& out;
+};
+
+}  // namespace smaug
+
+#endif
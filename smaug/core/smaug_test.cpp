@@ -1,8 +1,15 @@
+#include <cassert>
+#include <cstdlib>
+#include <filesystem>
+
 #include "fp16.h"
 #include "smaug/core/datatypes.h"
+#include "smaug/core/globals.h"
 #include "smaug/core/network_builder.h"
+#include "smaug/core/operator.h"
 #include "smaug/core/scheduler.h"
 #include "smaug/core/smaug_test.h"
+#include "smaug/utility/thread_pool.h"
 
 namespace smaug {
 
@@ -18,6 +25,22 @@ Network* SmaugTest::buildNetwork(const std::string& modelTopo,
     return network_;
 }
 
+void SmaugTest::verifyThreadedRun(Operator* op, int numThreads) {
+    assert(!threadPool && "A thread pool is in use already!");
+    op->run();
+    Tensor* output = op->getOutput(0);
+    std::vector<float> expected;
+    for (auto idx = output->startIndex(); !idx.end(); ++idx)
+        expected.push_back(output->data<float>()[idx]);
+
+    threadPool = new ThreadPool(numThreads);
+    threadPool->initThreadPool();
+    op->run();
+    delete threadPool;
+    threadPool = nullptr;
+    verifyOutputs(output, expected);
+}
+
 Tensor* SmaugTest::buildAndRunNetwork(const std::string& modelTopo,
                                       const std::string& modelParams) {
     buildNetwork(modelTopo, modelParams);
@@ -25,6 +48,17 @@ Tensor* SmaugTest::buildAndRunNetwork(const std::string& modelTopo,
     return scheduler.runNetwork();
 }
 
+TempDir::TempDir() {
+    std::string pattern =
+            (std::filesystem::temp_directory_path() / "smaug_test.XXXXXX")
+                    .string();
+    if (!mkdtemp(&pattern[0]))
+        assert(false && "Failed to create a temporary directory.");
+    path = pattern;
+}
+
+TempDir::~TempDir() { std::filesystem::remove_all(path); }
+
 // We can't directly compare with float16 values, so convert to float32.
 template <>
 void SmaugTest::verifyOutputs<float16>(Tensor* output, Tensor* expected) {
@@ -39,6 +73,12 @@ void SmaugTest::verifyOutputs<float16>(Tensor* output, Tensor* expected) {
     }
 }
 
+void fillTensorWithSteps(Tensor* tensor) {
+    float* data = tensor->data<float>();
+    for (int i = 0; i < tensor->getShape().storageSize(); i++)
+        data[i] = (i % 7) - 3;
+}
+
 float16 fp16(float fp32_data) {
     return fp16_ieee_from_fp32_value(fp32_data);
 }
@@ -10,6 +10,7 @@
 #include "smaug/core/backend.h"
 #include "smaug/core/tensor.h"
 #include "smaug/core/workspace.h"
+#include "smaug/operators/smv/smv_tiling_common.h"
 
 namespace smaug {
 
@@ -39,6 +40,10 @@ class Operator;
  * This fixture encapsulates a Network and Workspace, and exposes a set of
  * useful functions for writing unit tests, like filling Tensors with random
  * data and verifying approximate equality of two Tensors.
+ *
+ * Tests may change the backend globals, like the number of accelerators, the
+ * scratchpad sizes and the SMV tiling objective; the fixture restores them
+ * when the test ends, even if it fails.
  */
 class SmaugTest {
    public:
@@ -50,12 +55,15 @@ class SmaugTest {
         runningInSimulation = false;
         useSystolicArrayWhenAvailable = false;
         numAcceleratorsAvailable = 1;
+        smv::tilingObjective = smv::MaxSpadUtilization;
     }
 
     ~SmaugTest() {
         delete network_;
         delete workspace_;
         SmvBackend::freeGlobals();
+        numAcceleratorsAvailable = 1;
+        smv::tilingObjective = smv::MaxSpadUtilization;
     }
 
     /**
@@ -135,6 +143,13 @@ class SmaugTest {
         }
     }
 
+    /**
+     * Runs the Operator serially, then again on a thread pool of the given
+     * size, and asserts (REQUIRE) that both runs give the same float32
+     * output. The Operator's inputs must be filled already.
+     */
+    void verifyThreadedRun(Operator* op, int numThreads = 3);
+
     Network* buildNetwork(const std::string& modelTopo,
                           const std::string& modelParams);
     Tensor* buildAndRunNetwork(const std::string& modelTopo,
@@ -167,6 +182,31 @@ class SmaugTest {
     Workspace* workspace_;
 };
 
+/**
+ * A temporary directory for the files that a test writes. It is removed with
+ * everything in it when it goes out of scope, so the files are cleaned up
+ * even when a REQUIRE fails.
+ */
+class TempDir {
+   public:
+    TempDir();
+    ~TempDir();
+
+    /** Returns the path of a file in the directory. */
+    std::string file(const std::string& name) const {
+        return path + '/' + name;
+    }
+
+   protected:
+    std::string path;
+};
+
+/**
+ * Fills a float32 Tensor with a short repeating sequence of small integers,
+ * for tests that only compare two ways of computing the same result.
+ */
+void fillTensorWithSteps(Tensor* tensor);
+
 /** This converts a float32 into a float16. */
 float16 fp16(float fp32_data);
 
@@ -1,6 +1,9 @@
 #include "smaug/core/tensor.h"
 #include "smaug/core/tensor_utils.h"
 #include "smaug/core/globals.h"
+#include "smaug/core/roofline.h"
+#include "smaug/operators/common.h"
+#include "smaug/utility/task_thread.h"
 #include "smaug/utility/thread_pool.h"
 
 namespace smaug {
@@ -62,12 +65,106 @@ TensorProto* Tensor::asTensorProto() {
     return tensorProto;
 }
 
+namespace {
+
+/** The helper thread that prefetches tiles for all TiledTensors. */
+TaskThread* getTilePrefetchThread() {
+    static TaskThread prefetchThread;
+    return &prefetchThread;
+}
+
+}  // namespace
+
+void TiledTensor::dropStaleTiles() {
+    if (getOrigDataVersion() == filledVersion)
+        return;
+    waitForPrefetches();
+    for (auto& tile : tiles)
+        tile.hasData = false;
+    dataFilled = false;
+    filledVersion = getOrigDataVersion();
+}
+
 Tensor* TiledTensor::getTileWithData(int index) {
+    dropStaleTiles();
     Tile* tile = &tiles[index];
+    if (tile->prefetchTicket) {
+        getTilePrefetchThread()->wait(tile->prefetchTicket);
+        tile->prefetchTicket = 0;
+    }
     copyDataToTile(tile);
     return tile->tensor;
 }
 
+void TiledTensor::prefetchTile(int index) {
+    dropStaleTiles();
+    Tile* tile = &tiles[index];
+    // While a prefetch is pending, the helper thread may be writing hasData,
+    // so it may only be read once there is no ticket.
+    if (tile->prefetchTicket || tile->hasData || sharesOrigStorage(tile))
+        return;
+    tile->prefetchTicket = getTilePrefetchThread()->enqueue(
+            [this, tile]() { copyDataToTile(tile); });
+}
+
+void TiledTensor::waitForPrefetches() {
+    for (auto& tile : tiles) {
+        if (tile.prefetchTicket) {
+            getTilePrefetchThread()->wait(tile.prefetchTicket);
+            tile.prefetchTicket = 0;
+        }
+    }
+}
+
+void TiledTensor::packTiles(const std::shared_ptr<void>& packed) {
+    assert(origTensor != nullptr &&
+           "TiledTensor must have the original tensor to pack data from!");
+    waitForPrefetches();
+    // Lay the tiles out one after another. A tile that is the original tensor
+    // or a view of it keeps the original tensor's storage.
+    int elementSize = origTensor->getDataTypeSize();
+    std::vector<size_t> offsets(tiles.size(), 0);
+    size_t packedSize = 0;
+    for (int i = 0; i < tiles.size(); i++) {
+        if (sharesOrigStorage(&tiles[i]))
+            continue;
+        offsets[i] = packedSize;
+        packedSize += next_multiple(
+                tiles[i].tensor->getShape().storageSize() * elementSize,
+                CACHELINE_SIZE);
+    }
+    if (packedSize == 0)
+        return;
+    packedData = packed ? packed
+                        : std::shared_ptr<void>(malloc_aligned(packedSize), free);
+    char* packedPtr = reinterpret_cast<char*>(packedData.get());
+    for (int i = 0; i < tiles.size(); i++) {
+        Tile* tile = &tiles[i];
+        if (sharesOrigStorage(tile))
+            continue;
+        tile->tensor->setExternalStorage(
+                packedData, packedPtr + offsets[i], origTensor->getDataType());
+        tile->hasData = packed != nullptr;
+    }
+    if (packed) {
+        // The buffer already holds the tiles' data.
+        dataFilled = true;
+        filledVersion = getOrigDataVersion();
+        return;
+    }
+    dataFilled = false;
+    copyDataToAllTiles();
+}
+
+void TiledTensor::gatherTile(int index) {
+    Tile* tile = &tiles[index];
+    // No need to copy data if the tile is the original tensor or a view of it.
+    if (sharesOrigStorage(tile))
+        return;
+    gatherDataFromTile(tile);
+    tile->gathered = true;
+}
+
 void TiledTensor::setTile(int index,
                           const std::vector<int>& origin,
                           Tensor* tensor,
@@ -76,50 +173,44 @@ void TiledTensor::setTile(int index,
     tile->tensor = tensor;
     tile->origin = origin;
     tile->hasOrigin = true;
+    tile->isView = false;
+    if (origTensor && tensor != origTensor && origTensor->containsData() &&
+        tensor->containsData()) {
+        const char* origData =
+                reinterpret_cast<const char*>(origTensor->rawData());
+        const char* tileData = reinterpret_cast<const char*>(tensor->rawData());
+        size_t origBytes = (size_t)origTensor->getShape().storageSize() *
+                           origTensor->getDataTypeSize();
+        tile->isView =
+                tileData >= origData && tileData < origData + origBytes;
+    }
     if (copyData)
         copyDataToTile(tile);
 }
 
-void* TiledTensor::tileCopyWorker(void* _args) {
-    auto args = reinterpret_cast<CopyTilesArgs*>(_args);
-    TiledTensor* tiledTensor = args->tiledTensor;
-    int start = args->start;
-    int numTiles = args->numTiles;
-    TileDataOperation op = args->op;
-    for (int i = start; i < start + numTiles; i++) {
-        Tile* tile = tiledTensor->getTile(i);
-        if (op == Scatter)
-            tiledTensor->copyDataToTile(tile);
-        else if (op == Gather)
-            tiledTensor->gatherDataFromTile(tile);
-    }
-    delete args;
-    return nullptr;
-}
-
 void TiledTensor::parallelCopyTileData(TileDataOperation op) {
-    int totalNumTiles = tiles.size();
-    int numTilesPerThread = std::ceil(totalNumTiles * 1.0 / threadPool->size());
-    int remainingTiles = totalNumTiles;
-    while (remainingTiles > 0) {
-        int numTiles = std::min(numTilesPerThread, remainingTiles);
-        auto args = new CopyTilesArgs(
-                this, totalNumTiles - remainingTiles, numTiles, op);
-        int cpuid =
-                threadPool->dispatchThread(tileCopyWorker, (void*)args);
-        assert(cpuid != -1 && "Failed to dispatch thread!");
-        remainingTiles -= numTiles;
-    }
-    threadPool->joinThreadPool();
+    // Tiles at the edges may be much smaller than the others, so every tile
+    // is a task of its own and idle workers steal the remaining ones.
+    threadPool->parallelFor(0, tiles.size(), 1, [&](int start, int end) {
+        for (int i = start; i < end; i++) {
+            Tile* tile = getTile(i);
+            if (op == Scatter)
+                copyDataToTile(tile);
+            else if (op == Gather && !tile->gathered)
+                gatherDataFromTile(tile);
+        }
+    });
 }
 
 void TiledTensor::copyDataToAllTiles() {
+    dropStaleTiles();
     // Don't copy if all the tiles have data filled.
     if (dataFilled)
         return;
 
     assert(origTensor != nullptr &&
            "TiledTensor must have the original tensor to copy data from!");
+    waitForPrefetches();
     if (fastForwardMode || !threadPool || tiles.size() == 1) {
         for (auto index = startIndex(); !index.end(); ++index)
             copyDataToTile(&tiles[index]);
@@ -130,9 +221,9 @@ void TiledTensor::copyDataToAllTiles() {
 }
 
 void TiledTensor::copyDataToTile(Tile* tile) {
-    // Don't copy if the tile already has data,  or if the tile is the original
-    // tensor (we have only one tile).
-    if (tile->hasData || tile->tensor == origTensor)
+    // Don't copy if the tile already has data, or if the tile is the original
+    // tensor (we have only one tile) or a view of it.
+    if (tile->hasData || sharesOrigStorage(tile))
         return;
 
     // Perform the data copy.
@@ -147,9 +238,16 @@ void TiledTensor::copyDataToTile(Tile* tile) {
         copyTensorRegion(tile->tensor, origTensor, dstOrigin, tile->origin,
                          tile->tensor->getShape().dims());
     }
+    roofline::recordTileCopy(getTileCopyBytes(tile));
     tile->hasData = true;
 }
 
+int64_t TiledTensor::getTileCopyBytes(const Tile* tile) const {
+    const TensorShape& shape = tile->tensor->getShape();
+    int64_t elems = useRawTensor ? shape.storageSize() : shape.size();
+    return elems * tile->tensor->getDataTypeSize();
+}
+
 void TiledTensor::untile() {
     assert(origTensor != nullptr &&
            "TiledTensor must have the original tensor to copy data to!");
@@ -161,14 +259,21 @@ void TiledTensor::untile() {
     }
 
     if (fastForwardMode || !threadPool) {
-        for (auto index = startIndex(); !index.end(); ++index)
-            gatherDataFromTile(&tiles[index]);
+        for (auto index = startIndex(); !index.end(); ++index) {
+            if (!tiles[index].gathered)
+                gatherDataFromTile(&tiles[index]);
+        }
     } else {
         parallelCopyTileData(Gather);
     }
+    // The next run of the operator gathers the tiles again.
+    for (auto& tile : tiles)
+        tile.gathered = false;
 }
 
 void TiledTensor::gatherDataFromTile(Tile* tile) {
+    if (sharesOrigStorage(tile))
+        return;
     // Perform the data copy.
     assert(tile->hasOrigin &&
            "Must set the tile's origin in the original tensor!");
@@ -184,6 +289,7 @@ void TiledTensor::gatherDataFromTile(Tile* tile) {
                          srcOrigin,
                          tile->tensor->getShape().dims());
     }
+    roofline::recordTileCopy(getTileCopyBytes(tile));
 }
 
 }  // namespace smaug
@@ -1,6 +1,7 @@
 #ifndef _CORE_TENSOR_H_
 #define _CORE_TENSOR_H_
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <cmath>
@@ -13,6 +14,7 @@
 
 #include "smaug/core/datatypes.h"
 #include "smaug/core/tensor.pb.h"
+#include "smaug/utility/task_thread.h"
 #include "smaug/utility/utils.h"
 
 namespace smaug {
@@ -124,35 +126,72 @@ class TensorShape {
  *   data[iter(3,4,0,0)] = 3.4;
  *
  * The iterator skips over data alignment padding areas, if any exist.
+ *
+ * All the per-dimension state is stored inline, up to kMaxTensorRank
+ * dimensions, and the strides are precomputed, so iterators are cheap to
+ * create, copy and advance.
  */
 class TensorIndexIterator {
    public:
     TensorIndexIterator(const TensorShape& shape, bool _atEnd = false)
-            : dims(shape.dims()), padding(shape.padding()), atEnd(_atEnd),
-              advanceOne(std::vector<int>(dims.size(), 1)) {
-        state.resize(dims.size(), 0);
+            : ndims(shape.ndims()), linearIndex(0), atEnd(_atEnd) {
+        assert(ndims <= kMaxTensorRank &&
+               "The tensor has too many dimensions to iterate over!");
+        int stride = 1;
+        for (int i = ndims - 1; i >= 0; i--) {
+            dims[i] = shape[i];
+            strides[i] = stride;
+            stride *= shape.getStorageDim(i);
+            state[i] = 0;
+            origin[i] = 0;
+            regionEnd[i] = dims[i];
+        }
     }
 
-    operator int() const { return getIndex(state); }
+    /** The highest number of dimensions of a Tensor that can be iterated. */
+    static constexpr int kMaxTensorRank = 8;
+
+    operator int() const { return linearIndex; }
 
     bool end() const { return atEnd; }
 
-    void operator++() { advanceRegion(advanceOne); }
+    void operator++() {
+        for (int i = ndims - 1; i >= 0; i--) {
+            if (++state[i] < regionEnd[i]) {
+                linearIndex += strides[i];
+                return;
+            }
+            // Carry over into the next dimension.
+            linearIndex -= (state[i] - 1 - origin[i]) * strides[i];
+            state[i] = origin[i];
+        }
+        atEnd = true;
+    }
 
     void operator+=(const std::vector<int>& region) {
-        assert(region.size() == state.size());
-        advanceRegion(region);
+        assert((int)region.size() == ndims);
+        advanceRegion(region.data());
     }
 
     template <typename... Args>
-    int operator()(int i, Args... args) {
-        auto indices = variadicToArray(i, args...);
-        return getIndex(indices);
+    int operator()(int i, Args... args) const {
+        const int numIndices = sizeof...(Args) + 1;
+        if (numIndices != ndims) {
+            const int indices[] = { i, args... };
+            return getIndex(indices, numIndices);
+        }
+        return offset(0, i, args...);
     }
 
     bool operator==(const TensorIndexIterator& other) const {
-        return (state == other.state && dims == other.dims &&
-                padding == other.padding && atEnd == other.atEnd);
+        if (ndims != other.ndims || atEnd != other.atEnd)
+            return false;
+        for (int i = 0; i < ndims; i++) {
+            if (state[i] != other.state[i] || dims[i] != other.dims[i] ||
+                strides[i] != other.strides[i])
+                return false;
+        }
+        return true;
     }
 
     bool operator!=(const TensorIndexIterator& other) const {
@@ -167,49 +206,71 @@ class TensorIndexIterator {
 
    protected:
     /**
-     * Returns the linear index into the Tensor's underlying data container at
-     * the specified coordinates.
+     * Returns the linear offset of the given coordinates, starting from
+     * dimension d. The coordinates are passed as separate arguments rather
+     * than an array so that they can stay in registers.
      */
-    template <typename Container>
-    int getIndex(Container indices) const {
-        int linearIndex = 0, stride = 1;
-        for (int i = (int)indices.size() - 1; i >= 0; i--) {
-            linearIndex += indices[i] * stride;
-            stride *= (dims.at(i) + padding.at(i));
+    template <typename... Args>
+    int offset(int d, int i, Args... args) const {
+        return i * strides[d] + offset(d + 1, args...);
+    }
+    int offset(int d) const { return 0; }
+
+    /**
+     * Returns the linear index at the coordinates of the leading numIndices
+     * dimensions, as if the Tensor only had those dimensions.
+     */
+    int getIndex(const int* indices, int numIndices) const {
+        int index = 0, stride = 1;
+        for (int i = numIndices - 1; i >= 0; i--) {
+            index += indices[i] * stride;
+            // This is the storage size of dimension i.
+            if (i > 0)
+                stride *= strides[i - 1] / strides[i];
         }
-        return linearIndex;
+        return index;
     }
 
     /*
      * Advance the current iterator position by the given region size.
      *
-     * @param region An N-dim vector indicating how far to increment in each
+     * @param region An N-dim array indicating how far to increment in each
      * dimension, if the previous dimension overflowed and caused a carry-over
      * into the next dimension.
      */
-    virtual void advanceRegion(const std::vector<int>& region) {
+    void advanceRegion(const int* region) {
         bool carry = true;
-        for (int i = (int)state.size() - 1; i >= 0 && carry; i--) {
+        for (int i = ndims - 1; i >= 0 && carry; i--) {
             int currValue = state[i] + region[i];
-            carry = (currValue >= dims[i]);
+            carry = (currValue >= regionEnd[i]);
             if (carry)
-                currValue = 0;
+                currValue = origin[i];
+            linearIndex += (currValue - state[i]) * strides[i];
             state[i] = currValue;
         }
         if (carry)
             atEnd = true;
     }
 
-    /** The current location of the iterator. */
-    std::vector<int> state;
+    /** The number of dimensions of this iterator's Tensor. */
+    int ndims;
     /** The dimensions of this iterator's Tensor. */
-    std::vector<int> dims;
-    /** Alignment padding of the Tensor. */
-    std::vector<int> padding;
+    int dims[kMaxTensorRank];
+    /**
+     * The distance between consecutive elements of each dimension in the
+     * Tensor's data, which includes the alignment padding.
+     */
+    int strides[kMaxTensorRank];
+    /** The current location of the iterator. */
+    int state[kMaxTensorRank];
+    /** The first coordinate of the iterated region in each dimension. */
+    int origin[kMaxTensorRank];
+    /** The end (exclusive) of the iterated region in each dimension. */
+    int regionEnd[kMaxTensorRank];
+    /** The linear index of the current location. */
+    int linearIndex;
     /** If true, we've reached the end of the Tensor. */
     bool atEnd;
-    /** A vector of all ones, used to implement operator++. */
-    const std::vector<int> advanceOne;
 };
 
 /**
@@ -233,29 +294,16 @@ class TensorRegionIndexIterator : public TensorIndexIterator {
     TensorRegionIndexIterator(const TensorShape& shape,
                               const std::vector<int>& _origin,
                               const std::vector<int>& _regionSize)
-            : TensorIndexIterator(shape, false), origin(_origin),
-              regionSize(_regionSize) {
-        state = origin;
-    }
-
-   protected:
-    /** Advance the tensor region index with the specified region size. */
-    virtual void advanceRegion(const std::vector<int>& advanceRegionSize) {
-        bool carry = true;
-        for (int i = (int)state.size() - 1; i >= 0 && carry; i--) {
-            int currValue = state[i] + advanceRegionSize[i];
-            carry = (currValue >= dims[i] ||
-                     currValue >= origin[i] + regionSize[i]);
-            if (carry)
-                currValue = origin[i];
-            state[i] = currValue;
+            : TensorIndexIterator(shape, false) {
+        assert((int)_origin.size() == ndims &&
+               (int)_regionSize.size() == ndims);
+        for (int i = 0; i < ndims; i++) {
+            origin[i] = _origin[i];
+            regionEnd[i] = std::min(dims[i], _origin[i] + _regionSize[i]);
+            state[i] = origin[i];
+            linearIndex += origin[i] * strides[i];
         }
-        if (carry)
-            atEnd = true;
     }
-
-    std::vector<int> origin;
-    std::vector<int> regionSize;
 };
 
 /**
@@ -343,13 +391,19 @@ class TensorBase {
  */
 class Tensor : public TensorBase {
    public:
-    Tensor() : TensorBase(), tensorData(NULL) {}
+    Tensor() : TensorBase(), tensorData(NULL), dataVersion(0) {}
 
     /** Construct a Tensor with the given name and shape. */
     Tensor(const std::string& _name, const TensorShape& _shape)
-            : TensorBase(_name, _shape), tensorData(NULL) {}
+            : TensorBase(_name, _shape), tensorData(NULL), dataVersion(0) {}
     virtual ~Tensor() {}
 
+    /**
+     * Constructs a Tensor from a serialized TensorProto, without any data.
+     */
+    explicit Tensor(const TensorProto& tensorProto)
+            : TensorBase(tensorProto), tensorData(NULL), dataVersion(0) {}
+
     /**
      * Constructs a Tensor from serialized protobufs.
      *
@@ -357,7 +411,7 @@ class Tensor : public TensorBase {
      * @param tensorData The data contents of the Tensor.
      */
     Tensor(const TensorProto& tensorProto, const TensorData& tensorData)
-            : TensorBase(tensorProto), tensorData(NULL) {
+            : TensorBase(tensorProto), tensorData(NULL), dataVersion(0) {
         DataType dataType = tensorProto.data_type();
         switch (dataType) {
             case Float16:
@@ -390,6 +444,17 @@ class Tensor : public TensorBase {
 
     virtual bool containsData() const { return tensorData != nullptr; }
 
+    /**
+     * Records that the data of the Tensor was rewritten, so that the tiles of
+     * any TiledTensor of it are copied again before they are used. Operators
+     * write their outputs on every run; anything else that rewrites a Tensor
+     * between runs (such as the inputs of a new request) must call this.
+     */
+    void markDataChanged() { dataVersion++; }
+
+    /** Returns the number of times markDataChanged() was called. */
+    uint64_t getDataVersion() const { return dataVersion; }
+
     /**
      * Fills the Tensor with externalData.
      *
@@ -511,6 +576,36 @@ class Tensor : public TensorBase {
         }
     }
 
+    /**
+     * Makes the Tensor use memory that it does not own, such as a memory
+     * mapped file, as its storage. The Tensor holds a reference to owner,
+     * which must keep the memory alive.
+     */
+    void setExternalStorage(const std::shared_ptr<void>& owner,
+                            void* externalData,
+                            DataType _dataType) {
+        dataType = _dataType;
+        tensorData = std::shared_ptr<void>(owner, externalData);
+    }
+
+    /** Returns the storage of the Tensor, whatever its data type. */
+    const void* rawData() const { return tensorData.get(); }
+
+    /**
+     * Makes the Tensor use the storage of another Tensor, starting at the
+     * given element, and drops its own.
+     */
+    void shareStorage(const Tensor* other, int offset = 0) {
+        assert(other->getShape().storageSize() >=
+                       offset + shape.storageSize() &&
+               "The shared storage is too small!");
+        dataType = other->dataType;
+        tensorData = std::shared_ptr<void>(
+                other->tensorData,
+                reinterpret_cast<char*>(other->tensorData.get()) +
+                        (size_t)offset * other->getDataTypeSize());
+    }
+
     /** Serializes this Tensor to a TensorProto. */
     TensorProto* asTensorProto();
 
@@ -539,6 +634,7 @@ class Tensor : public TensorBase {
 
    protected:
     std::shared_ptr<void> tensorData;
+    uint64_t dataVersion;
 };
 
 /**
@@ -553,7 +649,7 @@ class TiledTensor : public TensorBase {
   public:
    TiledTensor(Tensor* _origTensor = nullptr, bool _useRawTensor = false)
            : TensorBase(), origTensor(_origTensor), useRawTensor(_useRawTensor),
-             dataFilled(false) {}
+             dataFilled(false), filledVersion(getOrigDataVersion()) {}
    /**
     * Construct a TiledTensor.
     *
@@ -568,7 +664,8 @@ class TiledTensor : public TensorBase {
                Tensor* _origTensor = nullptr,
                bool _useRawTensor = false)
            : TensorBase("", shape), origTensor(_origTensor),
-             useRawTensor(_useRawTensor), dataFilled(false) {
+             useRawTensor(_useRawTensor), dataFilled(false),
+             filledVersion(getOrigDataVersion()) {
        tiles.resize(shape.size());
    }
 
@@ -606,6 +703,10 @@ class TiledTensor : public TensorBase {
    /**
     * Set the specified tile to the provided Tensor, and optionally copy data
     * into it.
+    *
+    * If the Tensor's storage is a part of the original Tensor's (see
+    * Tensor::shareStorage()), the tile is a view: data is never copied into
+    * or out of it, since it already lives in the original Tensor.
     */
    void setTile(int index,
                 const std::vector<int>& origin,
@@ -617,11 +718,49 @@ class TiledTensor : public TensorBase {
 
    /**
     * Copies data from the TiledTensor into the original Tensor. We name it
-    * "untile" because what it does reverses the tiling process.
+    * "untile" because what it does reverses the tiling process. Tiles already
+    * copied back by gatherTile() are skipped.
     */
    void untile();
 
-   static void* tileCopyWorker(void* _args);
+   /**
+    * Starts copying data to the specified tile on a helper thread, so the
+    * copy overlaps with whatever the caller does until it calls
+    * getTileWithData() for the tile. Tiles are copied in the order they are
+    * prefetched.
+    */
+   void prefetchTile(int index);
+
+   /**
+    * Copies the data of the specified tile back into the original Tensor, as
+    * soon as the tile's results are final, and excludes it from the next
+    * untile(). Different tiles may be gathered concurrently from different
+    * threads.
+    */
+   void gatherTile(int index);
+
+   /** Wait until all the tiles prefetched with prefetchTile() have data. */
+   void waitForPrefetches();
+
+   /**
+    * Moves the storage of all the tiles into one contiguous buffer, in
+    * tile-major order with every tile cacheline aligned, and fills it from
+    * the original Tensor. This is meant for constant data such as weights:
+    * the tiles are filled once, here, and copyDataToAllTiles(),
+    * prefetchTile() and getTileWithData() never copy into them again.
+    *
+    * The tiles do not need storage of their own beforehand. If packed is
+    * given, it must be the getPackedData() of an earlier TiledTensor with the
+    * same original Tensor, data and tiles; the tiles then use it as it is and
+    * nothing is copied.
+    */
+   void packTiles(const std::shared_ptr<void>& packed = nullptr);
+
+   /** Returns true if the tiles were packed by packTiles(). */
+   bool isPacked() const { return packedData != nullptr; }
+
+   /** Returns the buffer holding the packed tiles, if any. */
+   const std::shared_ptr<void>& getPackedData() const { return packedData; }
 
   protected:
    /**
@@ -634,15 +773,26 @@ class TiledTensor : public TensorBase {
        std::vector<int> origin;
        /** True if the tile has its origin set. */
        bool hasOrigin;
-       /** True if we have copied data to this tile. */
+       /**
+        * True if we have copied data to this tile. The prefetch thread writes
+        * it, so it must not be read while prefetchTicket is pending.
+        */
        bool hasData;
+       /** The helper thread's ticket of a pending prefetch, or zero. */
+       TaskThread::Ticket prefetchTicket;
+       /** True if gatherTile() has copied this tile's data back. */
+       bool gathered;
+       /** True if the tile's storage is a part of the original tensor's. */
+       bool isView;
 
        /**
         * Construct a new blank Tile.
         *
         * Set the properties of this Tile using TiledTensor::setTile
         */
-       Tile() : tensor(nullptr), origin(), hasOrigin(false), hasData(false) {}
+       Tile()
+               : tensor(nullptr), origin(), hasOrigin(false), hasData(false),
+                 prefetchTicket(0), gathered(false), isView(false) {}
    };
 
    /**
@@ -655,20 +805,6 @@ class TiledTensor : public TensorBase {
      Gather
    };
 
-   struct CopyTilesArgs {
-       TiledTensor* tiledTensor;
-       int start;
-       int numTiles;
-       TileDataOperation op;
-
-       CopyTilesArgs(TiledTensor* _tiledTensor,
-                     int _start,
-                     int _numTiles,
-                     TileDataOperation _op)
-               : tiledTensor(_tiledTensor), start(_start), numTiles(_numTiles),
-                 op(_op) {}
-   };
-
    Tile* getTile(int index) { return &tiles[index]; }
 
    /** Copy data (if needed) to this tile from the original Tensor. */
@@ -677,6 +813,28 @@ class TiledTensor : public TensorBase {
    /** Copy data from this tile to the original Tensor. */
    void gatherDataFromTile(Tile* tile);
 
+   /**
+    * Returns true if the tile needs no copies to or from the original Tensor,
+    * because it is the original Tensor or a view of it.
+    */
+   bool sharesOrigStorage(const Tile* tile) const {
+       return tile->isView || tile->tensor == origTensor;
+   }
+
+   /** Returns the number of bytes moved by copying this tile's data. */
+   int64_t getTileCopyBytes(const Tile* tile) const;
+
+   /** Returns the data version of the original Tensor, if there is one. */
+   uint64_t getOrigDataVersion() const {
+       return origTensor ? origTensor->getDataVersion() : 0;
+   }
+
+   /**
+    * Drops the data of all the tiles if the original Tensor has changed since
+    * they were filled, so they are copied again when they are next used.
+    */
+   void dropStaleTiles();
+
    /** Split the work (data filling or gathering) across multiple threads. */
    void parallelCopyTileData(TileDataOperation op);
 
@@ -689,8 +847,14 @@ class TiledTensor : public TensorBase {
    /** True if all the tiles have data filled. */
    bool dataFilled;
 
+   /** The data version of the original Tensor that the tiles hold. */
+   uint64_t filledVersion;
+
    /** The list of Tiles, indexed using a TensorIndexIterator. */
    std::vector<Tile> tiles;
+
+   /** The buffer holding all the tiles' data, set by packTiles(). */
+   std::shared_ptr<void> packedData;
 };
 
 }  // namespace smaug
@@ -0,0 +1,136 @@
+#include <sstream>
+#include <string>
+
+#include "smaug/core/globals.h"
+#include "smaug/core/smaug_bench.h"
+#include "smaug/core/tensor.h"
+#include "smaug/core/tensor_utils.h"
+#include "smaug/core/workspace.h"
+#include "smaug/operators/reorder_op_impl.h"
+
+using namespace smaug;
+
+namespace {
+
+std::string shapeName(const std::string& op, const std::vector<int>& dims) {
+    std::string name = op + " [";
+    for (int i = 0; i < dims.size(); i++)
+        name += (i ? "x" : "") + std::to_string(dims[i]);
+    return name + "]";
+}
+
+Tensor* createTensor(Workspace* workspace,
+                     const std::string& name,
+                     const TensorShape& shape) {
+    Tensor* tensor = new Tensor(name, shape);
+    float* data = tensor->allocateStorage<float>();
+    for (int i = 0; i < shape.storageSize(); i++)
+        data[i] = ((i % 17) - 8) * 0.0625f;
+    workspace->addTensor(tensor);
+    return tensor;
+}
+
+int64_t tensorBytes(const TensorShape& shape) {
+    return (int64_t)shape.storageSize() * sizeof(float);
+}
+
+const std::vector<std::vector<int>> kShapes = {
+    { 1, 64, 56, 56 }, { 1, 256, 28, 28 }, { 8, 32, 32, 32 }, { 1, 3, 224, 224 },
+};
+
+void benchIteration(SmaugBenchmark& bench) {
+    bench.printHeader("TensorIndexIterator (NHWC, fp32)");
+    for (auto& dims : kShapes) {
+        Workspace workspace;
+        TensorShape shape(dims, DataLayout::NHWC, 8);
+        Tensor* tensor = createTensor(&workspace, "tensor", shape);
+        const float* data = tensor->data<float>();
+        volatile float sink;
+        bench.run(shapeName("iterate", dims), 0, tensorBytes(shape), [&]() {
+            float sum = 0;
+            for (auto idx = tensor->startIndex(); !idx.end(); ++idx)
+                sum += data[idx];
+            sink = sum;
+        });
+        bench.run(shapeName("random access", dims), 0, tensorBytes(shape),
+                  [&]() {
+                      float sum = 0;
+                      auto idx = tensor->startIndex();
+                      for (int n = 0; n < dims[0]; n++)
+                          for (int h = 0; h < dims[1]; h++)
+                              for (int w = 0; w < dims[2]; w++)
+                                  for (int c = 0; c < dims[3]; c++)
+                                      sum += data[idx(n, h, w, c)];
+                      sink = sum;
+                  });
+    }
+}
+
+void benchCopies(SmaugBenchmark& bench) {
+    bench.printHeader("Tensor copies (NHWC, fp32)");
+    for (auto& dims : kShapes) {
+        Workspace workspace;
+        TensorShape shape(dims, DataLayout::NHWC, 8);
+        Tensor* src = createTensor(&workspace, "src", shape);
+        Tensor* dest = createTensor(&workspace, "dest", shape);
+        int size = shape.size();
+        bench.run(shapeName("copyTensorData", dims), 0, 2 * tensorBytes(shape),
+                  [&]() {
+                      copyTensorData(dest, src, { 0, 0, 0, 0 },
+                                     { 0, 0, 0, 0 }, size);
+                  });
+        // Copy out a tile of half the rows and half the channels, which is
+        // narrower than the tensor in the innermost dimension.
+        std::vector<int> region = { dims[0], dims[1] / 2, dims[2],
+                                    std::max(dims[3] / 2, 1) };
+        TensorShape regionShape(region, DataLayout::NHWC, 8);
+        Tensor* tile = createTensor(&workspace, "tile", regionShape);
+        bench.run(shapeName("copyTensorRegion", region), 0,
+                  2 * tensorBytes(regionShape), [&]() {
+                      copyTensorRegion(tile, src, { 0, 0, 0, 0 },
+                                       { 0, dims[1] / 4, 0, 0 }, region);
+                  });
+    }
+}
+
+void benchReorder(SmaugBenchmark& bench) {
+    bench.printHeader("Layout transformations (fp32)");
+    for (auto& dims : kShapes) {
+        Workspace workspace;
+        TensorShape nchwShape(dims, DataLayout::NCHW, 8);
+        TensorShape nhwcShape(
+                { dims[0], dims[2], dims[3], dims[1] }, DataLayout::NHWC, 8);
+        Tensor* nchw = createTensor(&workspace, "nchw", nchwShape);
+        Tensor* nhwc = createTensor(&workspace, "nhwc", nhwcShape);
+        int64_t bytes = tensorBytes(nchwShape) + tensorBytes(nhwcShape);
+        bench.run(shapeName("nchw->nhwc", dims), 0, bytes,
+                  [&]() { convertNchwToNhwc(nchw, nhwc); });
+        bench.run(shapeName("nhwc->nchw", dims), 0, bytes,
+                  [&]() { convertNhwcToNchw(nhwc, nchw); });
+    }
+}
+
+void benchPrinting(SmaugBenchmark& bench) {
+    bench.printHeader("Tensor printing (fp32)");
+    std::vector<int> dims = { 1, 16, 32, 32 };
+    Workspace workspace;
+    TensorShape shape(dims, DataLayout::NHWC, 8);
+    Tensor* tensor = createTensor(&workspace, "tensor", shape);
+    bench.run(shapeName("operator<<", dims), 0, tensorBytes(shape), [&]() {
+        std::ostringstream os;
+        os << *tensor;
+    });
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    SmaugBenchmark bench(argc, argv);
+    runningInSimulation = false;
+
+    benchIteration(bench);
+    benchCopies(bench);
+    benchReorder(bench);
+    benchPrinting(bench);
+    return 0;
+}
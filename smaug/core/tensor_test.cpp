@@ -1,8 +1,13 @@
 #include "catch.hpp"
 #include "smaug/core/backend.h"
+#include "smaug/core/globals.h"
 #include "smaug/core/tensor.h"
 #include "smaug/core/smaug_test.h"
+#include "smaug/core/tensor_utils.h"
 #include "smaug/operators/data_op.h"
+#include "smaug/operators/relu_op.h"
+#include "smaug/operators/smv/smv_test_common.h"
+#include "smaug/utility/thread_pool.h"
 
 using namespace smaug;
 
@@ -52,3 +57,287 @@ TEST_CASE_METHOD(SmaugTest, "Unpacking of float16 tensor data", "[fp16]") {
     }
 }
 
+
+TEST_CASE_METHOD(SmaugTest, "Prefetching and gathering tiles", "[tiling]") {
+    auto reluOp = new ReluOp<ReferenceBackend>("relu", workspace());
+    TensorShape shape(
+            { 1, 32, 32, 16 }, DataLayout::NHWC, SmvBackend::Alignment);
+    TensorShape tileShape(
+            { 1, 8, 32, 16 }, DataLayout::NHWC, SmvBackend::Alignment);
+    Tensor* inputs = new Tensor("inputs", shape);
+    inputs->allocateStorage<float16>();
+    workspace()->addTensor(inputs);
+    fillTensorWithRandomData(inputs);
+    Tensor* outputs = new Tensor("outputs", shape);
+    outputs->allocateStorage<float16>();
+    workspace()->addTensor(outputs);
+    TiledTensor inputTiles = generateTiledTensor(inputs, tileShape, reluOp);
+    TiledTensor outputTiles = generateTiledTensor(outputs, tileShape, reluOp);
+    REQUIRE(inputTiles.size() == 4);
+
+    for (int i = 0; i < inputTiles.size(); i++)
+        inputTiles.prefetchTile(i);
+    for (int i = 0; i < inputTiles.size(); i++) {
+        Tensor* inputTile = inputTiles.getTileWithData(i);
+        copyRawTensorData(outputTiles[i], inputTile, 0, 0,
+                          inputTile->getShape().storageSize());
+        outputTiles.gatherTile(i);
+    }
+    verifyOutputs<float16>(outputs, inputs);
+
+    // The tiles gathered already are left alone by the next untile(), and
+    // gathered again by the one after.
+    fillTensorWithFixedData(outputTiles[0]);
+    outputTiles.untile();
+    verifyOutputs<float16>(outputs, inputs);
+    outputTiles.untile();
+    TiledTensor resultTiles = generateTiledTensor(
+            outputs, tileShape, reluOp, /* copyData */ true);
+    verifyTensorWithFixedData(resultTiles[0], 0);
+}
+
+TEST_CASE_METHOD(SmaugTest, "Packing tiles", "[tiling]") {
+    auto reluOp = new ReluOp<ReferenceBackend>("relu", workspace());
+    TensorShape shape(
+            { 4, 3, 3, 20 }, DataLayout::NHWC, SmvBackend::Alignment);
+    TensorShape tileShape(
+            { 4, 3, 3, 8 }, DataLayout::NHWC, SmvBackend::Alignment);
+    Tensor* weights = new Tensor("weights", shape);
+    weights->allocateStorage<float16>();
+    workspace()->addTensor(weights);
+    fillTensorWithRandomData(weights);
+    TiledTensor weightTiles =
+            generatePackedTiledTensor(weights, tileShape, reluOp);
+    REQUIRE(weightTiles.size() == 3);
+    REQUIRE(weightTiles.isPacked());
+
+    // The tiles follow each other in one buffer.
+    const char* tileData =
+            reinterpret_cast<const char*>(weightTiles[0]->rawData());
+    for (int i = 0; i < weightTiles.size(); i++) {
+        REQUIRE(weightTiles[i]->rawData() == tileData);
+        tileData += next_multiple(
+                weightTiles[i]->getShape().storageSize() * sizeof(float16),
+                CACHELINE_SIZE);
+    }
+
+    // The tiles have their data already, and nothing copies into them again.
+    TiledTensor expectedTiles = generateTiledTensor(
+            weights, tileShape, reluOp, /* copyData */ true);
+    fillTensorWithFixedData(weights);
+    weightTiles.copyDataToAllTiles();
+    for (int i = 0; i < weightTiles.size(); i++) {
+        verifyOutputs<float16>(weightTiles.getTileWithData(i),
+                               expectedTiles[i]);
+    }
+
+    // Tiling the same data again reuses the packed tiles.
+    TiledTensor retiled = generatePackedTiledTensor(weights, tileShape, reluOp);
+    REQUIRE(retiled.getPackedData() == weightTiles.getPackedData());
+    for (int i = 0; i < retiled.size(); i++)
+        REQUIRE(retiled[i]->rawData() == weightTiles[i]->rawData());
+
+    // New data gets packed again.
+    weights->markDataChanged();
+    TiledTensor repacked = generatePackedTiledTensor(weights, tileShape, reluOp);
+    REQUIRE(repacked.getPackedData() != weightTiles.getPackedData());
+    TiledTensor newTiles = generateTiledTensor(
+            weights, tileShape, reluOp, /* copyData */ true);
+    for (int i = 0; i < repacked.size(); i++)
+        verifyOutputs<float16>(repacked.getTileWithData(i), newTiles[i]);
+}
+
+TEST_CASE_METHOD(SmaugTest, "Zero-copy tile views", "[tiling]") {
+    auto reluOp = new ReluOp<ReferenceBackend>("relu", workspace());
+    TensorShape shape({ 4, 2, 2, 8 }, DataLayout::NHWC, SmvBackend::Alignment);
+    Tensor* tensor = new Tensor("tensor", shape);
+    tensor->allocateStorage<float16>();
+    workspace()->addTensor(tensor);
+    fillTensorWithRandomData(tensor);
+    const float16* tensorData = tensor->data<float16>();
+
+    SECTION("Tiles along the batch are views") {
+        TiledTensor tiles = generateTiledTensor(
+                tensor,
+                TensorShape({ 1, 2, 2, 8 }, DataLayout::NHWC,
+                            SmvBackend::Alignment),
+                reluOp);
+        REQUIRE(tiles.size() == 4);
+        for (int i = 0; i < tiles.size(); i++) {
+            REQUIRE(tiles.getTileWithData(i)->data<float16>() ==
+                    tensorData + i * 32);
+        }
+        // Writing a tile writes the original tensor.
+        fillTensorWithFixedData(tiles[1]);
+        tiles.untile();
+        verifyTensorWithFixedData(tiles[1], 0);
+        REQUIRE(tensorData[32] == tiles[1]->data<float16>()[0]);
+    }
+
+    SECTION("Unpadded tiles per batch are views") {
+        TiledTensor tiles = generateTiledTensorPerBatchNC(
+                tensor,
+                TensorShape({ 1, 48 }, DataLayout::NC, SmvBackend::Alignment),
+                reluOp,
+                /* copyData */ true);
+        REQUIRE(tiles.size() == 3);
+        for (int i = 0; i < tiles.size(); i++)
+            REQUIRE(tiles[i]->data<float16>() == tensorData + i * 48);
+    }
+
+    SECTION("Other tiles are copies") {
+        TiledTensor tiles = generateTiledTensor(
+                tensor,
+                TensorShape({ 4, 1, 2, 8 }, DataLayout::NHWC,
+                            SmvBackend::Alignment),
+                reluOp,
+                /* copyData */ true);
+        REQUIRE(tiles.size() == 2);
+        for (int i = 0; i < tiles.size(); i++) {
+            const float16* tileData = tiles[i]->data<float16>();
+            REQUIRE((tileData < tensorData ||
+                     tileData >= tensorData + shape.storageSize()));
+        }
+    }
+}
+
+TEST_CASE_METHOD(SmaugTest, "Tensor index iterators", "[tensor]") {
+    // The innermost dimension is padded to 8 elements.
+    TensorShape shape({ 2, 3, 5 }, DataLayout::NTC, 8);
+    auto linearIndex = [](int n, int t, int c) { return (n * 3 + t) * 8 + c; };
+
+    SECTION("Iterating over all the elements") {
+        auto idx = TensorIndexIterator(shape);
+        for (int n = 0; n < 2; n++) {
+            for (int t = 0; t < 3; t++) {
+                for (int c = 0; c < 5; c++) {
+                    REQUIRE(!idx.end());
+                    REQUIRE((int)idx == linearIndex(n, t, c));
+                    REQUIRE(idx(n, t, c) == linearIndex(n, t, c));
+                    REQUIRE(idx.currentIndex(1) == t);
+                    ++idx;
+                }
+            }
+        }
+        REQUIRE(idx.end());
+    }
+
+    SECTION("Advancing by a region") {
+        // Outer dimensions only advance when the inner ones carry over.
+        auto idx = TensorIndexIterator(shape);
+        idx += { 1, 2, 4 };
+        REQUIRE((int)idx == linearIndex(0, 0, 4));
+        idx += { 1, 2, 1 };
+        REQUIRE((int)idx == linearIndex(0, 2, 0));
+        idx += { 1, 1, 5 };
+        REQUIRE((int)idx == linearIndex(1, 0, 0));
+        idx += { 1, 3, 5 };
+        REQUIRE(idx.end());
+    }
+
+    SECTION("Iterating over a region") {
+        auto idx = TensorRegionIndexIterator(shape, { 0, 1, 2 }, { 2, 2, 3 });
+        for (int n = 0; n < 2; n++) {
+            for (int t = 1; t < 3; t++) {
+                for (int c = 2; c < 5; c++) {
+                    REQUIRE(!idx.end());
+                    REQUIRE((int)idx == linearIndex(n, t, c));
+                    ++idx;
+                }
+            }
+        }
+        REQUIRE(idx.end());
+
+        auto regionIdx =
+                TensorRegionIndexIterator(shape, { 0, 1, 2 }, { 2, 2, 3 });
+        regionIdx += { 0, 1, 3 };
+        REQUIRE((int)regionIdx == linearIndex(0, 2, 2));
+    }
+}
+
+namespace {
+
+// Copies a region between two tensors filled with distinct values, and checks
+// every element of the region against the source.
+void verifyRegionCopy(const std::vector<int>& srcDims,
+                      const std::vector<int>& destDims,
+                      const std::vector<int>& srcOrigin,
+                      const std::vector<int>& destOrigin,
+                      const std::vector<int>& regionSize) {
+    DataLayout layout = srcDims.size() == 4 ? DataLayout::NHWC : DataLayout::NTC;
+    Tensor src("src", TensorShape(srcDims, layout, 8));
+    Tensor dest("dest", TensorShape(destDims, layout, 8));
+    float* srcData = src.allocateStorage<float>();
+    float* destData = dest.allocateStorage<float>();
+    for (int i = 0; i < src.getShape().storageSize(); i++)
+        srcData[i] = i;
+    for (int i = 0; i < dest.getShape().storageSize(); i++)
+        destData[i] = -1;
+    copyTensorRegion(&dest, &src, destOrigin, srcOrigin, regionSize,
+                     /* useThreadPool */ true);
+    auto srcIt = TensorRegionIndexIterator(src.getShape(), srcOrigin, regionSize);
+    auto destIt =
+            TensorRegionIndexIterator(dest.getShape(), destOrigin, regionSize);
+    int mismatches = 0;
+    for (; !srcIt.end(); ++srcIt, ++destIt)
+        mismatches += destData[destIt] != srcData[srcIt];
+    REQUIRE(mismatches == 0);
+}
+
+}  // namespace
+
+TEST_CASE_METHOD(SmaugTest, "Strided region copies", "[tensor]") {
+    SECTION("Compiling a region copy") {
+        TensorShape shape({ 2, 4, 10, 16 }, DataLayout::NHWC, 8);
+        // The whole tensor is a single run.
+        auto copy = internal::compileRegionCopy(
+                shape, shape, { 0, 0, 0, 0 }, { 0, 0, 0, 0 },
+                { 2, 4, 10, 16 }, sizeof(float));
+        REQUIRE(copy.numLoops == 0);
+        REQUIRE(copy.runBytes == 2 * 4 * 10 * 16 * sizeof(float));
+        // Narrow channels: the three outer dimensions are merged into one
+        // loop over the rows.
+        copy = internal::compileRegionCopy(
+                shape, shape, { 0, 0, 0, 8 }, { 0, 0, 0, 0 },
+                { 2, 4, 10, 8 }, sizeof(float));
+        REQUIRE(copy.numLoops == 1);
+        REQUIRE(copy.counts[0] == 80);
+        REQUIRE(copy.runBytes == 8 * sizeof(float));
+        REQUIRE(copy.destOffset == 8 * sizeof(float));
+        // Narrow rows and a single batch: one loop over the rows, with runs of
+        // full rows.
+        copy = internal::compileRegionCopy(
+                shape, shape, { 1, 0, 0, 0 }, { 0, 0, 0, 0 },
+                { 1, 4, 5, 16 }, sizeof(float));
+        REQUIRE(copy.numLoops == 1);
+        REQUIRE(copy.counts[0] == 4);
+        REQUIRE(copy.runBytes == 5 * 16 * sizeof(float));
+        REQUIRE(copy.destOffset == 4 * 10 * 16 * sizeof(float));
+    }
+
+    SECTION("Copying regions") {
+        verifyRegionCopy({ 2, 4, 10, 16 }, { 2, 4, 10, 16 }, { 0, 0, 0, 0 },
+                         { 0, 0, 0, 0 }, { 2, 4, 10, 16 });
+        verifyRegionCopy({ 2, 4, 10, 16 }, { 2, 4, 10, 8 }, { 0, 0, 0, 8 },
+                         { 0, 0, 0, 0 }, { 2, 4, 10, 8 });
+        verifyRegionCopy({ 2, 4, 10, 16 }, { 1, 3, 6, 16 }, { 1, 1, 2, 0 },
+                         { 0, 0, 0, 0 }, { 1, 3, 6, 16 });
+        verifyRegionCopy({ 3, 7, 5 }, { 4, 9, 8 }, { 1, 2, 0 }, { 2, 1, 3 },
+                         { 2, 5, 5 });
+        verifyRegionCopy({ 3, 7, 5 }, { 3, 7, 5 }, { 2, 6, 4 }, { 0, 0, 0 },
+                         { 1, 1, 1 });
+    }
+
+    SECTION("Copying large regions") {
+        // Large enough to be split over the thread pool and to use
+        // non-temporal stores.
+        threadPool = new ThreadPool(3);
+        threadPool->initThreadPool();
+        verifyRegionCopy({ 4, 512, 1040 }, { 4, 512, 1024 }, { 0, 0, 16 },
+                         { 0, 0, 0 }, { 4, 512, 1024 });
+        verifyRegionCopy({ 8, 64, 64, 64 }, { 8, 64, 64, 32 }, { 0, 0, 0, 32 },
+                         { 0, 0, 0, 0 }, { 8, 64, 64, 32 });
+        delete threadPool;
+        threadPool = nullptr;
+    }
+}
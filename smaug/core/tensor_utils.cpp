@@ -1,10 +1,17 @@
+#include <algorithm>
 #include <iostream>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "fp16.h"
+#include "smaug/core/globals.h"
 #include "smaug/core/tensor.h"
 #include "smaug/core/tensor_utils.h"
 #include "smaug/core/workspace.h"
 #include "smaug/utility/debug_stream.h"
+#include "smaug/utility/thread_pool.h"
 
 namespace smaug {
 
@@ -28,7 +35,7 @@ std::ostream& operator<<(std::ostream& os, const TensorShape& shape) {
 
 std::ostream& operator<<(std::ostream& os, const TensorIndexIterator& iter) {
     os << "( ";
-    for (int i = 0; i < iter.dims.size(); ++i) {
+    for (int i = 0; i < iter.ndims; ++i) {
         os << iter.state[i] << " ";
     }
     os << ")";
@@ -62,37 +69,211 @@ std::ostream& operator<<(std::ostream& os, const Tensor& tensor) {
     return os;
 }
 
+namespace internal {
+
+namespace {
+
+/**
+ * Copies larger than this (about the size of a last-level cache) write their
+ * runs with non-temporal stores, since the data would be evicted before it is
+ * read again anyway.
+ */
+constexpr int64_t kNonTemporalCopyBytes = 8 * 1024 * 1024;
+
+/** Runs shorter than this are not worth aligning for non-temporal stores. */
+constexpr int64_t kNonTemporalMinRunBytes = 256;
+
+/** Copies smaller than this are not worth splitting over the thread pool. */
+constexpr int64_t kMinParallelCopyBytes = 256 * 1024;
+
+void copyRun(char* dest, const char* src, int64_t bytes, bool nonTemporal) {
+#ifdef __SSE2__
+    if (nonTemporal) {
+        int64_t head = (-reinterpret_cast<uintptr_t>(dest)) & 15;
+        std::memcpy(dest, src, head);
+        int64_t i = head;
+        for (; i + 16 <= bytes; i += 16) {
+            __m128i data = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(&src[i]));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(&dest[i]), data);
+        }
+        std::memcpy(&dest[i], &src[i], bytes - i);
+        return;
+    }
+#endif
+    std::memcpy(dest, src, bytes);
+}
+
+/** Runs the loops of the copy with the outermost one limited to [start, end). */
+void runLoops(const StridedCopy& copy,
+              char* dest,
+              const char* src,
+              int start,
+              int end) {
+    bool nonTemporal = copy.runBytes >= kNonTemporalMinRunBytes &&
+                       copy.totalBytes() >= kNonTemporalCopyBytes;
+    dest += copy.destOffset;
+    src += copy.srcOffset;
+    if (copy.numLoops == 0) {
+        copyRun(dest, src, copy.runBytes, nonTemporal);
+        return;
+    }
+    dest += start * copy.destStrides[0];
+    src += start * copy.srcStrides[0];
+    // The innermost loop runs directly, and the ones around it count like an
+    // odometer.
+    const int inner = copy.numLoops - 1;
+    int counts[TensorIndexIterator::kMaxTensorRank];
+    std::copy(copy.counts, copy.counts + copy.numLoops, counts);
+    counts[0] = end - start;
+    int state[TensorIndexIterator::kMaxTensorRank] = { 0 };
+    while (true) {
+        char* destRun = dest;
+        const char* srcRun = src;
+        for (int i = 0; i < counts[inner]; i++) {
+            copyRun(destRun, srcRun, copy.runBytes, nonTemporal);
+            destRun += copy.destStrides[inner];
+            srcRun += copy.srcStrides[inner];
+        }
+        int d = inner - 1;
+        for (; d >= 0; d--) {
+            dest += copy.destStrides[d];
+            src += copy.srcStrides[d];
+            if (++state[d] < counts[d])
+                break;
+            dest -= counts[d] * copy.destStrides[d];
+            src -= counts[d] * copy.srcStrides[d];
+            state[d] = 0;
+        }
+        if (d < 0)
+            break;
+    }
+#ifdef __SSE2__
+    // Order the non-temporal stores before anything that reads the data.
+    if (nonTemporal)
+        _mm_sfence();
+#endif
+}
+
+}  // namespace
+
+StridedCopy compileRegionCopy(const TensorShape& destShape,
+                              const TensorShape& srcShape,
+                              const std::vector<int>& destOrigin,
+                              const std::vector<int>& srcOrigin,
+                              const std::vector<int>& regionSize,
+                              int elementSize) {
+    const int ndims = srcShape.ndims();
+    assert(ndims <= TensorIndexIterator::kMaxTensorRank);
+    TensorShape regionShape(
+            regionSize, srcShape.getLayout(), srcShape.getAlignment());
+    int64_t srcStrides[TensorIndexIterator::kMaxTensorRank];
+    int64_t destStrides[TensorIndexIterator::kMaxTensorRank];
+    int64_t srcStride = elementSize, destStride = elementSize;
+    for (int i = ndims - 1; i >= 0; i--) {
+        srcStrides[i] = srcStride;
+        destStrides[i] = destStride;
+        srcStride *= srcShape.getStorageDim(i);
+        destStride *= destShape.getStorageDim(i);
+    }
+
+    StridedCopy copy;
+    copy.srcOffset = 0;
+    copy.destOffset = 0;
+    for (int i = 0; i < ndims; i++) {
+        assert(srcOrigin[i] + regionSize[i] <= srcShape[i] &&
+               destOrigin[i] + regionSize[i] <= destShape[i] &&
+               "The copied region must fit in both tensors!");
+        copy.srcOffset += srcOrigin[i] * srcStrides[i];
+        copy.destOffset += destOrigin[i] * destStrides[i];
+    }
+
+    // Starting from the last dimension, figure out how much contiguous data
+    // there is in each run.
+    copy.runBytes = elementSize;
+    int firstRunDim = 0;
+    for (int i = ndims - 1; i >= 0; i--) {
+        copy.runBytes *= regionShape.getStorageDim(i);
+        // If we find a region dimension smaller than that of either src or
+        // dest tensor, then the next region dimension must not be contiguous.
+        if (regionShape[i] < srcShape[i] || regionShape[i] < destShape[i]) {
+            firstRunDim = i;
+            break;
+        }
+    }
+
+    // The remaining dimensions become loops. Loops with one iteration are
+    // dropped, and a loop is merged into the one inside it if stepping
+    // through the inner loop is the same as stepping the outer one.
+    copy.numLoops = 0;
+    for (int i = 0; i < firstRunDim; i++) {
+        if (regionSize[i] == 1)
+            continue;
+        int& n = copy.numLoops;
+        if (n > 0 &&
+            copy.srcStrides[n - 1] == regionSize[i] * srcStrides[i] &&
+            copy.destStrides[n - 1] == regionSize[i] * destStrides[i]) {
+            copy.counts[n - 1] *= regionSize[i];
+        } else {
+            n++;
+            copy.counts[n - 1] = regionSize[i];
+        }
+        copy.srcStrides[n - 1] = srcStrides[i];
+        copy.destStrides[n - 1] = destStrides[i];
+    }
+    return copy;
+}
+
+void runStridedCopy(const StridedCopy& copy,
+                    char* dest,
+                    const char* src,
+                    bool useThreadPool) {
+    int outerCount = copy.numLoops > 0 ? copy.counts[0] : 1;
+    if (!useThreadPool || fastForwardMode || !threadPool || outerCount < 2 ||
+        copy.totalBytes() < kMinParallelCopyBytes) {
+        runLoops(copy, dest, src, 0, outerCount);
+        return;
+    }
+    int grain = std::max(1, outerCount / (4 * (threadPool->size() + 1)));
+    threadPool->parallelFor(0, outerCount, grain, [&](int start, int end) {
+        runLoops(copy, dest, src, start, end);
+    });
+}
+
+}  // namespace internal
+
 void copyTensorRegion(Tensor* dest,
                       Tensor* src,
                       std::vector<int> destOrigin,
                       std::vector<int> srcOrigin,
-                      std::vector<int> regionSize) {
+                      std::vector<int> regionSize,
+                      bool useThreadPool) {
     assert(dest->ndims() == src->ndims());
     assert(dest->getDataType() == src->getDataType());
     switch (dest->getDataType()) {
         case Float16:
             internal::copyTensorRegion<uint16_t>(
-                    dest, src, destOrigin, srcOrigin, regionSize);
+                    dest, src, destOrigin, srcOrigin, regionSize, useThreadPool);
             break;
         case Float32:
             internal::copyTensorRegion<float>(
-                    dest, src, destOrigin, srcOrigin, regionSize);
+                    dest, src, destOrigin, srcOrigin, regionSize, useThreadPool);
             break;
         case Float64:
             internal::copyTensorRegion<double>(
-                    dest, src, destOrigin, srcOrigin, regionSize);
+                    dest, src, destOrigin, srcOrigin, regionSize, useThreadPool);
             break;
         case Int32:
             internal::copyTensorRegion<int>(
-                    dest, src, destOrigin, srcOrigin, regionSize);
+                    dest, src, destOrigin, srcOrigin, regionSize, useThreadPool);
             break;
         case Int64:
             internal::copyTensorRegion<int64_t>(
-                    dest, src, destOrigin, srcOrigin, regionSize);
+                    dest, src, destOrigin, srcOrigin, regionSize, useThreadPool);
             break;
         case Bool:
             internal::copyTensorRegion<bool>(
-                    dest, src, destOrigin, srcOrigin, regionSize);
+                    dest, src, destOrigin, srcOrigin, regionSize, useThreadPool);
             break;
         default:
             assert(false && "Unknown data type!");
@@ -194,6 +375,20 @@ int computePaddedTileDim(int maxTileDim,
     int tileDim = weightDim + stride * numStrides;
     return tileDim - padding;
 }
+
+// Returns true if a tile of the given shape, tiled along the outermost
+// dimension only, is one contiguous block of the tensor's storage.
+bool isContiguousTile(const TensorShape& tensorShape,
+                      const TensorShape& tileShape) {
+    if (tileShape.getLayout() != tensorShape.getLayout())
+        return false;
+    for (int i = 1; i < tensorShape.ndims(); i++) {
+        if (tileShape[i] != tensorShape[i] ||
+            tileShape.getStorageDim(i) != tensorShape.getStorageDim(i))
+            return false;
+    }
+    return true;
+}
 }  // namespace internal
 
 TiledTensor generateTiledTensorPerBatchNC(Tensor* tensor,
@@ -217,7 +412,13 @@ TiledTensor generateTiledTensorPerBatchNC(Tensor* tensor,
         std::string tileName = op->getName() + ":" + tensor->getName() +
                                "/tile:" + std::to_string((int)tileIndex);
         Tensor* tile = new Tensor(tileName, currentShape);
-        tile->allocateStorage(tensor->getDataType());
+        // Every tile is a contiguous slice of the tensor, so it can be a view
+        // unless it is padded.
+        if (tensor->containsData() &&
+            currentShape.storageSize() == currentTileSize)
+            tile->shareStorage(tensor, srcOffset);
+        else
+            tile->allocateStorage(tensor->getDataType());
         tiledTensor.setTile(tileIndex, { srcOffset }, tile, copyData);
         srcOffset += currentTileSize;
         remainingSize -= currentTileSize;
@@ -230,16 +431,20 @@ TiledTensor generateTiledTensorPerBatchNC(Tensor* tensor,
     return tiledTensor;
 }
 
-TiledTensor generateTiledTensorWithStrideAndPadding(
-        Tensor* tensor,
-        const TensorShape& tileShape,
-        Operator* op,
-        int fieldRows,
-        int fieldCols,
-        int rowStride,
-        int colStride,
-        PaddingType paddingType,
-        bool copyData) {
+namespace {
+// Does the work of generateTiledTensorWithStrideAndPadding(). Without
+// allocateTiles, only the tiles that are views of the tensor get storage, and
+// the rest are left for TiledTensor::packTiles() to place.
+TiledTensor tileTensorWithStrideAndPadding(Tensor* tensor,
+                                           const TensorShape& tileShape,
+                                           Operator* op,
+                                           int fieldRows,
+                                           int fieldCols,
+                                           int rowStride,
+                                           int colStride,
+                                           PaddingType paddingType,
+                                           bool copyData,
+                                           bool allocateTiles) {
     const TensorShape& inputShape = tensor->getShape();
     const int ndims = inputShape.ndims();
     DataLayout layout = inputShape.getLayout();
@@ -308,7 +513,15 @@ TiledTensor generateTiledTensorWithStrideAndPadding(
             std::string tileName = op->getName() + ":" + tensor->getName() +
                                    "/tile:" + std::to_string((int)tileIndex);
             Tensor* tile = new Tensor(tileName, currentShape);
-            tile->allocateStorage(tensor->getDataType());
+            if (tensor->containsData() &&
+                internal::isContiguousTile(inputShape, currentShape)) {
+                tile->shareStorage(
+                        tensor,
+                        currentOrigin[0] * (inputShape.storageSize() /
+                                            inputShape.getStorageDim(0)));
+            } else if (allocateTiles) {
+                tile->allocateStorage(tensor->getDataType());
+            }
             tiledTensor.setTile(tileIndex, currentOrigin, tile, false);
             for (int i = ndims - 1; i >= 0; i--) {
                 currentOrigin[i] += currentShape[i];
@@ -331,6 +544,22 @@ TiledTensor generateTiledTensorWithStrideAndPadding(
             << ", number of tiles: " << tiledTensor.size() << "\n";
     return tiledTensor;
 }
+}  // namespace
+
+TiledTensor generateTiledTensorWithStrideAndPadding(
+        Tensor* tensor,
+        const TensorShape& tileShape,
+        Operator* op,
+        int fieldRows,
+        int fieldCols,
+        int rowStride,
+        int colStride,
+        PaddingType paddingType,
+        bool copyData) {
+    return tileTensorWithStrideAndPadding(tensor, tileShape, op, fieldRows,
+                                          fieldCols, rowStride, colStride,
+                                          paddingType, copyData, true);
+}
 
 TiledTensor generateTiledTensor(Tensor* tensor,
                                 const TensorShape& tileShape,
@@ -340,6 +569,18 @@ TiledTensor generateTiledTensor(Tensor* tensor,
             tensor, tileShape, op, 0, 0, 1, 1, ValidPadding, copyData);
 }
 
+TiledTensor generatePackedTiledTensor(Tensor* tensor,
+                                      const TensorShape& tileShape,
+                                      Operator* op) {
+    TiledTensor tiledTensor = tileTensorWithStrideAndPadding(
+            tensor, tileShape, op, 0, 0, 1, 1, ValidPadding, false, false);
+    // Reuse the tiles packed by an earlier tiling of the same data, if any.
+    Workspace* workspace = op->getWorkspace();
+    tiledTensor.packTiles(workspace->getPackedTiles(tensor, tileShape));
+    workspace->addPackedTiles(tensor, tileShape, tiledTensor.getPackedData());
+    return tiledTensor;
+}
+
 void flattenTiledTensor(TiledTensor& tiledTensor, Tensor* destTensor) {
     const TensorShape& tensorShape = destTensor->getShape();
     int ndims = tensorShape.ndims();
@@ -348,8 +589,14 @@ void flattenTiledTensor(TiledTensor& tiledTensor, Tensor* destTensor) {
          ++tileIndex) {
         Tensor* tile = tiledTensor[tileIndex];
         const TensorShape& tileShape = tile->getShape();
-        copyRawTensorData(
-                destTensor, tile, destOffset, 0, tileShape.storageSize());
+        // Tiles that are views of the destination have their data in place.
+        const char* destData =
+                reinterpret_cast<const char*>(destTensor->rawData()) +
+                (size_t)destOffset * destTensor->getDataTypeSize();
+        if (tile->rawData() != destData) {
+            copyRawTensorData(
+                    destTensor, tile, destOffset, 0, tileShape.storageSize());
+        }
         destOffset += tileShape.storageSize();
     }
 }
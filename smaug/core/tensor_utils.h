@@ -68,51 +68,84 @@ void writeTensorToOstream(std::ostream& os, const Tensor& tensor) {
 
 namespace internal {
 
+/**
+ * A copy of a tensor region, compiled into up to kMaxTensorRank nested loops
+ * whose innermost body copies one contiguous run of bytes.
+ *
+ * Dimensions that the region covers fully in both tensors are folded into the
+ * runs, and loops that are contiguous with the next one are merged, so the
+ * copy takes as few, and as long, runs as possible.
+ */
+struct StridedCopy {
+    /** The number of loops around the runs. */
+    int numLoops;
+    /** The trip count of each loop, from the outermost. */
+    int counts[TensorIndexIterator::kMaxTensorRank];
+    /** The strides of each loop in bytes. */
+    int64_t srcStrides[TensorIndexIterator::kMaxTensorRank];
+    int64_t destStrides[TensorIndexIterator::kMaxTensorRank];
+    /** The byte offsets of the first run. */
+    int64_t srcOffset;
+    int64_t destOffset;
+    /** The size of each contiguous run. */
+    int64_t runBytes;
+
+    /** Returns the total number of bytes copied. */
+    int64_t totalBytes() const {
+        int64_t bytes = runBytes;
+        for (int i = 0; i < numLoops; i++)
+            bytes *= counts[i];
+        return bytes;
+    }
+};
+
+/**
+ * Compiles a region copy between tensors of the given shapes into a
+ * StridedCopy. See copyTensorRegion() for the meaning of the arguments.
+ */
+StridedCopy compileRegionCopy(const TensorShape& destShape,
+                              const TensorShape& srcShape,
+                              const std::vector<int>& destOrigin,
+                              const std::vector<int>& srcOrigin,
+                              const std::vector<int>& regionSize,
+                              int elementSize);
+
+/**
+ * Runs a compiled region copy.
+ *
+ * Runs that are part of a copy larger than the last-level cache are written
+ * with non-temporal stores, so the copy doesn't evict the data around it. If
+ * useThreadPool is set, large copies are split along the outermost loop over
+ * the thread pool and the calling thread.
+ */
+void runStridedCopy(const StridedCopy& copy,
+                    char* dest,
+                    const char* src,
+                    bool useThreadPool);
+
 template <typename DType>
 void copyTensorRegion(Tensor* dest,
                       Tensor* src,
                       const std::vector<int>& destOrigin,
                       const std::vector<int>& srcOrigin,
-                      const std::vector<int>& regionSize) {
-    const TensorShape& srcShape = src->getShape();
-    const TensorShape& destShape = dest->getShape();
-    TensorShape regionShape(
-            regionSize, srcShape.getLayout(), srcShape.getAlignment());
-    const int ndims = srcShape.ndims();
-    auto destIt = TensorRegionIndexIterator(destShape, destOrigin, regionSize);
-    auto srcIt = TensorRegionIndexIterator(srcShape, srcOrigin, regionSize);
-
-    // We know where to copy data from and how much data we should copy (the
-    // data region), now starting from the last dimension, we figure out how
-    // much contiguous data there exists such that we can apply more efficient
-    // data copy mechanisms (memcpy).
-    std::vector<int> contiguousRegion(ndims, 1);
-    int contiguousSize = 1;
-    for (int i = ndims - 1; i >= 0; i--) {
-        contiguousSize *= regionShape.getStorageDim(i);
-        contiguousRegion[i] = regionShape[i];
-        // If we find a region dimension smaller than that of either src or
-        // dest tensor, then the next region dimension must not be contiguous.
-        if (regionShape[i] < srcShape[i] || regionShape[i] < destShape[i])
-            break;
-    }
-
-    // Copy the data region from the src tensor to the dest tensor.
+                      const std::vector<int>& regionSize,
+                      bool useThreadPool) {
     DType* destPtr = dest->template data<DType>();
     DType* srcPtr = src->template data<DType>();
-    while (!srcIt.end() && !destIt.end()) {
 #ifdef PEDANTIC
+    auto destIt = TensorRegionIndexIterator(
+            dest->getShape(), destOrigin, regionSize);
+    auto srcIt = TensorRegionIndexIterator(
+            src->getShape(), srcOrigin, regionSize);
+    for (; !srcIt.end() && !destIt.end(); ++srcIt, ++destIt)
         destPtr[destIt] = srcPtr[srcIt];
-        ++destIt;
-        ++srcIt;
 #else
-        memcpy(&destPtr[destIt],
-               &srcPtr[srcIt],
-               contiguousSize * sizeof(DType));
-        destIt += contiguousRegion;
-        srcIt += contiguousRegion;
+    StridedCopy copy = compileRegionCopy(dest->getShape(), src->getShape(),
+                                         destOrigin, srcOrigin, regionSize,
+                                         sizeof(DType));
+    runStridedCopy(copy, reinterpret_cast<char*>(destPtr),
+                   reinterpret_cast<const char*>(srcPtr), useThreadPool);
 #endif
-    }
 }
 
 template <typename DType>
@@ -164,12 +197,14 @@ void copyTensorData(Tensor* dest,
  * @param destOrigin The start of the copied region in the destination.
  * @param srcOrigin The start of the copied region in the source.
  * @param regionSize The size of the region.
+ * @param useThreadPool Split large copies over the thread pool.
  */
 void copyTensorRegion(Tensor* dest,
                       Tensor* src,
                       std::vector<int> destOrigin,
                       std::vector<int> srcOrigin,
-                      std::vector<int> regionSize);
+                      std::vector<int> regionSize,
+                      bool useThreadPool = false);
 
 /**
  * Similar to copyTensorRegion, but the region is a contiguous block of
@@ -203,6 +238,9 @@ void copyRawTensorData(
  * tileShape, without concern for strides, overlap, or padding. Thus, this is
  * usually useful only for unary and elementwise operators.
  *
+ * If the Tensor has storage, tiles without alignment padding are views of it,
+ * and need no copies.
+ *
  * @param tensor The Tensor to tile.
  * @param tileShape The maximum size of each tile.
  * @param op The Operator that will be consuming this TiledTensor.
@@ -219,6 +257,10 @@ TiledTensor generateTiledTensorPerBatchNC(Tensor* tensor,
  * Depending on the operator that needs this TiledTensor, tiles may need to
  * overlap each other (e.g. for a convolutional filter window).
  *
+ * If the Tensor has storage and is tiled along its outermost dimension only,
+ * every tile is a contiguous block of it, and the tiles are views of the
+ * Tensor that need no copies.
+ *
  * @param tensor The Tensor to tile.
  * @param tileShape The maximum size of each tile.
  * @param op The Operator that will be consuming this TiledTensor.
@@ -257,6 +299,19 @@ TiledTensor generateTiledTensor(Tensor* tensor,
                                 Operator* op,
                                 bool copyData = false);
 
+/**
+ * Generates a TiledTensor of constant data, such as weights, whose tiles are
+ * packed into one contiguous buffer and filled right away.
+ *
+ * The packed buffer is kept in the Operator's Workspace, so tiling the same
+ * data the same way again reuses it without allocating or copying anything.
+ *
+ * @sa TiledTensor::packTiles()
+ */
+TiledTensor generatePackedTiledTensor(Tensor* tensor,
+                                      const TensorShape& tileShape,
+                                      Operator* op);
+
 /**
  * Copies the data from each tile in a TiledTensor into a destination Tensor as
  * a contiguous block of memory, as if only one dimension ever existed.
@@ -2,6 +2,8 @@
 #define _CORE_WORKSPACE_H_
 
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
 
 #include "smaug/core/tensor.h"
@@ -18,6 +20,7 @@ class Workspace {
   public:
     Workspace() {}
     ~Workspace() {
+        releaseTiledTensors();
         for (auto& tensor : tensors)
             delete tensor.second;
     }
@@ -30,10 +33,63 @@ class Workspace {
     void addTiledTensor(TiledTensor& tiledTensor) {
         for (auto i = tiledTensor.startIndex(); !i.end(); ++i) {
             Tensor* tensor = tiledTensor[i];
+            // A tensor that fits in one tile is its own tile, and it stays
+            // owned as an ordinary tensor.
+            auto it = tensors.find(tensor->getName());
+            if (it != tensors.end() && it->second == tensor &&
+                tiles.find(tensor) == tiles.end())
+                continue;
             tensors[tensor->getName()] = static_cast<TensorBase*>(tensor);
+            tiles.insert(static_cast<TensorBase*>(tensor));
         }
     }
 
+    /**
+     * Deletes all the tiles added by addTiledTensor().
+     *
+     * Operators regenerate their tiles every time they are tiled, so this must
+     * be called before tiling a Network again, once none of the previous
+     * TiledTensors are in use.
+     */
+    void releaseTiledTensors() {
+        for (auto tile : tiles) {
+            auto it = tensors.find(tile->getName());
+            if (it != tensors.end() && it->second == tile)
+                tensors.erase(it);
+            delete tile;
+        }
+        tiles.clear();
+    }
+
+    /**
+     * Returns the buffer of tiles packed by an earlier
+     * generatePackedTiledTensor() of the Tensor with the same tile shape, or
+     * null if there is none or the Tensor's data has changed since.
+     */
+    std::shared_ptr<void> getPackedTiles(const Tensor* tensor,
+                                         const TensorShape& tileShape) const {
+        auto it = packedTiles.find(tensor);
+        if (it == packedTiles.end())
+            return nullptr;
+        const PackedTiles& packed = it->second;
+        if (!(packed.tileShape == tileShape) ||
+            packed.tileShape.getAlignment() != tileShape.getAlignment() ||
+            packed.origData != tensor->rawData() ||
+            packed.dataVersion != tensor->getDataVersion())
+            return nullptr;
+        return packed.data;
+    }
+
+    /** Keeps the packed tiles of a Tensor for getPackedTiles(). */
+    void addPackedTiles(const Tensor* tensor,
+                        const TensorShape& tileShape,
+                        const std::shared_ptr<void>& data) {
+        if (!data)
+            return;
+        packedTiles[tensor] = { tileShape, tensor->rawData(),
+                                tensor->getDataVersion(), data };
+    }
+
     Tensor* getTensor(const std::string& name) const {
         if (tensors.find(name) == tensors.end())
             return nullptr;
@@ -44,8 +100,22 @@ class Workspace {
         return getTensor(op->getName());
     }
 
+    /** Returns the number of Tensors, tiles included. */
+    int getNumTensors() const { return tensors.size(); }
+
    protected:
     std::map<std::string, TensorBase*> tensors;
+    /** Tiles of TiledTensors, which are also named in the tensors map. */
+    std::set<TensorBase*> tiles;
+
+    struct PackedTiles {
+        TensorShape tileShape;
+        const void* origData;
+        uint64_t dataVersion;
+        std::shared_ptr<void> data;
+    };
+    /** Packed tiles of constant Tensors, kept across tilings. */
+    std::map<const Tensor*, PackedTiles> packedTiles;
 };
 
 }
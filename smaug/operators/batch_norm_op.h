@@ -101,6 +101,11 @@ class BatchNormOp : public FusedActivationOp {
         return kNumInputs * inputs.at(Mean)->getShape().size();
     }
 
+    int64_t getNumFlops() const override {
+        // (x - mean) * variance * gamma + beta, per element.
+        return 4 * (int64_t)outputs.at(Outputs)->getShape().size();
+    }
+
     std::vector<TensorBase*> getParameterizableInputs() override {
         return { inputs[Mean], inputs[Variance], inputs[Gamma], inputs[Beta] };
     }
@@ -1,5 +1,9 @@
+#include <algorithm>
+
 #include "smaug/core/globals.h"
+#include "smaug/core/roofline.h"
 #include "smaug/operators/common.h"
+#include "smaug/utility/thread_pool.h"
 
 namespace smaug {
 
@@ -13,6 +17,7 @@ void mapArrayToAccel(unsigned reqCode,
                      const char* arrayName,
                      void* baseAddr,
                      size_t size) {
+    roofline::recordSpadTraffic(size);
     if (runningInSimulation) {
         mapArrayToAccelerator(reqCode, arrayName, baseAddr, size);
     }
@@ -26,6 +31,31 @@ void setArrayMemTypeIfSimulating(unsigned reqCode,
     }
 }
 
+bool shouldPipelineTileCopies() {
+#ifdef TRACE_MODE
+    return false;
+#else
+    return pipelineTileCopies && !runningInSimulation;
+#endif
+}
+
+void splitKernelAcrossThreads(int n,
+                              const std::function<void(int, int)>& func) {
+#ifdef TRACE_MODE
+    bool split = false;
+#else
+    bool split = !runningInSimulation && !fastForwardMode && threadPool &&
+                 threadPool->size() > 0 && n > 1;
+#endif
+    if (!split) {
+        func(0, n);
+        return;
+    }
+    // The calling thread takes a chunk too.
+    int numChunks = std::min(n, threadPool->size() + 1);
+    threadPool->parallelFor(0, n, FRAC_CEIL(n, numChunks), func);
+}
+
 }  // namespace smaug
 
 #ifdef __cplusplus
@@ -32,6 +32,7 @@ extern "C" {
 // These functions should be called from C++ files and not be included in C
 // files.
 
+#include <functional>
 #include <string>
 #include <utility>
 #include <memory>
@@ -152,6 +153,27 @@ void setArrayMemTypeIfSimulating(unsigned reqCode,
                                  const char* arrayName,
                                  MemoryType memType);
 
+/**
+ * Returns true if operators should overlap copying data to and from their
+ * tiles with running the kernels (see pipelineTileCopies). This only applies
+ * to native runs, since simulation and trace generation measure tensor
+ * preparation and finalization as phases of their own.
+ */
+bool shouldPipelineTileCopies();
+
+/**
+ * Calls func(start, end) on chunks of [0, n) in parallel on the thread pool,
+ * and returns once all of them have finished. Reference operators use this to
+ * split a kernel over images or channels whose results are disjoint parts of
+ * the output.
+ *
+ * In simulation and trace generation, where every kernel call is an
+ * accelerator invocation of its own, or without a thread pool, this calls
+ * func(0, n) once.
+ */
+void splitKernelAcrossThreads(int n,
+                              const std::function<void(int, int)>& func);
+
 }  // namespace smaug
 #endif
 
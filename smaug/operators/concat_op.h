@@ -77,7 +77,8 @@ class ConcatOp : public Operator {
                              input,
                              dstOrigin,
                              std::vector<int>(ndims, 0),
-                             input->getShape().dims());
+                             input->getShape().dims(),
+                             /* useThreadPool */ true);
             dstOrigin[concatAxis] += input->dim(concatAxis);
         }
     }
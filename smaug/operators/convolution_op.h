@@ -126,6 +126,18 @@ class ConvolutionOp : public FusedActivationOp {
         return inputs.at(Kernels)->getShape().size();
     }
 
+    int64_t getNumMacs() const override {
+        // Each output pixel is the dot product of one filter with the input
+        // window, which covers kernels.size() / output channels elements. This
+        // holds for depthwise convolutions as well.
+        const TensorShape& outputShape = outputs.at(Outputs)->getShape();
+        bool isNCHW = outputShape.getLayout() == DataLayout::NCHW;
+        int outputChannels = outputShape[isNCHW ? 1 : 3];
+        int64_t macsPerOutput =
+                inputs.at(Kernels)->getShape().size() / outputChannels;
+        return macsPerOutput * outputShape.size();
+    }
+
     std::vector<TensorBase*> getParameterizableInputs() override {
         return { inputs[Kernels] };
     }
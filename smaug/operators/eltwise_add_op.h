@@ -22,6 +22,7 @@ class EltwiseAddOp : public EltwiseOp<Backend> {
             : EltwiseOp<Backend>(name, OpType::EltwiseAdd, workspace) {}
 
     void run() override {}
+    bool supportsInPlace() const override { return true; }
 };
 
 REGISTER_SPECIAL_OP(EltwiseAddOp, ReferenceBackend);
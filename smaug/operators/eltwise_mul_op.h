@@ -22,6 +22,7 @@ class EltwiseMulOp : public EltwiseOp<Backend> {
             : EltwiseOp<Backend>(name, OpType::EltwiseMul, workspace) {}
 
     void run() override {}
+    bool supportsInPlace() const override { return true; }
 };
 
 REGISTER_SPECIAL_OP(EltwiseMulOp, ReferenceBackend);
@@ -23,6 +23,7 @@ class EluOp : public UnaryOp<Backend> {
             : UnaryOp<Backend>(name, OpType::ELU, workspace), alpha(_alpha) {}
 
     void run() override {}
+    bool supportsInPlace() const override { return true; }
 
     void setAlpha(float _alpha) { alpha = _alpha; }
     float getAlpha() const { return alpha; }
@@ -84,6 +84,12 @@ class InnerProductOp : public FusedActivationOp {
         return inputs.at(Weights)->getShape().size();
     }
 
+    int64_t getNumMacs() const override {
+        const TensorShape& inputShape = inputs.at(Inputs)->getShape();
+        return (int64_t)inputShape.size() *
+               outputs.at(Outputs)->getShape()[1];
+    }
+
     std::vector<TensorBase*> getParameterizableInputs() override {
         return { inputs[Weights] };
     }
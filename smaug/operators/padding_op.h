@@ -56,7 +56,8 @@ class PaddingOp : public Operator {
             paddingBegin.push_back(paddingSize.at(2 * i));
             srcOrigin.push_back(0);
         }
-        copyTensorRegion(output, input, paddingBegin, srcOrigin, inputDims);
+        copyTensorRegion(output, input, paddingBegin, srcOrigin, inputDims,
+                         /* useThreadPool */ true);
     }
 
     // Optional override for testing purposes.
@@ -92,6 +92,12 @@ class PoolingOp : public Operator {
 
     void createAllTensors() override { createOutputTensors(); }
 
+    int64_t getNumFlops() const override {
+        // One comparison or addition per element of every pooling window.
+        return (int64_t)outputs.at(Outputs)->getShape().size() *
+               poolingRowSize * poolingColSize;
+    }
+
     bool isSamplingSupported() const override { return true; }
     void setSamplingInfo(const SamplingInfo& _sampling) override {
         sampling = _sampling;
@@ -238,22 +238,53 @@ void BatchNormOp<ReferenceBackend>::run() {
                     kernelShape.storageSize() * sizeof(float));
     mapArrayToAccel(ref::kBatchNormHw, "result", outputData,
                     outputShape.storageSize() * sizeof(float));
+    // Split the batch across threads. A single NCHW image is split across its
+    // channels instead, since each of them is a contiguous plane.
+    int numImages = inputShape[0];
+    int imageSize = inputShape.storageSize() / numImages;
     if (isPostConv) {
         bool isNCHW = input->getShape().getLayout() == NCHW;
         auto func = isNCHW ? ref_batch_norm_nchw_post_conv
                            : ref_batch_norm_nhwc_post_conv;
-        invokeKernel(ref::kBatchNormHw, func, inputData, meanData, varianceData,
-                     gammaData, betaData, outputData, inputShape[0],
-                     inputShape[1], inputShape[2], inputShape[3],
-                     inputShape.getPadding(3), kernelShape.getPadding(3),
-                     actInfo.function, actInfo.params);
+        bool splitChannels = numImages == 1 && isNCHW;
+        int numChannels = inputShape[1];
+        splitKernelAcrossThreads(
+                splitChannels ? numChannels : numImages,
+                [&](int start, int end) {
+                    int chunkImages = splitChannels ? 1 : end - start;
+                    // The channels in NCHW, and the rows in NHWC.
+                    int chunkDim1 =
+                            splitChannels ? end - start : inputShape[1];
+                    int offset = splitChannels
+                                         ? start * (imageSize / numChannels)
+                                         : start * imageSize;
+                    int weightOffset = splitChannels ? start : 0;
+                    invokeKernel(ref::kBatchNormHw, func, inputData + offset,
+                                 meanData + weightOffset,
+                                 varianceData + weightOffset,
+                                 gammaData + weightOffset,
+                                 betaData + weightOffset, outputData + offset,
+                                 chunkImages, chunkDim1, inputShape[2],
+                                 inputShape[3], inputShape.getPadding(3),
+                                 kernelShape.getPadding(3), actInfo.function,
+                                 actInfo.params);
+                });
     } else {
         assert(inputShape.getLayout() == DataLayout::NC);
         assert(outputShape.getLayout() == DataLayout::NC);
-        invokeKernel(ref::kBatchNormHw, ref_batch_norm_post_fc, inputData,
-                     meanData, varianceData, gammaData, betaData, outputData,
-                     inputShape[0], inputShape[1], inputShape.getPadding(1),
-                     actInfo.function, actInfo.params);
+        splitKernelAcrossThreads(numImages, [&](int start, int end) {
+            // The kernel loads as many weights as inputs, so a part of the
+            // batch is normalized one input at a time.
+            int chunkImages = start == 0 && end == numImages ? numImages : 1;
+            for (int i = start; i < end; i += chunkImages) {
+                invokeKernel(ref::kBatchNormHw, ref_batch_norm_post_fc,
+                             inputData + i * imageSize, meanData, varianceData,
+                             gammaData, betaData, outputData + i * imageSize,
+                             chunkImages, inputShape[1],
+                             inputShape.getPadding(1), actInfo.function,
+                             actInfo.params);
+            }
+        });
     }
 }
 
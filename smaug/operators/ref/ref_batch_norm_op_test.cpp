@@ -259,3 +259,32 @@ TEST_CASE_METHOD(SmaugTest, "Reference batch norm operator", "[refop]") {
         }
     }
 }
+
+TEST_CASE_METHOD(SmaugTest,
+                 "Reference batch norm across threads",
+                 "[refop]") {
+    auto runBatchNorm = [&](const TensorShape& inputShape) {
+        auto bnOp = new BatchNormOp<ReferenceBackend>("batchnorm", workspace());
+        Tensor* input = new Tensor("input", inputShape);
+        workspace()->addTensor(input);
+        bnOp->setInput(input, 0);
+        createAndFillTensorsWithData<float>(bnOp, fillTensorWithSteps);
+        verifyThreadedRun(bnOp);
+    };
+
+    SECTION("Batch norm after convolution") {
+        SECTION("A single NCHW image is split across its channels") {
+            runBatchNorm(TensorShape({ 1, 6, 5, 5 }, DataLayout::NCHW));
+        }
+        SECTION("An NCHW batch is split across its images") {
+            runBatchNorm(TensorShape({ 4, 3, 5, 5 }, DataLayout::NCHW));
+        }
+        SECTION("An NHWC batch is split across its images") {
+            runBatchNorm(TensorShape({ 4, 5, 5, 8 }, DataLayout::NHWC));
+        }
+    }
+
+    SECTION("Batch norm after FC") {
+        runBatchNorm(TensorShape({ 5, 16 }, DataLayout::NC));
+    }
+}
@@ -387,13 +387,27 @@ void ConvolutionOp<ReferenceBackend>::run() {
     int rowIdx = isNCHW ? 2 : 1;
     int colIdx = isNCHW ? 3 : 2;
     int chanIdx = isNCHW ? 1 : 3;
-    invokeKernel(ref::kConvolutionHw, func, inputData, kernelData, outputData,
-                 inputShape[0], inputShape[chanIdx], inputShape[rowIdx],
-                 inputShape[colIdx], inputShape.getPadding(3), kernelShape[0],
-                 kernelShape[rowIdx], kernelShape[colIdx],
-                 kernelShape.getPadding(3), getRowStride(), getColStride(),
-                 outputShape[rowIdx], outputShape[colIdx],
-                 outputShape.getPadding(3), actInfo.function, actInfo.params);
+    // A single NCHW image is split across threads by its output channels,
+    // since each of them is a contiguous plane of the output.
+    int numKernels = kernelShape[0];
+    int kernelSize = kernelShape.storageSize() / numKernels;
+    int outputPlaneSize = outputShape.storageSize() / numKernels;
+    bool splitKernels = inputShape[0] == 1 && isNCHW;
+    splitKernelAcrossThreads(
+            splitKernels ? numKernels : 1, [&](int start, int end) {
+                int chunkKernelNum = splitKernels ? end - start : numKernels;
+                invokeKernel(ref::kConvolutionHw, func, inputData,
+                             kernelData + start * kernelSize,
+                             outputData + start * outputPlaneSize,
+                             inputShape[0], inputShape[chanIdx],
+                             inputShape[rowIdx], inputShape[colIdx],
+                             inputShape.getPadding(3), chunkKernelNum,
+                             kernelShape[rowIdx], kernelShape[colIdx],
+                             kernelShape.getPadding(3), getRowStride(),
+                             getColStride(), outputShape[rowIdx],
+                             outputShape[colIdx], outputShape.getPadding(3),
+                             actInfo.function, actInfo.params);
+            });
 }
 
 }  // namespace smaug
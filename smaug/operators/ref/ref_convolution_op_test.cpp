@@ -275,3 +275,29 @@ TEST_CASE_METHOD(SmaugTest, "Reference convolution operator", "[refop]") {
         }
     }
 }
+
+TEST_CASE_METHOD(SmaugTest,
+                 "Reference convolution across threads",
+                 "[refop]") {
+    auto runConv = [&](const TensorShape& inputShape, int numKernels) {
+        auto convOp = new ConvolutionOp<ReferenceBackend>("conv", workspace());
+        Tensor* input = new Tensor("input", inputShape);
+        input->allocateStorage<float>();
+        fillTensorWithSteps(input);
+        workspace()->addTensor(input);
+        convOp->setInput(input, 0);
+        convOp->setPadding(SamePadding);
+        convOp->setWeightDims(3, 3, numKernels);
+        convOp->setStride(1, 1);
+        convOp->createAllTensors();
+        allocateAllTensors<float>(convOp);
+        Tensor* weights = convOp->getInput(1);
+        float* weightsData = weights->data<float>();
+        for (int i = 0; i < weights->getShape().storageSize(); i++)
+            weightsData[i] = (i % 5) - 2;
+        verifyThreadedRun(convOp);
+    };
+
+    // A single NCHW image is split across its kernels.
+    runConv(TensorShape({ 1, 2, 6, 6 }, DataLayout::NCHW), 7);
+}
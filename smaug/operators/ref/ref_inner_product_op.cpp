@@ -160,10 +160,37 @@ void InnerProductOp<ReferenceBackend>::run() {
                                   : ref_inner_product_ab_times_bc;
     int actIdx = weightsTransposed ? 1 : 0;
     int neuronIdx = weightsTransposed ? 0 : 1;
-    invokeKernel(ref::kInnerProductHw, func, inputData, weightData, outputData,
-                 inputShape[0], weightShape[actIdx], weightShape[neuronIdx],
-                 inputShape.getPadding(1), weightShape.getPadding(1),
-                 outputShape.getPadding(1), actInfo.function, actInfo.params);
+    // Split the batch across threads. A single input with transposed weights
+    // is split across its output neurons instead, since each of them is a row
+    // of the weights and one element of the output.
+    int batchSize = inputShape[0];
+    int numNeurons = weightShape[neuronIdx];
+    bool splitNeurons = batchSize == 1 && weightsTransposed &&
+                        outputShape.getPadding(1) == 0;
+    splitKernelAcrossThreads(
+            splitNeurons ? numNeurons : batchSize, [&](int start, int end) {
+                float* chunkInput = inputData;
+                float* chunkWeights = weightData;
+                float* chunkOutput = outputData;
+                int chunkBatchSize = batchSize;
+                int chunkNeurons = numNeurons;
+                if (splitNeurons) {
+                    chunkWeights += start * weightShape.getStorageDim(1);
+                    chunkOutput += start;
+                    chunkNeurons = end - start;
+                } else {
+                    chunkInput += start * inputShape.getStorageDim(1);
+                    chunkOutput += start * outputShape.getStorageDim(1);
+                    chunkBatchSize = end - start;
+                }
+                invokeKernel(ref::kInnerProductHw, func, chunkInput,
+                             chunkWeights, chunkOutput, chunkBatchSize,
+                             weightShape[actIdx], chunkNeurons,
+                             inputShape.getPadding(1),
+                             weightShape.getPadding(1),
+                             outputShape.getPadding(1), actInfo.function,
+                             actInfo.params);
+            });
 }
 
 }  // namespace smaug
@@ -168,3 +168,33 @@ TEST_CASE_METHOD(SmaugTest, "Reference inner product operator", "[refop]") {
         }
     }
 }
+
+TEST_CASE_METHOD(SmaugTest,
+                 "Reference inner product across threads",
+                 "[refop]") {
+    auto runMatMul = [&](int batchSize, bool transposed) {
+        auto matMulOp =
+                new InnerProductOp<ReferenceBackend>("matmul", workspace());
+        TensorShape inputShape({ batchSize, 12 }, DataLayout::NC);
+        Tensor* input = new Tensor("input", inputShape);
+        input->allocateStorage<float>();
+        fillTensorWithSteps(input);
+        workspace()->addTensor(input);
+        matMulOp->setInput(input, 0);
+        matMulOp->setNumOutputs(9);
+        matMulOp->createAllTensors();
+        allocateAllTensors<float>(matMulOp);
+        Tensor* weights = matMulOp->getInput(1);
+        float* weightsData = weights->data<float>();
+        for (int i = 0; i < weights->getShape().storageSize(); i++)
+            weightsData[i] = (i % 5) - 2;
+        if (transposed)
+            matMulOp->setInput(transposeWeights(weights, workspace()), 1);
+        verifyThreadedRun(matMulOp);
+    };
+
+    SECTION("A batch is split across its inputs") { runMatMul(5, false); }
+    SECTION("A single input is split across its neurons") {
+        runMatMul(1, true);
+    }
+}
@@ -0,0 +1,179 @@
+#include <string>
+
+#include "smaug/core/backend.h"
+#include "smaug/core/globals.h"
+#include "smaug/core/smaug_bench.h"
+#include "smaug/core/tensor.h"
+#include "smaug/core/workspace.h"
+#include "smaug/operators/batch_norm_op.h"
+#include "smaug/operators/convolution_op.h"
+#include "smaug/operators/inner_product_op.h"
+#include "smaug/operators/pooling_op.h"
+#include "smaug/operators/relu_op.h"
+
+using namespace smaug;
+
+namespace {
+
+std::string shapeName(const std::string& op, const std::vector<int>& dims) {
+    std::string name = op + " [";
+    for (int i = 0; i < dims.size(); i++)
+        name += (i ? "x" : "") + std::to_string(dims[i]);
+    return name + "]";
+}
+
+Tensor* createInput(Workspace* workspace, const TensorShape& shape) {
+    Tensor* input = new Tensor("input", shape);
+    float* data = input->allocateStorage<float>();
+    for (int i = 0; i < shape.storageSize(); i++)
+        data[i] = ((i % 17) - 8) * 0.0625f;
+    workspace->addTensor(input);
+    return input;
+}
+
+/** Allocates and zero-fills every tensor the operator created. */
+void allocateOperatorTensors(Operator* op) {
+    for (auto t : op->getInputs()) {
+        Tensor* tensor = static_cast<Tensor*>(t);
+        if (!tensor->containsData())
+            tensor->allocateStorage<float>();
+    }
+    for (auto t : op->getOutputs())
+        static_cast<Tensor*>(t)->allocateStorage<float>();
+}
+
+/**
+ * Benchmarks one run() of the operator, using its analytical FLOP and byte
+ * counts.
+ */
+void benchOperator(SmaugBenchmark& bench,
+                   const std::string& name,
+                   Operator* op) {
+    allocateOperatorTensors(op);
+    bench.run(name, op->getNumFlops(),
+              op->getBytesRead() + op->getBytesWritten(),
+              [&]() { op->run(); });
+}
+
+void benchConvolution(SmaugBenchmark& bench) {
+    // { channels, rows, cols, output channels, kernel size }. The
+    // convolution operators only infer single-image output shapes.
+    const std::vector<std::vector<int>> shapes = {
+        { 3, 32, 32, 32, 3 }, { 32, 16, 16, 64, 3 }, { 64, 8, 8, 128, 3 },
+        { 64, 16, 16, 64, 1 }, { 16, 32, 32, 32, 3 },
+    };
+    bench.printHeader("ConvolutionOp<ReferenceBackend> (NCHW, same padding)");
+    for (auto& shape : shapes) {
+        Workspace workspace;
+        auto op = new ConvolutionOp<ReferenceBackend>("conv", &workspace);
+        op->setInput(createInput(&workspace,
+                                 TensorShape({ 1, shape[0], shape[1],
+                                               shape[2] },
+                                             DataLayout::NCHW)),
+                     0);
+        op->setWeightDims(shape[4], shape[4], shape[3]);
+        op->setStride(1, 1);
+        op->setPadding(SamePadding);
+        op->createAllTensors();
+        benchOperator(bench, shapeName("conv", shape), op);
+        delete op;
+    }
+}
+
+void benchInnerProduct(SmaugBenchmark& bench) {
+    // { batch, input activations, output neurons }.
+    const std::vector<std::vector<int>> shapes = {
+        { 1, 1024, 256 }, { 1, 4096, 1024 }, { 16, 1024, 256 },
+    };
+    bench.printHeader("InnerProductOp<ReferenceBackend>");
+    for (auto& shape : shapes) {
+        Workspace workspace;
+        auto op = new InnerProductOp<ReferenceBackend>("fc", &workspace);
+        op->setInput(
+                createInput(&workspace, TensorShape({ shape[0], shape[1] },
+                                                    DataLayout::NC)),
+                0);
+        op->setNumOutputs(shape[2]);
+        op->createAllTensors();
+        benchOperator(bench, shapeName("fc", shape), op);
+        delete op;
+    }
+}
+
+void benchPooling(SmaugBenchmark& bench) {
+    // { batch, channels, rows, cols }, with 2x2 pooling and stride 2.
+    const std::vector<std::vector<int>> shapes = {
+        { 1, 32, 32, 32 }, { 1, 64, 16, 16 }, { 4, 16, 32, 32 },
+    };
+    bench.printHeader("MaxPoolingOp/AvgPoolingOp<ReferenceBackend>");
+    for (auto& shape : shapes) {
+        for (int isMax = 1; isMax >= 0; isMax--) {
+            Workspace workspace;
+            PoolingOp<ReferenceBackend>* op;
+            if (isMax)
+                op = new MaxPoolingOp<ReferenceBackend>("pool", &workspace);
+            else
+                op = new AvgPoolingOp<ReferenceBackend>("pool", &workspace);
+            op->setInput(createInput(&workspace,
+                                     TensorShape({ shape[0], shape[1],
+                                                   shape[2], shape[3] },
+                                                 DataLayout::NCHW)),
+                         0);
+            op->setPoolingSize(2, 2);
+            op->setPoolingStride(2, 2);
+            op->createAllTensors();
+            benchOperator(
+                    bench, shapeName(isMax ? "maxpool" : "avgpool", shape), op);
+            delete op;
+        }
+    }
+}
+
+void benchBatchNorm(SmaugBenchmark& bench) {
+    // { batch, channels, rows, cols }.
+    const std::vector<std::vector<int>> shapes = {
+        { 1, 32, 32, 32 }, { 1, 128, 16, 16 }, { 4, 64, 16, 16 },
+    };
+    bench.printHeader("BatchNormOp<ReferenceBackend>");
+    for (auto& shape : shapes) {
+        Workspace workspace;
+        auto op = new BatchNormOp<ReferenceBackend>("bn", &workspace);
+        op->setInput(createInput(&workspace,
+                                 TensorShape({ shape[0], shape[1], shape[2],
+                                               shape[3] },
+                                             DataLayout::NCHW)),
+                     0);
+        op->createAllTensors();
+        benchOperator(bench, shapeName("batchnorm", shape), op);
+        delete op;
+    }
+}
+
+void benchRelu(SmaugBenchmark& bench) {
+    const std::vector<int> sizes = { 4096, 65536, 1048576 };
+    bench.printHeader("ReluOp<ReferenceBackend>");
+    for (int size : sizes) {
+        Workspace workspace;
+        auto op = new ReluOp<ReferenceBackend>("relu", &workspace);
+        op->setInput(createInput(&workspace,
+                                 TensorShape({ 1, size }, DataLayout::NC)),
+                     0);
+        op->createAllTensors();
+        benchOperator(bench, shapeName("relu", { size }), op);
+        delete op;
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    SmaugBenchmark bench(argc, argv);
+    runningInSimulation = false;
+
+    benchConvolution(bench);
+    benchInnerProduct(bench);
+    benchPooling(bench);
+    benchBatchNorm(bench);
+    benchRelu(bench);
+    return 0;
+}
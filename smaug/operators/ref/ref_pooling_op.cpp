@@ -1,3 +1,4 @@
+#include <functional>
 #include <utility>
 
 #include "smaug/core/backend.h"
@@ -360,6 +361,34 @@ void ref_avg_pooling_nhwc(float* input,
 
 namespace smaug {
 
+namespace {
+
+/**
+ * Splits a pooling kernel across threads. Every channel of every image is
+ * pooled on its own, so NCHW data is split into its planes, which the kernel
+ * sees as images of one channel each. NHWC data is split across the batch.
+ *
+ * func(inputOffset, outputOffset, numImages, numChannels) invokes the kernel
+ * on a chunk.
+ */
+void splitPoolingAcrossThreads(
+        const TensorShape& inputShape,
+        const TensorShape& outputShape,
+        const std::function<void(int, int, int, int)>& func) {
+    bool isNCHW = inputShape.getLayout() == NCHW;
+    int numImages = inputShape[0];
+    int numChannels = isNCHW ? inputShape[1] : inputShape[3];
+    int numChunks = isNCHW ? numImages * numChannels : numImages;
+    int inputChunkSize = inputShape.storageSize() / numChunks;
+    int outputChunkSize = outputShape.storageSize() / numChunks;
+    splitKernelAcrossThreads(numChunks, [&](int start, int end) {
+        func(start * inputChunkSize, start * outputChunkSize, end - start,
+             isNCHW ? 1 : numChannels);
+    });
+}
+
+}  // namespace
+
 template <>
 void MaxPoolingOp<ReferenceBackend>::run() {
     auto input = getInput(Inputs);
@@ -386,11 +415,17 @@ void MaxPoolingOp<ReferenceBackend>::run() {
     int rowIdx = isNCHW ? 2 : 1;
     int colIdx = isNCHW ? 3 : 2;
     int chanIdx = isNCHW ? 1 : 3;
-    invokeKernel(ref::kPoolingHw, func, inputData, outputData, inputShape[0],
-                 inputShape[chanIdx], inputShape[rowIdx], inputShape[colIdx],
-                 inputShape.getPadding(3), outputShape[rowIdx],
-                 outputShape[colIdx], outputShape.getPadding(3), poolRowSize,
-                 poolColSize, poolRowStride, poolColStride);
+    splitPoolingAcrossThreads(
+            inputShape, outputShape, [&](int offset, int outputOffset,
+                                         int numImages, int numChannels) {
+                invokeKernel(ref::kPoolingHw, func, inputData + offset,
+                             outputData + outputOffset, numImages, numChannels,
+                             inputShape[rowIdx], inputShape[colIdx],
+                             inputShape.getPadding(3), outputShape[rowIdx],
+                             outputShape[colIdx], outputShape.getPadding(3),
+                             poolRowSize, poolColSize, poolRowStride,
+                             poolColStride);
+            });
 }
 
 template <>
@@ -415,11 +450,17 @@ void AvgPoolingOp<ReferenceBackend>::run() {
     int rowIdx = isNCHW ? 2 : 1;
     int colIdx = isNCHW ? 3 : 2;
     int chanIdx = isNCHW ? 1 : 3;
-    invokeKernel(ref::kPoolingHw, func, inputData, outputData, inputShape[0],
-                 inputShape[chanIdx], inputShape[rowIdx], inputShape[colIdx],
-                 inputShape.getPadding(3), outputShape[rowIdx],
-                 outputShape[colIdx], outputShape.getPadding(3), poolRowSize,
-                 poolColSize, poolRowStride, poolColStride);
+    splitPoolingAcrossThreads(
+            inputShape, outputShape, [&](int offset, int outputOffset,
+                                         int numImages, int numChannels) {
+                invokeKernel(ref::kPoolingHw, func, inputData + offset,
+                             outputData + outputOffset, numImages, numChannels,
+                             inputShape[rowIdx], inputShape[colIdx],
+                             inputShape.getPadding(3), outputShape[rowIdx],
+                             outputShape[colIdx], outputShape.getPadding(3),
+                             poolRowSize, poolColSize, poolRowStride,
+                             poolColStride);
+            });
 }
 
 }  // namespace smaug
@@ -161,3 +161,36 @@ TEST_CASE_METHOD(SmaugTest,
         }
     }
 }
+
+TEST_CASE_METHOD(SmaugTest,
+                 "Reference pooling across threads",
+                 "[refop]") {
+    auto runPooling = [&](const TensorShape& inputShape) {
+        Tensor* input = new Tensor("input", inputShape);
+        input->allocateStorage<float>();
+        fillTensorWithSteps(input);
+        workspace()->addTensor(input);
+        auto maxPoolOp =
+                new MaxPoolingOp<ReferenceBackend>("maxpool", workspace());
+        maxPoolOp->setPoolingSize(3, 3);
+        maxPoolOp->setPoolingStride(2, 2);
+        auto avgPoolOp =
+                new AvgPoolingOp<ReferenceBackend>("avgpool", workspace());
+        avgPoolOp->setPoolingSize(2, 2);
+        avgPoolOp->setPoolingStride(2, 2);
+        for (Operator* poolOp :
+             std::vector<Operator*>{ maxPoolOp, avgPoolOp }) {
+            poolOp->setInput(input, 0);
+            poolOp->createAllTensors();
+            allocateAllTensors<float>(poolOp);
+            verifyThreadedRun(poolOp);
+        }
+    };
+
+    SECTION("NCHW data is split into its planes") {
+        runPooling(TensorShape({ 2, 3, 8, 8 }, DataLayout::NCHW));
+    }
+    SECTION("NHWC data is split across the batch") {
+        runPooling(TensorShape({ 3, 8, 8, 4 }, DataLayout::NHWC));
+    }
+}
@@ -21,6 +21,7 @@ class ReluOp : public UnaryOp<Backend> {
             : UnaryOp<Backend>(name, OpType::ReLU, workspace), slope(_slope) {}
 
     void run() override {}
+    bool supportsInPlace() const override { return true; }
     void setSlope(float _slope) { slope = _slope; }
     float getSlope () const { return slope; }
 
@@ -1,8 +1,43 @@
+#include <algorithm>
+
+#include "smaug/core/globals.h"
 #include "smaug/core/tensor.h"
 #include "smaug/operators/reorder_op_impl.h"
+#include "smaug/utility/thread_pool.h"
 
 namespace smaug {
 
+namespace internal {
+
+namespace {
+
+/**
+ * Transposes smaller than this many elements run on the calling thread, since
+ * waking up the workers costs more than the transpose itself.
+ */
+constexpr int64_t kMinParallelTransposeElems = 64 * 1024;
+
+}  // namespace
+
+void parallelTranspose(int numTasks,
+                       int64_t elemsPerTask,
+                       const std::function<void(int)>& task) {
+    if (fastForwardMode || !threadPool || numTasks < 2 ||
+        numTasks * elemsPerTask < kMinParallelTransposeElems) {
+        for (int i = 0; i < numTasks; i++)
+            task(i);
+        return;
+    }
+    // A few tasks per thread let the faster threads take on more of them.
+    int grain = std::max(1, numTasks / (4 * (threadPool->size() + 1)));
+    threadPool->parallelFor(0, numTasks, grain, [&](int start, int end) {
+        for (int i = start; i < end; i++)
+            task(i);
+    });
+}
+
+}  // namespace internal
+
 void convertNchwToNhwc(Tensor* input, Tensor* output) {
     DataType datatype = input->getDataType();
     assert(input->ndims() == output->ndims() && input->ndims() == 4);
@@ -1,44 +1,192 @@
+#ifndef _OPERATORS_REORDER_OP_IMPL_H_
+#define _OPERATORS_REORDER_OP_IMPL_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+#ifdef __SSE__
+#include <xmmintrin.h>
+#endif
+
 #include "smaug/core/tensor.h"
 #include "smaug/core/tensor_utils.h"
 
 namespace smaug {
 
+namespace internal {
+
+/**
+ * The side of the square blocks that the layout transposes work in. A 32x32
+ * block of fp32 source and destination data (8KB) fits in the L1 cache, so the
+ * strided writes to the destination hit the cache lines that were just brought
+ * in instead of missing on every element.
+ */
+constexpr int kTransposeBlockSize = 32;
+
+/**
+ * Transposes a rows x cols block of src into dst: element (r, c) of src, at
+ * src[r * srcStride + c], goes to dst[c * dstStride + r].
+ */
+template <typename DType>
+void transposeTile(const DType* src,
+                   int srcStride,
+                   DType* dst,
+                   int dstStride,
+                   int rows,
+                   int cols) {
+    for (int r = 0; r < rows; r++) {
+        for (int c = 0; c < cols; c++)
+            dst[c * dstStride + r] = src[r * srcStride + c];
+    }
+}
+
+#ifdef __SSE__
+/**
+ * Transposes fp32 data in 4x4 blocks held in SSE registers, so that every load
+ * and store moves four contiguous elements.
+ */
+template <>
+inline void transposeTile<float>(const float* src,
+                                 int srcStride,
+                                 float* dst,
+                                 int dstStride,
+                                 int rows,
+                                 int cols) {
+    int r = 0;
+    for (; r + 4 <= rows; r += 4) {
+        const float* srcRows = &src[r * srcStride];
+        int c = 0;
+        for (; c + 4 <= cols; c += 4) {
+            __m128 row0 = _mm_loadu_ps(&srcRows[c]);
+            __m128 row1 = _mm_loadu_ps(&srcRows[srcStride + c]);
+            __m128 row2 = _mm_loadu_ps(&srcRows[2 * srcStride + c]);
+            __m128 row3 = _mm_loadu_ps(&srcRows[3 * srcStride + c]);
+            _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+            float* dstRows = &dst[c * dstStride + r];
+            _mm_storeu_ps(&dstRows[0], row0);
+            _mm_storeu_ps(&dstRows[dstStride], row1);
+            _mm_storeu_ps(&dstRows[2 * dstStride], row2);
+            _mm_storeu_ps(&dstRows[3 * dstStride], row3);
+        }
+        for (; c < cols; c++) {
+            for (int i = 0; i < 4; i++)
+                dst[c * dstStride + r + i] = srcRows[i * srcStride + c];
+        }
+    }
+    for (; r < rows; r++) {
+        for (int c = 0; c < cols; c++)
+            dst[c * dstStride + r] = src[r * srcStride + c];
+    }
+}
+#endif
+
+/**
+ * Transposes a rows x cols matrix one cache block at a time. The strides are
+ * the distances in elements between consecutive rows of src and dst, so they
+ * account for any alignment padding. Padding elements of dst are not written.
+ */
+template <typename DType>
+void transposeMatrix(const DType* src,
+                     int srcStride,
+                     DType* dst,
+                     int dstStride,
+                     int rows,
+                     int cols) {
+    for (int r = 0; r < rows; r += kTransposeBlockSize) {
+        int blockRows = std::min(kTransposeBlockSize, rows - r);
+        for (int c = 0; c < cols; c += kTransposeBlockSize) {
+            int blockCols = std::min(kTransposeBlockSize, cols - c);
+            transposeTile<DType>(&src[r * srcStride + c], srcStride,
+                                 &dst[c * dstStride + r], dstStride, blockRows,
+                                 blockCols);
+        }
+    }
+}
+
+/** Returns the number of kTransposeBlockSize blocks needed to cover size. */
+inline int numTransposeBlocks(int size) {
+    return (size + kTransposeBlockSize - 1) / kTransposeBlockSize;
+}
+
+/**
+ * Runs task(0) through task(numTasks - 1), splitting them into contiguous
+ * ranges over the thread pool and the calling thread. The tasks must write
+ * disjoint data. Without a thread pool, or if the whole transpose is too small
+ * to be worth dispatching, all the tasks run on the calling thread.
+ *
+ * @param numTasks The number of tasks.
+ * @param elemsPerTask The number of elements each task moves.
+ * @param task Called with the index of each task.
+ */
+void parallelTranspose(int numTasks,
+                       int64_t elemsPerTask,
+                       const std::function<void(int)>& task);
+
+}  // namespace internal
+
+/**
+ * Each (n, h) slice of an NCHW tensor is a C x W matrix whose rows are H
+ * padded rows apart, and its transpose is the (n, h) slice of the NHWC tensor.
+ * The slices are transposed in blocks of channels, with the (n, h, channel
+ * block) tasks spread over the thread pool.
+ */
 template <typename DType>
 void convertNchwToNhwcImpl(Tensor* input, Tensor* output) {
-    TensorIndexIterator inputIdx = input->startIndex();
-    TensorIndexIterator outputIdx = output->startIndex();
     const TensorShape& inputShape = input->getShape();
-    DType* inputData = input->template data<DType>();
+    int batches = inputShape[0];
+    int chans = inputShape[1];
+    int rows = inputShape[2];
+    int cols = inputShape[3];
+    int inputRowSize = inputShape.getStorageDim(3);
+    int outputRowSize = output->getShape().getStorageDim(3);
+    const DType* inputData = input->template data<DType>();
     DType* outputData = output->template data<DType>();
-    for (int n = 0; n < inputShape[0]; n++) {
-        for (int c = 0; c < inputShape[1]; c++) {
-            for (int h = 0; h < inputShape[2]; h++) {
-                for (int w = 0; w < inputShape[3]; w++) {
-                    outputData[outputIdx(n, h, w, c)] =
-                            inputData[inputIdx(n, c, h, w)];
-                }
-            }
-        }
-    }
+    int numChanBlocks = internal::numTransposeBlocks(chans);
+    internal::parallelTranspose(
+            batches * rows * numChanBlocks,
+            (int64_t)cols * internal::kTransposeBlockSize, [&](int task) {
+                int c = (task % numChanBlocks) * internal::kTransposeBlockSize;
+                int h = (task / numChanBlocks) % rows;
+                int n = task / numChanBlocks / rows;
+                int blockChans =
+                        std::min(internal::kTransposeBlockSize, chans - c);
+                internal::transposeMatrix<DType>(
+                        &inputData[((n * chans + c) * rows + h) * inputRowSize],
+                        rows * inputRowSize,
+                        &outputData[(n * rows + h) * cols * outputRowSize + c],
+                        outputRowSize, blockChans, cols);
+            });
 }
 
+/** The inverse of convertNchwToNhwcImpl(). */
 template <typename DType>
 void convertNhwcToNchwImpl(Tensor* input, Tensor* output) {
-    TensorIndexIterator inputIdx = input->startIndex();
-    TensorIndexIterator outputIdx = output->startIndex();
     const TensorShape& inputShape = input->getShape();
-    DType* inputData = input->template data<DType>();
+    int batches = inputShape[0];
+    int rows = inputShape[1];
+    int cols = inputShape[2];
+    int chans = inputShape[3];
+    int inputRowSize = inputShape.getStorageDim(3);
+    int outputRowSize = output->getShape().getStorageDim(3);
+    const DType* inputData = input->template data<DType>();
     DType* outputData = output->template data<DType>();
-    for (int n = 0; n < inputShape[0]; n++) {
-        for (int h = 0; h < inputShape[1]; h++) {
-            for (int w = 0; w < inputShape[2]; w++) {
-                for (int c = 0; c < inputShape[3]; c++) {
-                    outputData[outputIdx(n, c, h, w)] =
-                            inputData[inputIdx(n, h, w, c)];
-                }
-            }
-        }
-    }
+    int numChanBlocks = internal::numTransposeBlocks(chans);
+    internal::parallelTranspose(
+            batches * rows * numChanBlocks,
+            (int64_t)cols * internal::kTransposeBlockSize, [&](int task) {
+                int c = (task % numChanBlocks) * internal::kTransposeBlockSize;
+                int h = (task / numChanBlocks) % rows;
+                int n = task / numChanBlocks / rows;
+                int blockChans =
+                        std::min(internal::kTransposeBlockSize, chans - c);
+                internal::transposeMatrix<DType>(
+                        &inputData[(n * rows + h) * cols * inputRowSize + c],
+                        inputRowSize,
+                        &outputData[((n * chans + c) * rows + h) *
+                                    outputRowSize],
+                        rows * outputRowSize, cols, blockChans);
+            });
 }
 
 template <typename DType>
@@ -71,34 +219,56 @@ void flattenImpl(Tensor* input, Tensor* output) {
     }
 }
 
+/**
+ * Transposes the last two dimensions, one block of rows of each matrix per
+ * task.
+ */
 template <typename DType>
 void transpose3DImpl(Tensor* input, Tensor* output) {
-    TensorIndexIterator inputIdx = input->startIndex();
-    TensorIndexIterator outputIdx = output->startIndex();
     const TensorShape& inputShape = input->getShape();
-    auto inputData = input->template data<DType>();
-    auto outputData = output->template data<DType>();
-    for (int i = 0; i < inputShape[0]; i++) {
-        for (int j = 0; j < inputShape[1]; j++) {
-            for (int k = 0; k < inputShape[2]; k++) {
-                outputData[outputIdx(i, k, j)] = inputData[inputIdx(i, j, k)];
-            }
-        }
-    }
+    int batches = inputShape[0];
+    int rows = inputShape[1];
+    int cols = inputShape[2];
+    int inputRowSize = inputShape.getStorageDim(2);
+    int outputRowSize = output->getShape().getStorageDim(2);
+    const DType* inputData = input->template data<DType>();
+    DType* outputData = output->template data<DType>();
+    int numRowBlocks = internal::numTransposeBlocks(rows);
+    internal::parallelTranspose(
+            batches * numRowBlocks,
+            (int64_t)cols * internal::kTransposeBlockSize, [&](int task) {
+                int r = (task % numRowBlocks) * internal::kTransposeBlockSize;
+                int n = task / numRowBlocks;
+                int blockRows =
+                        std::min(internal::kTransposeBlockSize, rows - r);
+                internal::transposeMatrix<DType>(
+                        &inputData[(n * rows + r) * inputRowSize],
+                        inputRowSize,
+                        &outputData[n * cols * outputRowSize + r],
+                        outputRowSize, blockRows, cols);
+            });
 }
 
+/** Transposes a matrix, one block of rows per task. */
 template <typename DType>
 void transpose2DImpl(Tensor* input, Tensor* output) {
-    TensorIndexIterator inputIdx = input->startIndex();
-    TensorIndexIterator outputIdx = output->startIndex();
     const TensorShape& inputShape = input->getShape();
-    auto inputData = input->template data<DType>();
-    auto outputData = output->template data<DType>();
-    for (int n = 0; n < inputShape[0]; n++) {
-        for (int c = 0; c < inputShape[1]; c++) {
-            outputData[outputIdx(c, n)] = inputData[inputIdx(n, c)];
-        }
-    }
+    int rows = inputShape[0];
+    int cols = inputShape[1];
+    int inputRowSize = inputShape.getStorageDim(1);
+    int outputRowSize = output->getShape().getStorageDim(1);
+    const DType* inputData = input->template data<DType>();
+    DType* outputData = output->template data<DType>();
+    internal::parallelTranspose(
+            internal::numTransposeBlocks(rows),
+            (int64_t)cols * internal::kTransposeBlockSize, [&](int task) {
+                int r = task * internal::kTransposeBlockSize;
+                int blockRows =
+                        std::min(internal::kTransposeBlockSize, rows - r);
+                internal::transposeMatrix<DType>(
+                        &inputData[r * inputRowSize], inputRowSize,
+                        &outputData[r], outputRowSize, blockRows, cols);
+            });
 }
 
 void convertNchwToNhwc(Tensor* input, Tensor* output);
@@ -112,3 +282,5 @@ void transpose3D(Tensor* input, Tensor* output);
 void transpose2D(Tensor* input, Tensor* output);
 
 }  // namespace smaug
+
+#endif
@@ -1,8 +1,10 @@
 #include "catch.hpp"
 #include "smaug/core/backend.h"
+#include "smaug/core/globals.h"
 #include "smaug/core/tensor.h"
 #include "smaug/core/smaug_test.h"
 #include "smaug/operators/reorder_op.h"
+#include "smaug/utility/thread_pool.h"
 
 using namespace smaug;
 
@@ -93,3 +95,98 @@ TEST_CASE_METHOD(SmaugTest, "Reorder from NHWC", "[refop]") {
         verifyOutputs(outputsTensor, inputValues);
     }
 }
+
+namespace {
+
+// Fills the tensor with distinct values, so that any misplaced element shows.
+template <typename DType>
+void fillWithIndices(Tensor* tensor) {
+    DType* data = tensor->allocateStorage<DType>();
+    for (int i = 0; i < tensor->getShape().storageSize(); i++)
+        data[i] = i % 2039;
+}
+
+template <typename DType>
+void verifyLayoutTransposes() {
+    // Large enough to be split over the thread pool, and none of the
+    // dimensions is a multiple of the transpose block size or the alignment.
+    TensorShape nchwShape({ 2, 70, 9, 75 }, DataLayout::NCHW, 8);
+    TensorShape nhwcShape({ 2, 9, 75, 70 }, DataLayout::NHWC, 8);
+    Tensor nchw("nchw", nchwShape);
+    Tensor nhwc("nhwc", nhwcShape);
+    Tensor result("result", nchwShape);
+    fillWithIndices<DType>(&nchw);
+    nhwc.allocateStorage<DType>();
+    result.allocateStorage<DType>();
+    convertNchwToNhwc(&nchw, &nhwc);
+    convertNhwcToNchw(&nhwc, &result);
+    auto nchwIdx = nchw.startIndex();
+    auto nhwcIdx = nhwc.startIndex();
+    const DType* nchwData = nchw.data<DType>();
+    const DType* nhwcData = nhwc.data<DType>();
+    const DType* resultData = result.data<DType>();
+    for (int n = 0; n < 2; n++) {
+        for (int c = 0; c < 70; c++) {
+            for (int h = 0; h < 9; h++) {
+                for (int w = 0; w < 75; w++) {
+                    REQUIRE(nhwcData[nhwcIdx(n, h, w, c)] ==
+                            nchwData[nchwIdx(n, c, h, w)]);
+                    REQUIRE(resultData[nchwIdx(n, c, h, w)] ==
+                            nchwData[nchwIdx(n, c, h, w)]);
+                }
+            }
+        }
+    }
+
+    TensorShape shape3D({ 3, 101, 257 }, DataLayout::NTC, 8);
+    TensorShape transposedShape3D({ 3, 257, 101 }, DataLayout::NTC, 8);
+    Tensor input3D("input3D", shape3D);
+    Tensor output3D("output3D", transposedShape3D);
+    fillWithIndices<DType>(&input3D);
+    output3D.allocateStorage<DType>();
+    transpose3D(&input3D, &output3D);
+    auto inputIdx3D = input3D.startIndex();
+    auto outputIdx3D = output3D.startIndex();
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 101; j++) {
+            for (int k = 0; k < 257; k++) {
+                REQUIRE(output3D.data<DType>()[outputIdx3D(i, k, j)] ==
+                        input3D.data<DType>()[inputIdx3D(i, j, k)]);
+            }
+        }
+    }
+
+    TensorShape shape2D({ 300, 301 }, DataLayout::NC, 8);
+    TensorShape transposedShape2D({ 301, 300 }, DataLayout::CN, 8);
+    Tensor input2D("input2D", shape2D);
+    Tensor output2D("output2D", transposedShape2D);
+    fillWithIndices<DType>(&input2D);
+    output2D.allocateStorage<DType>();
+    transpose2D(&input2D, &output2D);
+    auto inputIdx2D = input2D.startIndex();
+    auto outputIdx2D = output2D.startIndex();
+    for (int i = 0; i < 300; i++) {
+        for (int j = 0; j < 301; j++) {
+            REQUIRE(output2D.data<DType>()[outputIdx2D(j, i)] ==
+                    input2D.data<DType>()[inputIdx2D(i, j)]);
+        }
+    }
+}
+
+}  // namespace
+
+TEST_CASE_METHOD(SmaugTest, "Blocked layout transposes", "[refop]") {
+    SECTION("On the calling thread") {
+        verifyLayoutTransposes<float>();
+        verifyLayoutTransposes<float16>();
+    }
+
+    SECTION("On the thread pool") {
+        threadPool = new ThreadPool(3);
+        threadPool->initThreadPool();
+        verifyLayoutTransposes<float>();
+        verifyLayoutTransposes<float16>();
+        delete threadPool;
+        threadPool = nullptr;
+    }
+}
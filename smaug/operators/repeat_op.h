@@ -75,7 +75,8 @@ class RepeatOp : public Operator {
         std::vector<int> outputDims = output->getShape().dims();
         std::vector<int> srcOrigin = std::vector<int>(ndims, 0);
         // Copy the first piece of input into output.
-        copyTensorRegion(output, input, srcOrigin, srcOrigin, inputDims);
+        copyTensorRegion(output, input, srcOrigin, srcOrigin, inputDims,
+                         /* useThreadPool */ true);
         for (int i = ndims - 1; i >= 0; i--) {
             std::vector<int> currCopyRegion = inputDims;
             for (int j = i + 1; j < ndims; j++)
@@ -83,8 +84,8 @@ class RepeatOp : public Operator {
             std::vector<int> dstOrigin(ndims, 0);
             dstOrigin[i] = inputDims[i];
             while (dstOrigin[i] + currCopyRegion[i] <= outputDims[i]) {
-                copyTensorRegion(
-                        output, output, dstOrigin, srcOrigin, currCopyRegion);
+                copyTensorRegion(output, output, dstOrigin, srcOrigin,
+                                 currCopyRegion, /* useThreadPool */ true);
                 dstOrigin[i] += currCopyRegion[i];
                 // Double the copy size for the next iteration.
                 currCopyRegion[i] *= 2;
@@ -92,8 +93,8 @@ class RepeatOp : public Operator {
             // Copy the remaining part if there's any.
             if (dstOrigin[i] < outputDims[i]) {
                 currCopyRegion[i] = outputDims[i] - dstOrigin[i];
-                copyTensorRegion(
-                        output, output, dstOrigin, srcOrigin, currCopyRegion);
+                copyTensorRegion(output, output, dstOrigin, srcOrigin,
+                                 currCopyRegion, /* useThreadPool */ true);
             }
         }
     }
@@ -21,6 +21,7 @@ class SigmoidOp : public UnaryOp<Backend> {
             : UnaryOp<Backend>(name, OpType::Sigmoid, workspace) {}
 
     void run() override {}
+    bool supportsInPlace() const override { return true; }
 };
 
 REGISTER_SPECIAL_OP(SigmoidOp, ReferenceBackend);
@@ -0,0 +1,59 @@
+/**
+ * \file kernel_dispatch.c
+ * \brief Picks the best ISA variant of every SMV kernel at startup.
+ *
+ * This is only part of the native-fast build (see make/Makefile.native). There,
+ * every SMV kernel translation unit is compiled once per ISA level, with the
+ * level appended to the names of its functions, and kernel_dispatch_list.h is
+ * generated with one SMV_KERNEL_DISPATCH() for every kernel function. Each
+ * kernel function is then an ifunc, which the dynamic loader resolves once,
+ * when the binary starts, to the variant for the best level the CPU supports.
+ * Callers keep calling the kernels by their usual names.
+ */
+
+#include "smaug/operators/smv/kernels/kernel_dispatch.h"
+
+typedef enum { KERNEL_ISA_SSE, KERNEL_ISA_AVX2, KERNEL_ISA_AVX512 } kernel_isa;
+
+static const char* kernel_isa_names[] = { "sse", "avx2", "avx512" };
+
+/**
+ * Returns the best ISA level the CPU supports, from cpuid. The flags checked
+ * for every level must cover the flags its variants are compiled with.
+ */
+static kernel_isa select_kernel_isa(void) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") &&
+        __builtin_cpu_supports("avx512vl") &&
+        __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq"))
+        return KERNEL_ISA_AVX512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+        __builtin_cpu_supports("f16c"))
+        return KERNEL_ISA_AVX2;
+    return KERNEL_ISA_SSE;
+}
+
+// The function type does not matter to an ifunc, so every kernel is declared
+// as void(void) here, and this file must not see the real prototypes.
+#define SMV_KERNEL_DISPATCH(name)                                              \
+    void name##_sse(void);                                                     \
+    void name##_avx2(void);                                                    \
+    void name##_avx512(void);                                                  \
+    static void (*resolve_##name(void))(void) {                                \
+        switch (select_kernel_isa()) {                                         \
+            case KERNEL_ISA_AVX512:                                            \
+                return name##_avx512;                                          \
+            case KERNEL_ISA_AVX2:                                              \
+                return name##_avx2;                                            \
+            default:                                                           \
+                return name##_sse;                                             \
+        }                                                                      \
+    }                                                                          \
+    void name(void) __attribute__((ifunc("resolve_" #name)));
+
+#include "kernel_dispatch_list.h"
+
+const char* smv_kernel_isa(void) {
+    return kernel_isa_names[select_kernel_isa()];
+}
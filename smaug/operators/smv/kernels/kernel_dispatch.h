@@ -0,0 +1,24 @@
+/**
+ * \file kernel_dispatch.h
+ * \brief Runtime ISA dispatch of the SMV kernels in the native-fast build.
+ */
+
+#ifndef _OPERATORS_SMV_KERNELS_KERNEL_DISPATCH_H_
+#define _OPERATORS_SMV_KERNELS_KERNEL_DISPATCH_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns the ISA level ("sse", "avx2" or "avx512") of the SMV kernel variants
+ * picked at startup. This only exists in the native-fast build, so the symbol
+ * is weak: check it for null first.
+ */
+const char* smv_kernel_isa(void) __attribute__((weak));
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif
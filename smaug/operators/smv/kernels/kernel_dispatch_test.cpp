@@ -0,0 +1,195 @@
+#include <random>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+#include "smaug/core/smaug_test.h"
+#include "smaug/operators/smv/smv_kernels.h"
+#include "smaug/operators/smv/kernels/kernel_dispatch.h"
+#include "smaug/utility/utils.h"
+
+// This test is only built with the native-fast kernels (see
+// make/Makefile.native), where every kernel also exists as <name>_<isa>.
+
+#define DECLARE_ISA_VARIANTS(name)                                             \
+    extern "C" decltype(name) name##_sse, name##_avx2, name##_avx512;
+
+DECLARE_ISA_VARIANTS(smv_eltwise_add_nc_vec_fxp)
+DECLARE_ISA_VARIANTS(smv_activation_fun_nc_vec_fxp)
+DECLARE_ISA_VARIANTS(smv_matrix_multiply_transpose_nc_vec_fxp)
+
+using namespace smaug;
+
+namespace {
+
+/** Returns the ISA levels the CPU can run, as named by smv_kernel_isa(). */
+std::vector<std::string> supportedIsas() {
+    std::vector<std::string> isas = { "sse" };
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+        __builtin_cpu_supports("f16c")) {
+        isas.push_back("avx2");
+        if (__builtin_cpu_supports("avx512f") &&
+            __builtin_cpu_supports("avx512vl") &&
+            __builtin_cpu_supports("avx512bw") &&
+            __builtin_cpu_supports("avx512dq"))
+            isas.push_back("avx512");
+    }
+    return isas;
+}
+
+/** Returns the variant of a kernel for the given ISA level. */
+template <typename Kernel>
+Kernel* pickVariant(const std::string& isa,
+                    Kernel* sse,
+                    Kernel* avx2,
+                    Kernel* avx512) {
+    if (isa == "avx512")
+        return avx512;
+    if (isa == "avx2")
+        return avx2;
+    return sse;
+}
+
+/** A scratchpad, aligned for the widest vector loads of the kernels. */
+class Spad {
+   public:
+    Spad(int size)
+            : data_(reinterpret_cast<float*>(
+                      malloc_aligned(size * sizeof(float), true))) {}
+    ~Spad() { free(data_); }
+    float* data() { return data_; }
+
+   protected:
+    float* data_;
+};
+
+std::vector<float16> randomFp16Data(int size) {
+    static std::default_random_engine generator;
+    std::uniform_real_distribution<float> distribution(-1, 1);
+    std::vector<float16> data(size);
+    for (int i = 0; i < size; i++)
+        data[i] = fp16(distribution(generator));
+    return data;
+}
+
+/**
+ * Checks that the results of every ISA variant are close to the SSE variant's,
+ * which is what gem5 runs, and that the dispatched kernel is exactly the
+ * variant smv_kernel_isa() names. The variants may differ in the last bits
+ * since the wider ones contract multiplies and adds into FMAs.
+ */
+void verifyIsaResults(const std::vector<std::string>& isas,
+                      const std::vector<std::vector<float16>>& results,
+                      const std::vector<float16>& dispatchedResults) {
+    for (int i = 1; i < isas.size(); i++) {
+        INFO("ISA level " << isas[i]);
+        for (int j = 0; j < results[0].size(); j++) {
+            REQUIRE(fp32(results[i][j]) == Approx(fp32(results[0][j]))
+                                                   .epsilon(kEpsilon)
+                                                   .margin(kMargin));
+        }
+    }
+    std::string dispatchedIsa = smv_kernel_isa();
+    int dispatched = -1;
+    for (int i = 0; i < isas.size(); i++) {
+        if (isas[i] == dispatchedIsa)
+            dispatched = i;
+    }
+    REQUIRE(dispatched != -1);
+    bool sameAsVariant = dispatchedResults == results[dispatched];
+    REQUIRE(sameAsVariant);
+}
+
+}  // namespace
+
+TEST_CASE_METHOD(SmaugTest, "SMV kernel ISA variants", "[smvdispatch]") {
+    REQUIRE(smv_kernel_isa != nullptr);
+    std::vector<std::string> isas = supportedIsas();
+    // The dispatcher picks the best level the CPU supports.
+    REQUIRE(std::string(smv_kernel_isa()) == isas.back());
+
+    SECTION("Elementwise addition") {
+        const int size = 1024;
+        std::vector<float16> inputs0 = randomFp16Data(size);
+        std::vector<float16> inputs1 = randomFp16Data(size);
+        Spad spad0(size), spad1(size), spad2(size);
+        auto run = [&](decltype(smv_eltwise_add_nc_vec_fxp)* kernel) {
+            std::vector<float16> results(size);
+            kernel(inputs0.data(), inputs1.data(), results.data(),
+                   spad0.data(), spad1.data(), spad2.data(), size);
+            return results;
+        };
+        std::vector<std::vector<float16>> results;
+        for (auto& isa : isas) {
+            results.push_back(run(pickVariant(isa,
+                                              smv_eltwise_add_nc_vec_fxp_sse,
+                                              smv_eltwise_add_nc_vec_fxp_avx2,
+                                              smv_eltwise_add_nc_vec_fxp_avx512)));
+        }
+        verifyIsaResults(isas, results, run(smv_eltwise_add_nc_vec_fxp));
+    }
+
+    SECTION("Activation functions") {
+        const int size = 1024;
+        std::vector<float16> inputs = randomFp16Data(size);
+        Spad spad0(size), spad1(size);
+        activation_param_t params;
+        params.slope = 0.1;
+        params.alpha = 0.1;
+        params.lambda = 1.0507;
+        params.min = -0.5;
+        params.max = 0.5;
+        // The kernel's activation types, some of which share their names
+        // with OpTypes.
+        for (activation_type function : { ::RELU, ::LRELU, ::ELU, ::SELU,
+                                          ::TANH, ::HARD_TANH, ::SIGMOID }) {
+            INFO("Activation function " << function);
+            auto run = [&](decltype(smv_activation_fun_nc_vec_fxp)* kernel) {
+                std::vector<float16> results(size);
+                kernel(inputs.data(), results.data(), spad0.data(),
+                       spad1.data(), size, function, params);
+                return results;
+            };
+            std::vector<std::vector<float16>> results;
+            for (auto& isa : isas) {
+                results.push_back(
+                        run(pickVariant(isa,
+                                        smv_activation_fun_nc_vec_fxp_sse,
+                                        smv_activation_fun_nc_vec_fxp_avx2,
+                                        smv_activation_fun_nc_vec_fxp_avx512)));
+            }
+            verifyIsaResults(isas, results, run(smv_activation_fun_nc_vec_fxp));
+        }
+    }
+
+    SECTION("Matrix multiplication") {
+        int aDims[2] = { 1, 256 };
+        int bDims[2] = { 32, 256 };
+        int resultsDims[2] = { 1, 32 };
+        std::vector<float16> a = randomFp16Data(aDims[0] * aDims[1]);
+        std::vector<float16> b = randomFp16Data(bDims[0] * bDims[1]);
+        Spad spad0(aDims[0] * aDims[1]), spad1(bDims[0] * bDims[1]),
+                spad2(resultsDims[0] * resultsDims[1]);
+        activation_param_t params;
+        SamplingInfo sampling = { NoSampling, 1 };
+        auto run = [&](decltype(smv_matrix_multiply_transpose_nc_vec_fxp)*
+                               kernel) {
+            std::vector<float16> results(resultsDims[0] * resultsDims[1]);
+            kernel(a.data(), b.data(), results.data(), spad0.data(),
+                   spad1.data(), spad2.data(), aDims, bDims, resultsDims, 0, 0,
+                   0, 0, 0, false, true, true, NO_ACTIVATION, params,
+                   &sampling);
+            return results;
+        };
+        std::vector<std::vector<float16>> results;
+        for (auto& isa : isas) {
+            results.push_back(run(pickVariant(
+                    isa, smv_matrix_multiply_transpose_nc_vec_fxp_sse,
+                    smv_matrix_multiply_transpose_nc_vec_fxp_avx2,
+                    smv_matrix_multiply_transpose_nc_vec_fxp_avx512)));
+        }
+        verifyIsaResults(
+                isas, results, run(smv_matrix_multiply_transpose_nc_vec_fxp));
+    }
+}
@@ -0,0 +1,219 @@
+#include <cstdlib>
+#include <string>
+
+#include "fp16.h"
+#include "smaug/core/backend.h"
+#include "smaug/core/globals.h"
+#include "smaug/core/smaug_bench.h"
+#include "smaug/operators/smv/smv_kernels.h"
+#include "smaug/operators/smv/kernels/load_store_fp16_data.h"
+#include "smaug/utility/utils.h"
+
+using namespace smaug;
+
+namespace {
+
+/**
+ * An aligned host buffer of float16 data, filled with small values so that
+ * the kernels never see denormals or infinities.
+ */
+class HostBuffer {
+   public:
+    HostBuffer(int _size) : size(_size) {
+        data = (float16*)malloc_aligned(size * sizeof(float16));
+        for (int i = 0; i < size; i++)
+            data[i] = fp16_ieee_from_fp32_value(((i % 17) - 8) * 0.0625f);
+    }
+    ~HostBuffer() { free(data); }
+    int64_t bytes() const { return (int64_t)size * sizeof(float16); }
+
+    float16* data;
+    int size;
+};
+
+std::string shapeName(const std::string& kernel, std::vector<int> dims) {
+    std::string name = kernel + " [";
+    for (int i = 0; i < dims.size(); i++)
+        name += (i ? "x" : "") + std::to_string(dims[i]);
+    return name + "]";
+}
+
+SamplingInfo kNoSampling = { NoSampling, 1 };
+
+// Every shape in these grids fits within a single tile, i.e. each of the
+// inputs, weights and results is at most SmvBackend::SpadSize() bytes of
+// float16 data.
+
+void benchConvolution(SmaugBenchmark& bench) {
+    // { rows, cols, input channels, output channels, kernel size }.
+    const std::vector<std::vector<int>> shapes = {
+        { 32, 32, 8, 8, 3 },  { 16, 16, 32, 8, 3 }, { 8, 8, 64, 16, 3 },
+        { 4, 4, 128, 8, 3 },  { 16, 16, 64, 8, 1 }, { 8, 8, 32, 32, 1 },
+    };
+    bench.printHeader("smv_conv3d_nhwc_vec_fxp (same padding, stride 1)");
+    for (auto& shape : shapes) {
+        int rows = shape[0], cols = shape[1], chans = shape[2];
+        int ofmaps = shape[3], k = shape[4];
+        int halo = k / 2;
+        int inputsDims[4] = { 1, rows, cols, chans };
+        int weightsDims[4] = { ofmaps, k, k, chans };
+        int resultsDims[4] = { 1, rows, cols, ofmaps };
+        int inputsHaloPad[4] = { halo, halo, halo, halo };
+        HostBuffer inputs(rows * cols * chans);
+        HostBuffer weights(ofmaps * k * k * chans);
+        HostBuffer results(rows * cols * ofmaps);
+        int64_t flops = 2ll * rows * cols * ofmaps * k * k * chans;
+        int64_t bytes = inputs.bytes() + weights.bytes() + results.bytes();
+        bench.run(shapeName("conv", shape), flops, bytes, [&]() {
+            smv_conv3d_nhwc_vec_fxp(
+                    inputs.data, weights.data, results.data, smv::spad0,
+                    smv::spad1, smv::spad2, inputsDims, weightsDims,
+                    resultsDims, 0, 0, 0, inputsHaloPad, 1, 1, 0, 0, false,
+                    true, true, true, NO_ACTIVATION, activation_param_t(),
+                    &kNoSampling);
+        });
+    }
+}
+
+void benchMatrixMultiply(SmaugBenchmark& bench) {
+    // { batch, input activations, output neurons }.
+    const std::vector<std::vector<int>> shapes = {
+        { 1, 1024, 8 }, { 1, 256, 64 }, { 4, 512, 16 },
+        { 8, 256, 32 }, { 16, 128, 64 },
+    };
+    bench.printHeader("smv_matrix_multiply_transpose_nc_vec_fxp");
+    for (auto& shape : shapes) {
+        int batch = shape[0], acts = shape[1], neurons = shape[2];
+        int aDims[2] = { batch, acts };
+        int bDims[2] = { neurons, acts };
+        int resultsDims[2] = { batch, neurons };
+        HostBuffer a(batch * acts);
+        HostBuffer b(neurons * acts);
+        HostBuffer results(batch * neurons);
+        int64_t flops = 2ll * batch * acts * neurons;
+        int64_t bytes = a.bytes() + b.bytes() + results.bytes();
+        bench.run(shapeName("matmul", shape), flops, bytes, [&]() {
+            smv_matrix_multiply_transpose_nc_vec_fxp(
+                    a.data, b.data, results.data, smv::spad0, smv::spad1,
+                    smv::spad2, aDims, bDims, resultsDims, 0, 0, 0, 0, 0,
+                    false, true, true, NO_ACTIVATION, activation_param_t(),
+                    &kNoSampling);
+        });
+    }
+}
+
+void benchPooling(SmaugBenchmark& bench) {
+    // { rows, cols, channels, pool size (= stride) }.
+    const std::vector<std::vector<int>> shapes = {
+        { 32, 32, 16, 2 }, { 16, 16, 64, 2 }, { 8, 8, 256, 2 },
+        { 24, 24, 16, 3 },
+    };
+    bench.printHeader("smv_{max,avg}pooling_nhwc_vec_fxp");
+    for (int isMax = 1; isMax >= 0; isMax--) {
+        for (auto& shape : shapes) {
+            int rows = shape[0], cols = shape[1], chans = shape[2];
+            int pool = shape[3];
+            int outRows = (rows - pool) / pool + 1;
+            int outCols = (cols - pool) / pool + 1;
+            int inputsDims[4] = { 1, rows, cols, chans };
+            int resultsDims[4] = { 1, outRows, outCols, chans };
+            HostBuffer inputs(rows * cols * chans);
+            HostBuffer results(outRows * outCols * chans);
+            int64_t flops = (int64_t)outRows * outCols * chans * pool * pool;
+            int64_t bytes = inputs.bytes() + results.bytes();
+            auto kernel = isMax ? smv_maxpooling_nhwc_vec_fxp
+                                : smv_avgpooling_nhwc_vec_fxp;
+            bench.run(shapeName(isMax ? "maxpool" : "avgpool", shape), flops,
+                      bytes, [&]() {
+                          kernel(inputs.data, results.data, smv::spad0,
+                                 smv::spad1, inputsDims, resultsDims, 0, 0,
+                                 pool, pool, pool, pool, 0, &kNoSampling);
+                      });
+        }
+    }
+}
+
+void benchBatchNorm(SmaugBenchmark& bench) {
+    // { rows, cols, channels }.
+    const std::vector<std::vector<int>> shapes = {
+        { 32, 32, 16 }, { 16, 16, 64 }, { 8, 8, 256 }, { 4, 4, 1024 },
+    };
+    bench.printHeader("smv_batch_norm_post_conv_nhwc_vec_fxp");
+    for (auto& shape : shapes) {
+        int rows = shape[0], cols = shape[1], chans = shape[2];
+        int inputsDims[4] = { 1, rows, cols, chans };
+        HostBuffer inputs(rows * cols * chans);
+        // Mean, variance, gamma and beta, each with one value per channel.
+        HostBuffer weights(4 * chans);
+        HostBuffer results(rows * cols * chans);
+        int64_t flops = 4ll * rows * cols * chans;
+        int64_t bytes = inputs.bytes() + weights.bytes() + results.bytes();
+        bench.run(shapeName("batchnorm", shape), flops, bytes, [&]() {
+            smv_batch_norm_post_conv_nhwc_vec_fxp(
+                    inputs.data, weights.data, results.data, smv::spad0,
+                    smv::spad1, smv::spad2, inputsDims, chans, 0, 0, 0,
+                    NO_ACTIVATION, activation_param_t(), &kNoSampling);
+        });
+    }
+}
+
+void benchActivation(SmaugBenchmark& bench) {
+    const std::vector<int> sizes = { 1024, 4096, 16384 };
+    const std::vector<std::pair<std::string, activation_type>> functions = {
+        { "relu", activation_type::RELU },
+        { "lrelu", activation_type::LRELU },
+        { "elu", activation_type::ELU },
+        { "sigmoid", activation_type::SIGMOID },
+        { "tanh", activation_type::TANH },
+    };
+    bench.printHeader("smv_activation_fun_nc_vec_fxp");
+    for (auto& function : functions) {
+        ActivationInfo actInfo(function.second);
+        for (int size : sizes) {
+            HostBuffer inputs(size);
+            HostBuffer results(size);
+            bench.run(shapeName(function.first, { size }), size,
+                      inputs.bytes() + results.bytes(), [&]() {
+                          smv_activation_fun_nc_vec_fxp(
+                                  inputs.data, results.data, smv::spad0,
+                                  smv::spad1, size, actInfo.function,
+                                  actInfo.params);
+                      });
+        }
+    }
+}
+
+void benchLoadStore(SmaugBenchmark& bench) {
+    const std::vector<int> sizes = { 256, 2048, 4800, 16384 };
+    bench.printHeader("host_load_fp16 / host_store_fp16");
+    for (int size : sizes) {
+        HostBuffer host(size);
+        // Each element is converted once and moves 2 bytes on the host side
+        // and 4 bytes on the scratchpad side.
+        int64_t bytes = 6ll * size;
+        bench.run(shapeName("host_load_fp16", { size }), size, bytes, [&]() {
+            host_load_fp16(smv::spad0, host.data, size, 0, 0);
+        });
+        bench.run(shapeName("host_store_fp16", { size }), size, bytes, [&]() {
+            host_store_fp16(smv::spad0, host.data, size, 0, 0);
+        });
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    SmaugBenchmark bench(argc, argv);
+    runningInSimulation = false;
+    SmvBackend::initGlobals();
+
+    benchConvolution(bench);
+    benchMatrixMultiply(bench);
+    benchPooling(bench);
+    benchBatchNorm(bench);
+    benchActivation(bench);
+    benchLoadStore(bench);
+
+    SmvBackend::freeGlobals();
+    return 0;
+}
@@ -1,13 +1,43 @@
 #include <string>
 
+#include "smaug/core/globals.h"
 #include "smaug/operators/common.h"
 #include "smaug/operators/smv/smv_accel_pool.h"
 #include "smaug/utility/debug_stream.h"
+#include "smaug/utility/task_thread.h"
 
 namespace smaug {
 
+namespace {
+
+/**
+ * The host threads that stand in for the accelerators in native runs, shared
+ * by all pools so that operators don't pay for creating threads on every run.
+ * They are created on first use.
+ */
+std::vector<std::unique_ptr<TaskThread>> accelThreads;
+
+TaskThread* getAcceleratorThread(int accelIdx) {
+    if (accelThreads.size() <= (size_t)accelIdx)
+        accelThreads.resize(accelIdx + 1);
+    std::unique_ptr<TaskThread>& accel = accelThreads[accelIdx];
+    if (!accel)
+        accel.reset(new TaskThread());
+    return accel.get();
+}
+
+}  // namespace
+
 SmvAcceleratorPool::SmvAcceleratorPool(int _size)
-        : size(_size), finishFlags(_size) {}
+        : size(_size), finishFlags(_size) {
+    // Trace generation must run the kernels in program order, and in
+    // simulation, the accelerators are modeled by gem5-Aladdin.
+#ifdef TRACE_MODE
+    runOnThreads = false;
+#else
+    runOnThreads = !runningInSimulation && useAcceleratorThreads && size > 1;
+#endif
+}
 
 void SmvAcceleratorPool::addFinishFlag(
         int accelIdx, std::unique_ptr<volatile int> finishFlag) {
@@ -16,7 +46,16 @@ void SmvAcceleratorPool::addFinishFlag(
     }
 }
 
+void SmvAcceleratorPool::dispatch(int accelIdx,
+                                  std::function<void()> task) {
+    getAcceleratorThread(accelIdx)->enqueue(std::move(task));
+}
+
 void SmvAcceleratorPool::join(int accelIdx) {
+    if (runOnThreads) {
+        getAcceleratorThread(accelIdx)->join();
+        return;
+    }
     if (finishFlags[accelIdx].empty())
         return;
 
@@ -42,7 +81,8 @@ int SmvAcceleratorPool::getNextAvailableAccelerator(int currAccelIdx) {
     if (pickedAccel == size)
         pickedAccel = 0;
     // If the picked accelerator has not finished, wait until it returns.
-    join(pickedAccel);
+    if (!runOnThreads)
+        join(pickedAccel);
     if (size > 1)
         dout(1) << "Switched to accelerator " << pickedAccel << ".\n";
     return pickedAccel;
@@ -3,8 +3,12 @@
 
 #include <vector>
 #include <deque>
+#include <functional>
 #include <memory>
 
+#include "smaug/core/backend.h"
+#include "smaug/operators/common.h"
+
 namespace smaug {
 
 /**
@@ -22,12 +26,24 @@ namespace smaug {
  * SmvAcceleratorPool pool(size);
  * int currAccel = 0;
  * for (int i = 0; i < tiles; i++) {
- *    volatile int* finishFlag = invokeKernelNoBlock(currAccel, redCode, kernel, args...);
- *    pool.addFinishFlag(currAccel, std::make_unique(finishFlag));
+ *    pool.invokeKernel(currAccel, reqCode,
+ *                      [=](float* spad0, float* spad1, float* spad2) {
+ *                          kernel(args..., spad0, spad1, spad2, ...);
+ *                      });
  *    currAccel = pool.getNextAvailableAccelerator(currAccel);
  * }
  * pool.joinAll();
  * ```
+ *
+ * Every accelerator has scratchpads of its own (see smv::accelSpads), and the
+ * kernel is given the scratchpads of the accelerator it is invoked on.
+ *
+ * In native runs with more than one accelerator (and useAcceleratorThreads),
+ * every accelerator is backed by a host thread, and invokeKernel() queues the
+ * kernel on that thread and returns immediately. Kernels on the same
+ * accelerator run in the order they were invoked, so an operator may keep data
+ * in an accelerator's scratchpads across invocations, just as it would on the
+ * hardware.
  */
 class SmvAcceleratorPool {
    public:
@@ -36,6 +52,38 @@ class SmvAcceleratorPool {
     /** Add a finish flag for the specified accelerator. */
     void addFinishFlag(int accelIdx, std::unique_ptr<volatile int> finishFlag);
 
+    /** Returns the scratchpads of the specified accelerator. */
+    const smv::Scratchpads& getScratchpads(int accelIdx) const {
+        return smv::accelSpads[accelIdx];
+    }
+
+    /**
+     * Invokes a kernel on the specified accelerator without blocking.
+     *
+     * @param accelIdx The accelerator in the pool.
+     * @param reqCode The ID of the accelerator to invoke in simulation.
+     * @param kernel A callable that takes the three scratchpads of the
+     * accelerator and calls the kernel function with them. It must capture
+     * all the other arguments by value, since it may run after this returns.
+     */
+    template <typename Kernel>
+    void invokeKernel(int accelIdx, unsigned reqCode, Kernel kernel) {
+        const smv::Scratchpads& spads = getScratchpads(accelIdx);
+        if (runOnThreads) {
+            float* spad0 = spads.spad0;
+            float* spad1 = spads.spad1;
+            float* spad2 = spads.spad2;
+            dispatch(accelIdx, [=]() mutable { kernel(spad0, spad1, spad2); });
+            return;
+        }
+        auto task = [&kernel](float* spad0, float* spad1, float* spad2) {
+            kernel(spad0, spad1, spad2);
+        };
+        addFinishFlag(accelIdx,
+                      invokeKernelNoBlock(accelIdx, reqCode, task, spads.spad0,
+                                          spads.spad1, spads.spad2));
+    }
+
     /** Wait until all the finish flags turn complete. */
     void joinAll();
 
@@ -47,6 +95,9 @@ class SmvAcceleratorPool {
      * runtime information may lead to mismatch between the traces and the
      * simulation.
      *
+     * When the accelerators run on host threads, this does not wait: the
+     * kernels queue up on the picked accelerator's thread instead.
+     *
      * TODO(xyzsam): the pool should be able to keep track of the current
      * accelerator index on its own.
      */
@@ -56,9 +107,15 @@ class SmvAcceleratorPool {
     /** Wait until this accelerator's finish flags turn complete. */
     void join(int accelIdx);
 
+    /** Queues a kernel on the host thread of the accelerator. */
+    void dispatch(int accelIdx, std::function<void()> task);
+
     /** Number of accelerators in the pool. */
     int size;
 
+    /** True if the accelerators are backed by host threads. */
+    bool runOnThreads;
+
     /** Active finish flags for all the accelerators in the pool. */
     std::vector<std::deque<std::unique_ptr<volatile int>>> finishFlags;
 };
@@ -34,6 +34,19 @@ void SmvBatchNormOp::runNA(TiledTensor& inputs,
             smv::kBatchNormHw, "host_weights", getWeightsMemType());
     setArrayMemTypeIfSimulating(
             smv::kBatchNormHw, "host_results", getOutputsMemType());
+    bool pipelineCopies = shouldPipelineTileCopies();
+    if (pipelineCopies) {
+        // Queue the tile copies in the order the loop nest below uses them.
+        // Tiles that are already queued are skipped.
+        for (int N = 0; N < inputNumTiles; N++) {
+            for (int C = 0; C < inputActTiles; C++) {
+                inputs.prefetchTile(inputIdx(N, C));
+                weights.prefetchTile(weightIdx(0, C));
+            }
+            for (int C = 0; C < weightActTiles; C++)
+                weights.prefetchTile(weightIdx(0, C));
+        }
+    }
     for (int N = 0; N < inputNumTiles; N++) {
         int iC = 0, wC = 0;
         // This keeps track of the activation offset of the inputs.
@@ -76,6 +89,8 @@ void SmvBatchNormOp::runNA(TiledTensor& inputs,
                          smv::spad2, inputDims, weightsShape[1],
                          inputShape.getPadding(1), actStart, sendOutputs,
                          actInfo.function, actInfo.params);
+            if (pipelineCopies && sendOutputs)
+                outputs.gatherTile(outputTileIdx);
 
             actOffset += weightsTile->getShape()[1];
             if (inputActTiles == weightActTiles) {
@@ -122,6 +137,11 @@ void SmvBatchNormOp::runNHWC(TiledTensor& inputs,
         setArrayMemTypeIfSimulating(
                 smv::kBatchNormHw + i, "host_results", getOutputsMemType());
     }
+    bool pipelineCopies = shouldPipelineTileCopies();
+    if (pipelineCopies) {
+        for (int i = 0; i < inputs.size(); i++)
+            inputs.prefetchTile(i);
+    }
     SmvAcceleratorPool accelPool(numAcceleratorsAvailable);
     int currAccelIdx = 0;
     for (int N = 0; N < inputNumTiles; N++) {
@@ -148,25 +168,39 @@ void SmvBatchNormOp::runNHWC(TiledTensor& inputs,
                     int inputDims[4] = { inputShape[0], inputShape[1],
                                          inputShape[2], inputShape[3] };
 
-                    std::unique_ptr<volatile int> finishFlag =
-                            invokeKernelNoBlock(
-                                    currAccelIdx,
-                                    smv::kBatchNormHw + currAccelIdx,
-                                    smv_batch_norm_post_conv_nhwc_vec_fxp,
-                                    inputTile->data<float16>(),
-                                    weightTile->data<float16>(),
-                                    outputTile->data<float16>(), smv::spad0,
-                                    smv::spad1, smv::spad2, inputDims,
-                                    weightShape[1], inputShape.getPadding(3),
-                                    weightShape.getPadding(1), ifmapOffset,
-                                    actInfo.function, actInfo.params,
-                                    &sampling);
-                    accelPool.addFinishFlag(
-                            currAccelIdx, std::move(finishFlag));
+                    // The kernel may run on another thread after this
+                    // returns, so all of its arguments are captured by value.
+                    float16* inputData = inputTile->data<float16>();
+                    float16* weightData = weightTile->data<float16>();
+                    float16* outputData = outputTile->data<float16>();
+                    int weightDim = weightShape[1];
+                    int inputPad = inputShape.getPadding(3);
+                    int weightPad = weightShape.getPadding(1);
+                    ActivationInfo act = actInfo;
+                    SamplingInfo* samplingInfo = &sampling;
+                    TiledTensor* outputTiles = &outputs;
+                    accelPool.invokeKernel(
+                            currAccelIdx, smv::kBatchNormHw + currAccelIdx,
+                            [=](float* spad0, float* spad1,
+                                float* spad2) mutable {
+                                smv_batch_norm_post_conv_nhwc_vec_fxp(
+                                        inputData, weightData, outputData,
+                                        spad0, spad1, spad2, inputDims,
+                                        weightDim, inputPad, weightPad,
+                                        ifmapOffset, act.function, act.params,
+                                        samplingInfo);
+                                // Every invocation finishes its output tile.
+                                if (pipelineCopies)
+                                    outputTiles->gatherTile(outputTileIdx);
+                            });
                     ifmapOffset += inputShape[3];
-                    currAccelIdx =
-                            accelPool.getNextAvailableAccelerator(currAccelIdx);
                 }
+                // The kernel only loads the weights with the first
+                // channelwise tile (at a zero weights offset), so all the
+                // channelwise tiles of a spatial tile run on the same
+                // accelerator.
+                currAccelIdx =
+                        accelPool.getNextAvailableAccelerator(currAccelIdx);
             }
         }
     }
@@ -198,7 +232,9 @@ void SmvBatchNormOp::run() {
     dout(2) << *gamma << "\n";
     dout(2) << *beta << "\n";
 
-    {
+    // When the tile copies are pipelined, the tile dispatchers prefetch the
+    // tiles instead.
+    if (!shouldPipelineTileCopies()) {
         auto stats = gem5::ScopedStats(
                 stats::kTensorPrepStart, stats::kTensorPrepEnd);
         tiledTensors[0].copyDataToAllTiles();
@@ -113,3 +113,25 @@ TEST_CASE_METHOD(SmvBatchNormOpTest,
     SECTION("No tiling required") { doFusionTest({ 1, 1024 }); }
     SECTION("DimNC required") { doFusionTest({ 1, 32768 }); }
 }
+
+TEST_CASE_METHOD(SmvBatchNormOpTest,
+                 "SMV Post-Conv Batch Norm on multiple accelerators",
+                 "[smvpool]") {
+    // Natively, every accelerator runs its tiles on a host thread.
+    numAcceleratorsAvailable = 4;
+    SECTION("DimNC tiling") { doTest({ 1, 16, 16, 128 }); }
+    SECTION("DimNHW tiling") { doTest({ 1, 128, 128, 64 }); }
+    SECTION("DimNCW tiling") { doFusionTest({ 1, 64, 512, 512 }); }
+}
+
+TEST_CASE_METHOD(SmvBatchNormOpTest,
+                 "SMV Post-Conv Batch Norm on accelerators with different "
+                 "scratchpad sizes",
+                 "[smvpool]") {
+    numAcceleratorsAvailable = 2;
+    SmvBackend::setSpadSize(1, 16 * 1024);
+    // The tiles must fit in the smaller scratchpads.
+    REQUIRE(SmvBackend::SpadSize() == 16 * 1024);
+    SECTION("DimNH tiling") { doTest({ 1, 64, 64, 32 }); }
+    SECTION("DimNCH tiling") { doTest({ 1, 64, 64, 512 }); }
+}
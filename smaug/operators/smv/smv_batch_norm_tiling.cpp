@@ -204,9 +204,8 @@ void TilingOptimizer::enumPostConvTilingConfigs(
     assert(!fullConfigs.empty() && "No tiling configurations found!");
 }
 
-TilingConfig TilingOptimizer::computeBasicTileShapes(Tensor* inputs,
-                                                     Tensor* weights,
-                                                     Tensor* outputs) {
+std::vector<TilingConfig> TilingOptimizer::enumTilingConfigs(
+        Tensor* inputs, Tensor* weights, Tensor* outputs) {
     int maxTileSize = SmvBackend::SpadSize() / inputs->getDataTypeSize();
     // The outputs have the same shape as the inputs. No need to tile it.
     assert(inputs->getShape() == outputs->getShape());
@@ -243,20 +242,66 @@ TilingConfig TilingOptimizer::computeBasicTileShapes(Tensor* inputs,
             << "\n";
     for (auto& config : fullConfigs)
         dout(2) << "    " << config << "\n";
-    auto maxIt = std::max_element(
-            fullConfigs.begin(),
-            fullConfigs.end(),
-            [](const TilingConfig& c1, const TilingConfig& c2) {
-                return c1.getTotalSize() < c2.getTotalSize();
+    // Fill in the tiling dims.
+    for (auto& config : fullConfigs) {
+        config.inputTilingDims = inputTilingDims;
+        config.weightTilingDims = weightTilingDims;
+        config.outputTilingDims = outputTilingDims;
+    }
+    return std::vector<TilingConfig>(fullConfigs.begin(), fullConfigs.end());
+}
+
+TilingConfig TilingOptimizer::computeBasicTileShapes(Tensor* inputs,
+                                                     Tensor* weights,
+                                                     Tensor* outputs) {
+    std::vector<TilingConfig> fullConfigs =
+            enumTilingConfigs(inputs, weights, outputs);
+    auto maxIt = chooseBestConfig(
+            fullConfigs, [inputs, weights](const TilingConfig& config) {
+                return estimateCost(inputs, weights, config);
             });
     assert(maxIt != fullConfigs.end() && "Failed to get best tiling config!");
-    // Fill in the tiling dims.
-    (*maxIt).inputTilingDims = inputTilingDims;
-    (*maxIt).weightTilingDims = weightTilingDims;
-    (*maxIt).outputTilingDims = outputTilingDims;
     return *maxIt;
 }
 
+TilingCost TilingOptimizer::estimateCost(Tensor* inputs,
+                                         Tensor* weights,
+                                         const TilingConfig& config) {
+    const TensorShape& inputsShape = inputs->getShape();
+    const TensorShape& weightsShape = weights->getShape();
+    int elementSize = inputs->getDataTypeSize();
+    std::vector<int> noHalos(inputsShape.ndims(), 0);
+    int64_t inputSweepBytes = computeSweepBytes(
+            inputsShape, config.inputs, noHalos, elementSize);
+    int64_t weightSweepBytes = computeSweepBytes(
+            weightsShape, config.weights, { 0, 0 }, elementSize);
+    int chanIdx = inputsShape.ndims() - 1;
+    int inputChanTiles =
+            computeNumTiles(inputsShape[chanIdx], config.inputs[chanIdx]);
+    // The number of input tiles that are not channelwise tiles of another.
+    int64_t inputSpatialTiles = 1;
+    for (int i = 0; i < chanIdx; i++)
+        inputSpatialTiles *= computeNumTiles(inputsShape[i], config.inputs[i]);
+
+    TilingCost cost;
+    cost.inputBytes = inputSweepBytes;
+    cost.outputBytes = inputSweepBytes;
+    if (inputsShape.ndims() == 4) {
+        // Post-convolution: the weights are loaded along with the first
+        // channelwise input tile.
+        cost.invocations = inputSpatialTiles * inputChanTiles;
+        cost.weightBytes = inputSpatialTiles * weightSweepBytes;
+    } else {
+        // Post-FC: the kernel loads a weight tile on every invocation.
+        int weightActTiles =
+                computeNumTiles(weightsShape[1], config.weights[1]);
+        cost.invocations =
+                inputSpatialTiles * std::max(inputChanTiles, weightActTiles);
+        cost.weightBytes = inputSpatialTiles * weightSweepBytes;
+    }
+    return cost;
+}
+
 std::array<TiledTensor, 3> TilingOptimizer::doTiling(SmvBatchNormOp* op) {
     auto inputs = op->getInput(SmvBatchNormOp::Inputs);
     auto mean = op->getInput(SmvBatchNormOp::Mean);
@@ -271,10 +316,9 @@ std::array<TiledTensor, 3> TilingOptimizer::doTiling(SmvBatchNormOp* op) {
             TilingOptimizer::computeBasicTileShapes(inputs, weights, outputs);
     TiledTensor tiledInputs =
             generateTiledTensor(inputs, tileConfig.inputs, op);
-    // Copy data for the weight tiles since the data is read-only.
+    // Pack the weight tiles once since the data is read-only.
     TiledTensor tiledWeights =
-            generateTiledTensor(weights, tileConfig.weights, 
-			        op, /* copyData */ true);
+            generatePackedTiledTensor(weights, tileConfig.weights, op);
     TiledTensor tiledOutputs =
             generateTiledTensor(outputs, tileConfig.inputs, op);
     return { tiledInputs, tiledWeights, tiledOutputs };
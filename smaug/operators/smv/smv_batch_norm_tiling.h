@@ -33,8 +33,10 @@ class TilingOptimizer : TilingOptimizerBase {
      * enumerate all possible basic tile shapes for inputs, weights, and
      * outputs. A **basic** shape is the shape that all but potentially the
      * last tile along a set of dimensions will use. This triplet of tile
-     * shapes defines a TilingConfig. The TilingConfig that maximizes the total
-     * combined size of input, weights, and output tiles is chosen as the best.
+     * shapes defines a TilingConfig. By default, the TilingConfig that
+     * maximizes the total combined size of input, weights, and output tiles is
+     * chosen as the best. With the MinDataMovement objective, the one with the
+     * lowest estimateCost() is chosen instead.
      *
      * This algorithm assumes that the maximum tile size for weights, inputs,
      * and outputs are all the same and that they will reside in separate
@@ -50,6 +52,30 @@ class TilingOptimizer : TilingOptimizerBase {
                                                Tensor* weights,
                                                Tensor* outputs);
 
+    /**
+     * Enumerates the candidate TilingConfigs (see TilingConfig).
+     *
+     * @param inputs Inputs tensor of the batch norm operator.
+     * @param weights A tensor that concatenates the four weights tensors of
+     * the batch norm operator.
+     * @param outputs Outputs tensor of the batch norm operator.
+     */
+    static std::vector<TilingConfig> enumTilingConfigs(Tensor* inputs,
+                                                       Tensor* weights,
+                                                       Tensor* outputs);
+
+    /**
+     * Estimates the data movement and invocations of running batch norm with
+     * the given TilingConfig.
+     *
+     * After a convolution, the kernel reloads the weights for every input tile
+     * that starts a new channel sweep. After an FC layer, it reloads a weight
+     * tile on every invocation.
+     */
+    static TilingCost estimateCost(Tensor* inputs,
+                                   Tensor* weights,
+                                   const TilingConfig& config);
+
    protected:
     /**
      * Determine the best tiling dimensions for running batch norm on SMV.
@@ -394,3 +394,54 @@ TEST_CASE_METHOD(SmaugTest, "Post-fc bn tiling", "[smvtiling]") {
         }
     }
 }
+
+TEST_CASE_METHOD(SmaugTest, "SMV bn tiling cost", "[smvtiling]") {
+    using namespace smaug::smv;
+    using namespace smaug::smv::bn;
+    auto bnOp = new SmvBatchNormOp("bn", workspace());
+
+    SECTION("Post-conv bn") {
+        TensorShape inputShape(
+                { 1, 32, 32, 32 }, DataLayout::NHWC, SmvBackend::Alignment);
+        Tensor* inputs = new Tensor("inputs", inputShape);
+        workspace()->addTensor(inputs);
+        bnOp->setInput(inputs, 0);
+        bnOp->createAllTensors();
+        allocateAllTensors<float16>(bnOp);
+        auto weights = concatWeightTensors(bnOp);
+        TensorShape tileShape(
+                { 1, 8, 32, 32 }, DataLayout::NHWC, SmvBackend::Alignment);
+        TilingConfig config(tileShape, weights->getShape(), tileShape);
+        TilingCost cost =
+                TilingOptimizer::estimateCost(inputs, weights, config);
+        // 4 row-wise tiles, each of which loads the weights again.
+        REQUIRE(cost.invocations == 4);
+        REQUIRE(cost.inputBytes == 32 * 32 * 32 * 2);
+        REQUIRE(cost.weightBytes == 4 * 4 * 32 * 2);
+        REQUIRE(cost.outputBytes == 32 * 32 * 32 * 2);
+    }
+
+    SECTION("Post-fc bn") {
+        TensorShape inputShape(
+                { 1, 4096 }, DataLayout::NC, SmvBackend::Alignment);
+        Tensor* inputs = new Tensor("inputs", inputShape);
+        workspace()->addTensor(inputs);
+        bnOp->setInput(inputs, 0);
+        bnOp->createAllTensors();
+        allocateAllTensors<float16>(bnOp);
+        auto weights = concatWeightTensors(bnOp);
+        TilingConfig config(
+                TensorShape({ 1, 2048 }, DataLayout::NC, SmvBackend::Alignment),
+                TensorShape({ 4, 2048 }, DataLayout::NC, SmvBackend::Alignment),
+                TensorShape(
+                        { 1, 2048 }, DataLayout::NC, SmvBackend::Alignment));
+        TilingCost cost =
+                TilingOptimizer::estimateCost(inputs, weights, config);
+        // Every invocation loads its own weight tile, so the weights are
+        // loaded once in 2 activation-wise tiles.
+        REQUIRE(cost.invocations == 2);
+        REQUIRE(cost.inputBytes == 4096 * 2);
+        REQUIRE(cost.weightBytes == 4 * 4096 * 2);
+        REQUIRE(cost.outputBytes == 4096 * 2);
+    }
+}
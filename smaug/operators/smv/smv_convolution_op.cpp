@@ -47,6 +47,23 @@ void SmvConvolutionOp::runNHWC(TiledTensor& inputs,
         setArrayMemTypeIfSimulating(
                 accelId + i, "host_results", getOutputsMemType());
     }
+    bool pipelineCopies = shouldPipelineTileCopies();
+    if (pipelineCopies) {
+        // Queue the tile copies in the order the loop nest below first uses
+        // the tiles, so they are ready by the time the kernels need them: the
+        // first row of the inputs, then the weights, which are reused by every
+        // row, and then the rest of the inputs.
+        for (int N = 0; N < inputIfmapTiles; N++) {
+            for (int H = 0; H < inputRowTiles; H++) {
+                for (int C = 0; C < inputChanTiles; C++)
+                    inputs.prefetchTile(inputIdx(N, H, 0, C));
+                if (N == 0 && H == 0) {
+                    for (int i = 0; i < weights.size(); i++)
+                        weights.prefetchTile(i);
+                }
+            }
+        }
+    }
     int currAccelIdx = 0;
     for (int N = 0; N < inputIfmapTiles; N++) {
         for (int H = 0; H < outputRowTiles; H++) {
@@ -179,41 +196,64 @@ void SmvConvolutionOp::runNHWC(TiledTensor& inputs,
                         // to be sent back to the host.
                         bool sendResults = wC == weightChanTiles - 1;
 
-                        std::unique_ptr<volatile int> finishFlag;
                         if (useSystolicArrayWhenAvailable) {
                             // Invoke the systolic array if specified.
-                            finishFlag = invokeSystolicArrayKernel(
-                                    accelId + currAccelIdx,
-                                    inputTile->data<float16>(),
-                                    weightsTile->data<float16>(),
-                                    outputTile->data<float16>(), inputDims,
-                                    weightsDims, outputDims,
-                                    inputShape.getPadding(3),
-                                    weightsShape.getPadding(3),
-                                    outputShape.getPadding(3), inputHaloPad,
-                                    getRowStride(), ifmapStart, kernStart,
-                                    accumulate, readInputs, readWeights,
-                                    sendResults, &actInfo);
+                            accelPool.addFinishFlag(
+                                    currAccelIdx,
+                                    invokeSystolicArrayKernel(
+                                            accelId + currAccelIdx,
+                                            inputTile->data<float16>(),
+                                            weightsTile->data<float16>(),
+                                            outputTile->data<float16>(),
+                                            inputDims, weightsDims, outputDims,
+                                            inputShape.getPadding(3),
+                                            weightsShape.getPadding(3),
+                                            outputShape.getPadding(3),
+                                            inputHaloPad, getRowStride(),
+                                            ifmapStart, kernStart, accumulate,
+                                            readInputs, readWeights,
+                                            sendResults, &actInfo));
                         } else {
-                            // Otherwise invoke the DLA-like kernel.
-                            finishFlag = invokeKernelNoBlock(
+                            // Otherwise invoke the DLA-like kernel. The kernel
+                            // may run on another thread after this returns, so
+                            // all of its arguments are captured by value.
+                            float16* inputData = inputTile->data<float16>();
+                            float16* weightsData =
+                                    weightsTile->data<float16>();
+                            float16* outputData = outputTile->data<float16>();
+                            int inputPad = inputShape.getPadding(3);
+                            int weightsPad = weightsShape.getPadding(3);
+                            int outputPad = outputShape.getPadding(3);
+                            int rowStride = getRowStride();
+                            int colStride = getColStride();
+                            ActivationInfo act = actInfo;
+                            SamplingInfo* samplingInfo = &sampling;
+                            // Once the results are sent back, the output tile
+                            // is final, so copy it back right away.
+                            bool gatherResults = pipelineCopies && sendResults;
+                            TiledTensor* outputTiles = &outputs;
+                            accelPool.invokeKernel(
                                     currAccelIdx, accelId + currAccelIdx,
-                                    smv_conv3d_nhwc_vec_fxp,
-                                    inputTile->data<float16>(),
-                                    weightsTile->data<float16>(),
-                                    outputTile->data<float16>(), smv::spad0,
-                                    smv::spad1, smv::spad2, inputDims,
-                                    weightsDims, outputDims,
-                                    inputShape.getPadding(3),
-                                    weightsShape.getPadding(3),
-                                    outputShape.getPadding(3), inputHaloPad,
-                                    getRowStride(), getColStride(), ifmapStart,
-                                    kernStart, accumulate, readInputs,
-                                    readWeights, sendResults, actInfo.function,
-                                    actInfo.params, &sampling);
+                                    [=](float* spad0,
+                                        float* spad1,
+                                        float* spad2) mutable {
+                                        smv_conv3d_nhwc_vec_fxp(
+                                                inputData, weightsData,
+                                                outputData, spad0, spad1,
+                                                spad2, inputDims, weightsDims,
+                                                outputDims, inputPad,
+                                                weightsPad, outputPad,
+                                                inputHaloPad, rowStride,
+                                                colStride, ifmapStart,
+                                                kernStart, accumulate,
+                                                readInputs, readWeights,
+                                                sendResults, act.function,
+                                                act.params, samplingInfo);
+                                        if (gatherResults)
+                                            outputTiles->gatherTile(
+                                                    outputTileIdx);
+                                    });
                         }
-                        accelPool.addFinishFlag(
-                                currAccelIdx, std::move(finishFlag));
 
                         ifmapOffset += weightsTile->getShape()[3];
                         if (inputChanTiles == weightChanTiles) {
@@ -318,7 +358,9 @@ void SmvConvolutionOp::run() {
     assert(outputShape.getLayout() == DataLayout::NHWC);
     dout(2) << *kernels << "\n";
 
-    {
+    // When the tile copies are pipelined, runNHWC() prefetches the tiles
+    // instead.
+    if (!shouldPipelineTileCopies()) {
         auto stats = gem5::ScopedStats(
                 stats::kTensorPrepStart, stats::kTensorPrepEnd);
         tiledTensors[0].copyDataToAllTiles();
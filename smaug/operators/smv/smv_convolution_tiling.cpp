@@ -54,7 +54,8 @@ std::array<TilingDims, 3> TilingOptimizer::determineBestTilingDims(
     return { bestInputTilingDims, bestWeightTilingDims, bestOutputTilingDims };
 }
 
-TilingConfig TilingOptimizer::computeBasicTileShapes(SmvConvolutionOp* op) {
+std::vector<TilingConfig> TilingOptimizer::enumTilingConfigs(
+        SmvConvolutionOp* op) {
     Tensor* inputs = op->getInput(op->Inputs);
     Tensor* weights = op->getInput(op->Kernels);
     Tensor* outputs = op->getOutput(op->Outputs);
@@ -232,20 +233,72 @@ TilingConfig TilingOptimizer::computeBasicTileShapes(SmvConvolutionOp* op) {
             << "\n";
     for (auto& config : fullConfigs)
         dout(2) << "    " << config << "\n";
-    auto maxIt = std::max_element(
-            fullConfigs.begin(),
-            fullConfigs.end(),
-            [](const TilingConfig& c1, const TilingConfig& c2) {
-                return c1.getTotalSize() < c2.getTotalSize();
+    // Fill in the tiling dims.
+    for (auto& config : fullConfigs) {
+        config.inputTilingDims = inputTilingDims;
+        config.weightTilingDims = weightTilingDims;
+        config.outputTilingDims = outputTilingDims;
+    }
+    return fullConfigs;
+}
+
+TilingConfig TilingOptimizer::computeBasicTileShapes(SmvConvolutionOp* op) {
+    std::vector<TilingConfig> fullConfigs = enumTilingConfigs(op);
+    auto maxIt =
+            chooseBestConfig(fullConfigs, [op](const TilingConfig& config) {
+                return estimateCost(op, config);
             });
     assert(maxIt != fullConfigs.end() && "Failed to get best tiling config!");
-    // Fill in the tiling dims.
-    (*maxIt).inputTilingDims = inputTilingDims;
-    (*maxIt).weightTilingDims = weightTilingDims;
-    (*maxIt).outputTilingDims = outputTilingDims;
     return *maxIt;
 }
 
+TilingCost TilingOptimizer::estimateCost(SmvConvolutionOp* op,
+                                         const TilingConfig& config) {
+    const TensorShape& inputsShape = op->getInput(op->Inputs)->getShape();
+    const TensorShape& weightsShape = op->getInput(op->Kernels)->getShape();
+    const TensorShape& outputsShape = op->getOutput(op->Outputs)->getShape();
+    int elementSize = op->getInput(op->Inputs)->getDataTypeSize();
+    // Consecutive rowwise input tiles overlap by the filter field size minus
+    // the stride.
+    int rowHalo = op->getWeightRows() - op->getRowStride();
+    int inputBatchTiles = computeNumTiles(inputsShape[0], config.inputs[0]);
+    int inputRowTiles =
+            computeNumTiles(inputsShape[1], config.inputs[1], rowHalo);
+    int inputChanTiles = computeNumTiles(inputsShape[3], config.inputs[3]);
+    int weightOfmapTiles = computeNumTiles(weightsShape[0], config.weights[0]);
+    int weightChanTiles = computeNumTiles(weightsShape[3], config.weights[3]);
+    int outputChanTiles = computeNumTiles(outputsShape[3], config.outputs[3]);
+    int numOutputInvocations =
+            weightOfmapTiles < outputChanTiles ? outputChanTiles : 1;
+    // The number of passes over the channelwise tiles, each of which
+    // produces one output tile.
+    int64_t numPasses = (int64_t)inputBatchTiles * inputRowTiles *
+                        weightOfmapTiles * numOutputInvocations;
+
+    TilingCost cost;
+    cost.invocations = numPasses * std::max(inputChanTiles, weightChanTiles);
+    int64_t inputSweeps =
+            inputChanTiles > 1 ? weightOfmapTiles * numOutputInvocations : 1;
+    cost.inputBytes = inputSweeps * computeSweepBytes(inputsShape,
+                                                      config.inputs,
+                                                      { 0, rowHalo, 0, 0 },
+                                                      elementSize);
+    int64_t weightSweeps = 1;
+    if (weightChanTiles > 1) {
+        weightSweeps = (int64_t)inputBatchTiles * inputRowTiles *
+                       numOutputInvocations;
+    } else if (weightOfmapTiles > 1) {
+        weightSweeps = (int64_t)inputBatchTiles * inputRowTiles;
+    }
+    cost.weightBytes = weightSweeps * computeSweepBytes(weightsShape,
+                                                        config.weights,
+                                                        { 0, 0, 0, 0 },
+                                                        elementSize);
+    cost.outputBytes = computeSweepBytes(
+            outputsShape, config.outputs, { 0, 0, 0, 0 }, elementSize);
+    return cost;
+}
+
 TiledTensor TilingOptimizer::generateRowwiseOutputTiledTensor(
         SmvConvolutionOp* op,
         const TiledTensor& inputTiledTensor,
@@ -356,10 +409,9 @@ std::array<TiledTensor, 3> TilingOptimizer::doTiling(SmvConvolutionOp* op) {
                                                     op->getRowStride(),
                                                     op->getColStride(),
                                                     op->getPadding());
-    // Copy data for the weight tiles since the data is read-only.
+    // Pack the weight tiles once since the data is read-only.
     TiledTensor tiledWeights =
-            generateTiledTensor(kernels, tileConfig.weights,
-			        op, /* copyData */ true);
+            generatePackedTiledTensor(kernels, tileConfig.weights, op);
     TiledTensor tiledOutputs;
     if (needsHwiseTiling(tileConfig.outputTilingDims)) {
         tiledOutputs = TilingOptimizer::generateRowwiseOutputTiledTensor(
@@ -28,8 +28,10 @@ class TilingOptimizer : public TilingOptimizerBase {
      * enumerate all possible basic tile shapes for inputs, weights, and
      * outputs. A **basic** shape is the shape that all but potentially the
      * last tile along a set of dimensions will use. This triplet of tile
-     * shapes defines a TilingConfig. The TilingConfig that maximizes the total
-     * combined size of input, weights, and output tiles is chosen as the best.
+     * shapes defines a TilingConfig. By default, the TilingConfig that
+     * maximizes the total combined size of input, weights, and output tiles is
+     * chosen as the best. With the MinDataMovement objective, the one with the
+     * lowest estimateCost() is chosen instead.
      *
      * To limit the number of possibilities, we only enumerate each dimension
      * in certain increments. For example, input channels are only enumerated
@@ -46,6 +48,27 @@ class TilingOptimizer : public TilingOptimizerBase {
      */
     static TilingConfig computeBasicTileShapes(SmvConvolutionOp* op);
 
+    /**
+     * Enumerates the candidate TilingConfigs (see TilingConfig).
+     *
+     * @param op The SMV convolution operator. All tensors must have been
+     * created with createAllTensors() prior to calling this function.
+     */
+    static std::vector<TilingConfig> enumTilingConfigs(SmvConvolutionOp* op);
+
+    /**
+     * Estimates the data movement and invocations of running this convolution
+     * with the given TilingConfig.
+     *
+     * This follows the loop nest of SmvConvolutionOp::runNHWC. An input tile
+     * is reloaded whenever the tile changes between consecutive invocations,
+     * so inputs that are not tiled channelwise are read only once per row
+     * tile. Likewise, weights are reloaded for every row tile when there is
+     * more than one weight tile. Each output tile is written back once.
+     */
+    static TilingCost estimateCost(SmvConvolutionOp* op,
+                                   const TilingConfig& config);
+
     /**
      * A specialized output tiling function when the output is tiled rowwise.
      *
@@ -846,3 +846,89 @@ TEST_CASE_METHOD(SmaugTest, "Stride size tests", "[smvtiling]") {
         }
     }
 }
+
+TEST_CASE_METHOD(SmaugTest, "Data movement objective tests", "[smvtiling]") {
+    using namespace smaug::smv;
+    using namespace smaug::smv::conv;
+    auto convOp = new SmvConvolutionOp("conv", workspace());
+    convOp->setStride(1, 1);
+    convOp->setPadding(SamePadding);
+
+    SECTION("No tiling needed") {
+        TensorShape inputShape(
+                { 1, 32, 32, 8 }, DataLayout::NHWC, SmvBackend::Alignment);
+        Tensor* inputs = new Tensor("inputs", inputShape);
+        workspace()->addTensor(inputs);
+        convOp->setInput(inputs, 0);
+        convOp->setWeightDims(5, 5, 8);
+        convOp->createAllTensors();
+        allocateAllTensors<float16>(convOp);
+        tilingObjective = MinDataMovement;
+        TilingConfig config = TilingOptimizer::computeBasicTileShapes(convOp);
+        REQUIRE(config.inputs == inputShape);
+        TilingCost cost = TilingOptimizer::estimateCost(convOp, config);
+        REQUIRE(cost.invocations == 1);
+        REQUIRE(cost.inputBytes == inputShape.storageSize() * 2);
+    }
+
+    SECTION("Costs no more than the max utilization config") {
+        TensorShape inputShape(
+                { 1, 64, 64, 192 }, DataLayout::NHWC, SmvBackend::Alignment);
+        Tensor* inputs = new Tensor("inputs", inputShape);
+        workspace()->addTensor(inputs);
+        convOp->setInput(inputs, 0);
+        convOp->setWeightDims(3, 3, 128);
+        convOp->createAllTensors();
+        allocateAllTensors<float16>(convOp);
+        TilingConfig maxSizeConfig =
+                TilingOptimizer::computeBasicTileShapes(convOp);
+        tilingObjective = MinDataMovement;
+        TilingConfig minCostConfig =
+                TilingOptimizer::computeBasicTileShapes(convOp);
+        TilingCost maxSizeCost =
+                TilingOptimizer::estimateCost(convOp, maxSizeConfig);
+        TilingCost minCost = TilingOptimizer::estimateCost(convOp, minCostConfig);
+        REQUIRE(!(maxSizeCost < minCost));
+        REQUIRE(minCost.getTotalBytes() <= maxSizeCost.getTotalBytes());
+        REQUIRE(minCost.getTotalBytes() >=
+                (int64_t)(inputs->getShape().storageSize() +
+                          convOp->getInput(1)->getShape().storageSize() +
+                          convOp->getOutput(0)->getShape().storageSize()) *
+                        2);
+    }
+}
+
+TEST_CASE_METHOD(SmaugTest, "Tiling config enumeration", "[smvtiling]") {
+    using namespace smaug::smv;
+    using namespace smaug::smv::conv;
+    auto convOp = new SmvConvolutionOp("conv", workspace());
+    convOp->setStride(1, 1);
+    convOp->setPadding(SamePadding);
+    TensorShape inputShape(
+            { 1, 32, 32, 64 }, DataLayout::NHWC, SmvBackend::Alignment);
+    Tensor* inputs = new Tensor("inputs", inputShape);
+    workspace()->addTensor(inputs);
+    convOp->setInput(inputs, 0);
+    convOp->setWeightDims(3, 3, 128);
+    convOp->createAllTensors();
+    allocateAllTensors<float16>(convOp);
+    std::vector<TilingConfig> configs =
+            TilingOptimizer::enumTilingConfigs(convOp);
+    TilingConfig best = TilingOptimizer::computeBasicTileShapes(convOp);
+    REQUIRE(configs.size() > 1);
+    bool found = false;
+    int maxTileSize = SmvBackend::SpadSize() / inputs->getDataTypeSize();
+    for (auto& config : configs) {
+        REQUIRE(config.inputTilingDims == best.inputTilingDims);
+        REQUIRE(config.weightTilingDims == best.weightTilingDims);
+        REQUIRE(config.outputTilingDims == best.outputTilingDims);
+        REQUIRE(config.inputs.storageSize() <= maxTileSize);
+        REQUIRE(config.weights.storageSize() <= maxTileSize);
+        REQUIRE(config.outputs.storageSize() <= maxTileSize);
+        REQUIRE(config.getTotalSize() <= best.getTotalSize());
+        if (config.inputs == best.inputs && config.weights == best.weights &&
+            config.outputs == best.outputs)
+            found = true;
+    }
+    REQUIRE(found);
+}
@@ -114,6 +114,12 @@ void SmvInnerProductOp::runNWA(TiledTensor& inputs,
                                    (W == weightNeuronTiles - 1) &&
                                    (wC == weightActTiles - 1);
 
+                // Unlike the other operators, this doesn't go through
+                // SmvAcceleratorPool::invokeKernel(): the results of all the
+                // neuron tiles accumulate in one results scratchpad that is
+                // only sent back in the very last invocation, so the kernels
+                // must share one set of scratchpads (those of the first
+                // accelerator) and run in order.
                 std::unique_ptr<volatile int> finishFlag = invokeKernelNoBlock(
                         currAccelIdx, smv::kInnerProductHw + currAccelIdx,
                         smv_matrix_multiply_transpose_nc_vec_fxp,
@@ -32,7 +32,8 @@ std::array<TilingDims, 3> TilingOptimizer::determineBestTilingDims(
     return { bestInputTilingDims, bestWeightTilingDims, bestOutputTilingDims };
 }
 
-TilingConfig TilingOptimizer::computeBasicTileShapes(SmvInnerProductOp* op) {
+std::vector<TilingConfig> TilingOptimizer::enumTilingConfigs(
+        SmvInnerProductOp* op) {
     Tensor* inputs = op->getInput(op->Inputs);
     Tensor* weights = op->getInput(op->Weights);
     Tensor* outputs = op->getOutput(op->Outputs);
@@ -181,20 +182,54 @@ TilingConfig TilingOptimizer::computeBasicTileShapes(SmvInnerProductOp* op) {
             << "\n";
     for (auto& config : fullConfigs)
         dout(2) << "    " << config << "\n";
-    auto maxIt = std::max_element(
-            fullConfigs.begin(),
-            fullConfigs.end(),
-            [](const TilingConfig& c1, const TilingConfig& c2) {
-                return c1.getTotalSize() < c2.getTotalSize();
+    // Fill in the tiling dims.
+    for (auto& config : fullConfigs) {
+        config.inputTilingDims = inputTilingDims;
+        config.weightTilingDims = weightTilingDims;
+        config.outputTilingDims = outputTilingDims;
+    }
+    return fullConfigs;
+}
+
+TilingConfig TilingOptimizer::computeBasicTileShapes(SmvInnerProductOp* op) {
+    std::vector<TilingConfig> fullConfigs = enumTilingConfigs(op);
+    auto maxIt =
+            chooseBestConfig(fullConfigs, [op](const TilingConfig& config) {
+                return estimateCost(op, config);
             });
     assert(maxIt != fullConfigs.end() && "Failed to get best tiling config!");
-    // Fill in the tiling dims.
-    maxIt->inputTilingDims = inputTilingDims;
-    maxIt->weightTilingDims = weightTilingDims;
-    maxIt->outputTilingDims = outputTilingDims;
     return *maxIt;
 }
 
+TilingCost TilingOptimizer::estimateCost(SmvInnerProductOp* op,
+                                         const TilingConfig& config) {
+    const TensorShape& inputsShape = op->getInput(op->Inputs)->getShape();
+    const TensorShape& weightsShape = op->getInput(op->Weights)->getShape();
+    const TensorShape& outputsShape = op->getOutput(op->Outputs)->getShape();
+    int elementSize = op->getInput(op->Inputs)->getDataTypeSize();
+    int inputBatchTiles = computeNumTiles(inputsShape[0], config.inputs[0]);
+    int inputActTiles = computeNumTiles(inputsShape[1], config.inputs[1]);
+    int weightNeuronTiles =
+            computeNumTiles(weightsShape[0], config.weights[0]);
+    int weightActTiles = computeNumTiles(weightsShape[1], config.weights[1]);
+
+    TilingCost cost;
+    cost.invocations = (int64_t)inputBatchTiles * weightNeuronTiles *
+                       std::max(inputActTiles, weightActTiles);
+    int64_t inputSweeps = inputActTiles > 1 ? weightNeuronTiles : 1;
+    cost.inputBytes = inputSweeps * computeSweepBytes(inputsShape,
+                                                      config.inputs,
+                                                      { 0, 0 },
+                                                      elementSize);
+    cost.weightBytes = inputBatchTiles * computeSweepBytes(weightsShape,
+                                                           config.weights,
+                                                           { 0, 0 },
+                                                           elementSize);
+    cost.outputBytes = computeSweepBytes(
+            outputsShape, config.outputs, { 0, 0 }, elementSize);
+    return cost;
+}
+
 std::array<TiledTensor, 3> TilingOptimizer::doTiling(SmvInnerProductOp* op) {
     auto input = op->getInput(SmvInnerProductOp::Inputs);
     auto kernels = op->getInput(SmvInnerProductOp::Weights);
@@ -202,10 +237,9 @@ std::array<TiledTensor, 3> TilingOptimizer::doTiling(SmvInnerProductOp* op) {
     TilingConfig tileConfig = TilingOptimizer::computeBasicTileShapes(op);
     TiledTensor tiledInputs =
             generateTiledTensor(input, tileConfig.inputs, op, /* copy_data*/ false);
-    // Copy data for the weight tiles since the data is read-only.
+    // Pack the weight tiles once since the data is read-only.
     TiledTensor tiledWeights =
-            generateTiledTensor(kernels, tileConfig.weights, op);
-    tiledWeights.copyDataToAllTiles();
+            generatePackedTiledTensor(kernels, tileConfig.weights, op);
     TiledTensor tiledOutputs =
             generateTiledTensor(output, tileConfig.outputs, op, /* copy_data */ false);
     return { tiledInputs, tiledWeights, tiledOutputs };
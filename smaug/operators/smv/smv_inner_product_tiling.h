@@ -28,8 +28,10 @@ class TilingOptimizer : public TilingOptimizerBase {
      * enumerate all possible basic tile shapes for inputs, weights, and
      * outputs. A **basic** shape is the shape that all but potentially the
      * last tile along a set of dimensions will use. This triplet of tile
-     * shapes defines a TilingConfig. The TilingConfig that maximizes the total
-     * combined size of input, weights, and output tiles is chosen as the best.
+     * shapes defines a TilingConfig. By default, the TilingConfig that
+     * maximizes the total combined size of input, weights, and output tiles is
+     * chosen as the best. With the MinDataMovement objective, the one with the
+     * lowest estimateCost() is chosen instead.
      *
      * To limit the number of possibilities, we only enumerate each dimension
      * in certain increments. For example, input channels are only enumerated
@@ -46,6 +48,26 @@ class TilingOptimizer : public TilingOptimizerBase {
      */
     static TilingConfig computeBasicTileShapes(SmvInnerProductOp* op);
 
+    /**
+     * Enumerates the candidate TilingConfigs (see TilingConfig).
+     *
+     * @param op The SMV inner product operator. All tensors must have been
+     * created with createAllTensors() prior to calling this function.
+     */
+    static std::vector<TilingConfig> enumTilingConfigs(SmvInnerProductOp* op);
+
+    /**
+     * Estimates the data movement and invocations of running this inner
+     * product with the given TilingConfig.
+     *
+     * This follows the loop nest of SmvInnerProductOp::runNWA. The kernel
+     * reads a weight tile on every invocation, so the weights are streamed
+     * once per batch tile. Inputs that are not tiled on activations stay in
+     * the scratchpad across the neuron-wise weight tiles.
+     */
+    static TilingCost estimateCost(SmvInnerProductOp* op,
+                                   const TilingConfig& config);
+
    protected:
     /**
      * Determine the best tiling dimensions for running inner product on SMV.
@@ -162,3 +162,61 @@ TEST_CASE_METHOD(SmaugTest, "Basic tiling tests", "[smvtiling]") {
         }
     }
 }
+
+TEST_CASE_METHOD(SmaugTest, "Data movement objective tests", "[smvtiling]") {
+    using namespace smaug::smv;
+    using namespace smaug::smv::fc;
+    auto fcOp = new SmvInnerProductOp("fc", workspace());
+
+    SECTION("Neuron-wise weight tiles") {
+        TensorShape inputShape(
+                { 1, 256 }, DataLayout::NC, SmvBackend::Alignment);
+        Tensor* inputs = new Tensor("inputs", inputShape);
+        workspace()->addTensor(inputs);
+        fcOp->setInput(inputs, 0);
+        fcOp->setNumOutputs(128);
+        fcOp->createAllTensors();
+        allocateAllTensors<float16>(fcOp);
+        TilingConfig config = TilingOptimizer::computeBasicTileShapes(fcOp);
+        REQUIRE(config.weights.dims() == std::vector<int>{ 64, 256 });
+        TilingCost cost = TilingOptimizer::estimateCost(fcOp, config);
+        // One invocation per weight tile. The inputs stay in the scratchpad
+        // across them, and every other byte moves once.
+        REQUIRE(cost.invocations == 2);
+        REQUIRE(cost.inputBytes == 256 * 2);
+        REQUIRE(cost.weightBytes == 128 * 256 * 2);
+        REQUIRE(cost.outputBytes == 128 * 2);
+    }
+
+    SECTION("Activation-wise input tiles") {
+        TensorShape inputShape(
+                { 1, 32768 }, DataLayout::NC, SmvBackend::Alignment);
+        Tensor* inputs = new Tensor("inputs", inputShape);
+        workspace()->addTensor(inputs);
+        fcOp->setInput(inputs, 0);
+        fcOp->setNumOutputs(256);
+        fcOp->createAllTensors();
+        allocateAllTensors<float16>(fcOp);
+        TilingConfig config = TilingOptimizer::computeBasicTileShapes(fcOp);
+        REQUIRE(config.inputs.dims() == std::vector<int>{ 1, 2048 });
+        REQUIRE(config.weights.dims() == std::vector<int>{ 8, 2048 });
+        TilingCost cost = TilingOptimizer::estimateCost(fcOp, config);
+        // 16 activation-wise tiles for each of the 32 neuron-wise tiles. The
+        // input tiles change on every invocation, so the whole input is loaded
+        // again for every neuron-wise tile.
+        REQUIRE(cost.invocations == 32 * 16);
+        REQUIRE(cost.inputBytes == 32 * 32768 * 2);
+        REQUIRE(cost.weightBytes == 256 * 32768 * 2);
+        REQUIRE(cost.outputBytes == 256 * 2);
+
+        // Wider neuron-wise tiles of the same size reload the inputs less
+        // often, which the max utilization objective does not see.
+        tilingObjective = MinDataMovement;
+        TilingConfig minCostConfig =
+                TilingOptimizer::computeBasicTileShapes(fcOp);
+        TilingCost minCost =
+                TilingOptimizer::estimateCost(fcOp, minCostConfig);
+        REQUIRE(minCost.inputBytes < cost.inputBytes);
+        REQUIRE(minCost.getTotalBytes() < cost.getTotalBytes());
+    }
+}
@@ -49,7 +49,7 @@ std::array<TilingDims, 2> TilingOptimizer::determineBestTilingDims(
     return { bestInputTilingDims, bestOutputTilingDims };
 }
 
-TilingConfig TilingOptimizer::computeBasicTileShapes(SmvPoolingOp* op) {
+std::vector<TilingConfig> TilingOptimizer::enumTilingConfigs(SmvPoolingOp* op) {
     Tensor* inputs = op->getInput(op->Inputs);
     Tensor* outputs = op->getOutput(op->Outputs);
     int maxTileSize = SmvBackend::SpadSize() / inputs->getDataTypeSize();
@@ -161,19 +161,49 @@ TilingConfig TilingOptimizer::computeBasicTileShapes(SmvPoolingOp* op) {
             << "\n";
     for (auto& config : fullConfigs)
         dout(2) << "    " << config << "\n";
-    auto maxIt = std::max_element(
-            fullConfigs.begin(),
-            fullConfigs.end(),
-            [](const TilingConfig& c1, const TilingConfig& c2) {
-                return c1.getTotalSize() < c2.getTotalSize();
+    // Fill in the tiling dims.
+    for (auto& config : fullConfigs) {
+        config.inputTilingDims = inputTilingDims;
+        config.weightTilingDims = None;
+        config.outputTilingDims = outputTilingDims;
+    }
+    return fullConfigs;
+}
+
+TilingConfig TilingOptimizer::computeBasicTileShapes(SmvPoolingOp* op) {
+    std::vector<TilingConfig> fullConfigs = enumTilingConfigs(op);
+    auto maxIt =
+            chooseBestConfig(fullConfigs, [op](const TilingConfig& config) {
+                return estimateCost(op, config);
             });
     assert(maxIt != fullConfigs.end() && "Failed to get best tiling config!");
-    // Fill in the tiling dims.
-    maxIt->inputTilingDims = inputTilingDims;
-    maxIt->outputTilingDims = outputTilingDims;
     return *maxIt;
 }
 
+TilingCost TilingOptimizer::estimateCost(SmvPoolingOp* op,
+                                         const TilingConfig& config) {
+    const TensorShape& inputsShape = op->getInput(op->Inputs)->getShape();
+    const TensorShape& outputsShape = op->getOutput(op->Outputs)->getShape();
+    int elementSize = op->getInput(op->Inputs)->getDataTypeSize();
+    std::pair<int, int> poolSize = op->getPoolingSize();
+    std::pair<int, int> poolStride = op->getPoolingStride();
+    std::vector<int> inputHalos = { 0, poolSize.first - poolStride.first,
+                                    poolSize.second - poolStride.second, 0 };
+    int64_t numInputTiles = 1;
+    for (int i = 0; i < inputsShape.ndims(); i++) {
+        numInputTiles *= computeNumTiles(
+                inputsShape[i], config.inputs[i], inputHalos[i]);
+    }
+
+    TilingCost cost;
+    cost.invocations = numInputTiles;
+    cost.inputBytes = computeSweepBytes(
+            inputsShape, config.inputs, inputHalos, elementSize);
+    cost.outputBytes = computeSweepBytes(
+            outputsShape, config.outputs, { 0, 0, 0, 0 }, elementSize);
+    return cost;
+}
+
 std::array<TiledTensor, 2> TilingOptimizer::doTiling(SmvPoolingOp* op) {
     auto input = op->getInput(SmvPoolingOp::Inputs);
     auto output = op->getOutput(SmvPoolingOp::Outputs);
@@ -27,9 +27,10 @@ class TilingOptimizer : public TilingOptimizerBase {
      * outputs will be tiled. Then based on those dimensions, we enumerate all
      * possible basic tile shapes for inputs and outputs. A **basic** shape is
      * the shape that all but potentially the last tile along a set of
-     * dimensions will use. This duo of tile shapes defines a TilingConfig. The
-     * TilingConfig that maximizes the total combined size of input and output
-     * tiles is chosen as the best.
+     * dimensions will use. This duo of tile shapes defines a TilingConfig. By
+     * default, the TilingConfig that maximizes the total combined size of
+     * input and output tiles is chosen as the best. With the MinDataMovement
+     * objective, the one with the lowest estimateCost() is chosen instead.
      *
      * To limit the number of possibilities, we only enumerate each dimension
      * in certain increments. For example, input channels are only enumerated
@@ -45,6 +46,25 @@ class TilingOptimizer : public TilingOptimizerBase {
      */
     static TilingConfig computeBasicTileShapes(SmvPoolingOp* op);
 
+    /**
+     * Enumerates the candidate TilingConfigs (see TilingConfig).
+     *
+     * @param op The SMV pooling operator. All tensors must have been created
+     * with createAllTensors() prior to calling this function.
+     */
+    static std::vector<TilingConfig> enumTilingConfigs(SmvPoolingOp* op);
+
+    /**
+     * Estimates the data movement and invocations of running this pooling
+     * operator with the given TilingConfig.
+     *
+     * The pooling kernel loads its input tile on every invocation, so the
+     * only extra traffic comes from the rows and columns of the pooling window
+     * that overlap between neighboring input tiles.
+     */
+    static TilingCost estimateCost(SmvPoolingOp* op,
+                                   const TilingConfig& config);
+
    protected:
 
     /**
@@ -358,3 +358,34 @@ TEST_CASE_METHOD(SmaugTest, "SMV Pooling tiling tests", "[smvtiling]") {
         }
     }
 }
+
+TEST_CASE_METHOD(SmaugTest, "SMV Pooling tiling cost", "[smvtiling]") {
+    using namespace smaug::smv;
+    using namespace smaug::smv::pool;
+    auto poolOp = new SmvMaxPoolingOp("pool", workspace());
+    poolOp->setPoolingSize(3, 3);
+    poolOp->setPoolingStride(2, 2);
+    TensorShape inputShape(
+            { 1, 32, 32, 8 }, DataLayout::NHWC, SmvBackend::Alignment);
+    Tensor* inputs = new Tensor("inputs", inputShape);
+    workspace()->addTensor(inputs);
+    poolOp->setInput(inputs, 0);
+    poolOp->createAllTensors();
+    allocateAllTensors<float16>(poolOp);
+    REQUIRE(poolOp->getOutput(0)->getShape().dims() ==
+            std::vector<int>{ 1, 15, 15, 8 });
+    TilingConfig config(
+            TensorShape(
+                    { 1, 9, 32, 8 }, DataLayout::NHWC, SmvBackend::Alignment),
+            TensorShape(),
+            TensorShape(
+                    { 1, 4, 15, 8 }, DataLayout::NHWC, SmvBackend::Alignment));
+    TilingCost cost = TilingOptimizer::estimateCost(poolOp, config);
+    // Tiles of 9 rows that advance by 8 rows cover the 32 rows in 4 tiles,
+    // and each tile after the first reads the last row of the one before
+    // again.
+    REQUIRE(cost.invocations == 4);
+    REQUIRE(cost.inputBytes == (32 + 3) * 32 * 8 * 2);
+    REQUIRE(cost.weightBytes == 0);
+    REQUIRE(cost.outputBytes == 15 * 15 * 8 * 2);
+}
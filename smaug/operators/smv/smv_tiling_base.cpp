@@ -7,6 +7,27 @@
 namespace smaug {
 namespace smv {
 
+int TilingOptimizerBase::computeNumTiles(int size, int tileSize, int halo) {
+    if (tileSize >= size)
+        return 1;
+    assert(tileSize > halo && "Tiles must advance past their halos!");
+    return 1 + FRAC_CEIL(size - tileSize, tileSize - halo);
+}
+
+int64_t TilingOptimizerBase::computeSweepBytes(const TensorShape& shape,
+                                               const TensorShape& tileShape,
+                                               const std::vector<int>& halos,
+                                               int elementSize) {
+    std::vector<int> coveredDims = shape.dims();
+    for (int i = 0; i < shape.ndims(); i++) {
+        int numTiles = computeNumTiles(shape[i], tileShape[i], halos[i]);
+        coveredDims[i] += (numTiles - 1) * halos[i];
+    }
+    TensorShape covered(
+            coveredDims, shape.getLayout(), shape.getAlignment());
+    return (int64_t)covered.storageSize() * elementSize;
+}
+
 TilingDims TilingOptimizerBase::findBestTilingDims(
         const TensorShape& shape,
         int maxTileSize,
@@ -1,6 +1,8 @@
 #ifndef _OPERATORS_SMV_SMV_TILING_BASE_H_
 #define _OPERATORS_SMV_SMV_TILING_BASE_H_
 
+#include <algorithm>
+
 #include "smaug/core/backend.h"
 #include "smaug/core/tensor.h"
 #include "smaug/operators/smv/smv_tiling_common.h"
@@ -9,8 +11,61 @@ namespace smaug {
 namespace smv {
 
 class TilingOptimizerBase {
+   public:
+    /**
+     * Returns the number of tiles needed to cover a dimension of the given
+     * size with tiles of the given size, where consecutive tiles overlap by
+     * halo elements (e.g. the rows shared by neighboring convolution windows).
+     */
+    static int computeNumTiles(int size, int tileSize, int halo = 0);
+
    protected:
 
+    /**
+     * Returns the bytes read or written by visiting every tile of a tensor
+     * once. This exceeds the size of the tensor by the overlapping halos.
+     *
+     * @param shape Tensor shape.
+     * @param tileShape Basic tile shape.
+     * @param halos The overlap between consecutive tiles in each dimension.
+     * @param elementSize The size of each element in bytes.
+     */
+    static int64_t computeSweepBytes(const TensorShape& shape,
+                                     const TensorShape& tileShape,
+                                     const std::vector<int>& halos,
+                                     int elementSize);
+
+    /**
+     * Picks the best of the candidate TilingConfigs according to the current
+     * tilingObjective.
+     *
+     * @param configs The candidate configs. Must not be empty.
+     * @param estimateCost A callable that returns the TilingCost of a config.
+     * @returns An iterator to the chosen config.
+     */
+    template <typename Container, typename CostFunc>
+    static typename Container::iterator chooseBestConfig(
+            Container& configs, CostFunc estimateCost) {
+        if (tilingObjective == MinDataMovement) {
+            auto bestIt = configs.end();
+            TilingCost bestCost;
+            for (auto it = configs.begin(); it != configs.end(); ++it) {
+                TilingCost cost = estimateCost(*it);
+                if (bestIt == configs.end() || cost < bestCost) {
+                    bestIt = it;
+                    bestCost = cost;
+                }
+            }
+            return bestIt;
+        }
+        return std::max_element(
+                configs.begin(),
+                configs.end(),
+                [](const TilingConfig& c1, const TilingConfig& c2) {
+                    return c1.getTotalSize() < c2.getTotalSize();
+                });
+    }
+
     /**
      * Find the best set of dimensions to tile a given tensor shape.
      *
@@ -4,6 +4,8 @@
 namespace smaug {
 namespace smv {
 
+TilingObjective tilingObjective = MaxSpadUtilization;
+
 std::ostream& operator<<(std::ostream& os, const TilingDims& dims) {
   switch (dims) {
       case None:
@@ -45,6 +47,13 @@ std::ostream& operator<<(std::ostream& os, const TilingConfig& config) {
     return os;
 }
 
+std::ostream& operator<<(std::ostream& os, const TilingCost& cost) {
+    os << "DMA bytes: " << cost.getTotalBytes() << " (inputs "
+       << cost.inputBytes << ", weights " << cost.weightBytes << ", outputs "
+       << cost.outputBytes << "), invocations: " << cost.invocations;
+    return os;
+}
+
 // N means batch for inputs/outputs, whereas this can mean ofmap for convolution
 // weights, or neuron for inner product weights.
 bool needsNwiseTiling(TilingDims dim) {
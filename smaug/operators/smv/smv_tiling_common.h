@@ -24,7 +24,11 @@ enum TilingDims {
 
 /**
  * A TilingConfig describes tiling strategies and optimal tile sizes for inputs,
- * weights, and outputs Tensors. 
+ * weights, and outputs Tensors.
+ *
+ * The enumTilingConfigs() of every SMV tiling optimizer returns all the
+ * candidate TilingConfigs of a layer, with their tiling dims filled in, and
+ * its computeBasicTileShapes() picks one of them by the tilingObjective.
  */
 struct TilingConfig {
   public:
@@ -46,8 +50,48 @@ struct TilingConfig {
     TilingDims outputTilingDims;
 };
 
+/**
+ * The estimated cost of running an operator with a TilingConfig: the bytes
+ * moved between the host and the scratchpads, and the number of accelerator
+ * invocations. These are derived from the operator's tile loop nest and the
+ * data reuse it exploits across consecutive invocations, assuming that a
+ * single accelerator runs all the tiles.
+ */
+struct TilingCost {
+    TilingCost()
+            : inputBytes(0), weightBytes(0), outputBytes(0), invocations(0) {}
+
+    int64_t getTotalBytes() const {
+        return inputBytes + weightBytes + outputBytes;
+    }
+
+    /** Orders costs by data movement first, then by invocations. */
+    bool operator<(const TilingCost& other) const {
+        if (getTotalBytes() != other.getTotalBytes())
+            return getTotalBytes() < other.getTotalBytes();
+        return invocations < other.invocations;
+    }
+
+    int64_t inputBytes;
+    int64_t weightBytes;
+    int64_t outputBytes;
+    int64_t invocations;
+};
+
+/** The criterion the tiling optimizers use to pick among TilingConfigs. */
+enum TilingObjective {
+    /** Maximize the combined size of the tiles (TilingConfig::getTotalSize). */
+    MaxSpadUtilization,
+    /** Minimize the estimated TilingCost. */
+    MinDataMovement,
+};
+
+/** The tiling objective used by all SMV tiling optimizers. */
+extern TilingObjective tilingObjective;
+
 std::ostream& operator<<(std::ostream& os, const TilingDims& dims);
 std::ostream& operator<<(std::ostream& os, const TilingConfig& config);
+std::ostream& operator<<(std::ostream& os, const TilingCost& cost);
 
 bool needsNwiseTiling(TilingDims dim);
 
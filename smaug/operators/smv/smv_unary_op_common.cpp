@@ -57,6 +57,11 @@ void runX(UnaryOp<SmvBackend>* op, TiledTensor& inputs, TiledTensor& outputs) {
             smv::kEltwiseOpHw, "host_inputs", op->getInputsMemType());
     setArrayMemTypeIfSimulating(
             smv::kEltwiseOpHw, "host_results", op->getOutputsMemType());
+    bool pipelineCopies = shouldPipelineTileCopies();
+    if (pipelineCopies) {
+        for (int i = 0; i < inputs.size(); i++)
+            inputs.prefetchTile(i);
+    }
     for (int i = 0; i < inputs.size(); i++) {
         dout(1) << "Input: " << i << ", output: " << i << "\n";
         Tensor* inputTile = inputs.getTileWithData(i);
@@ -74,6 +79,8 @@ void runX(UnaryOp<SmvBackend>* op, TiledTensor& inputs, TiledTensor& outputs) {
                      inputTile->data<float16>(), outputTile->data<float16>(),
                      smv::spad0, smv::spad1, inputShape.storageSize(),
                      actParams.first, actParams.second);
+        if (pipelineCopies)
+            outputs.gatherTile(i);
     }
 }
 
@@ -98,7 +105,10 @@ void run(UnaryOp<SmvBackend>* op, std::array<TiledTensor, 2>& tiledTensors) {
     auto inputs = op->getInput(UnaryOp<SmvBackend>::Inputs);
     auto outputs = op->getOutput(UnaryOp<SmvBackend>::Outputs);
 
-    {
+    // When the tile copies are pipelined, runX() prefetches the input tiles
+    // and copies every output tile back as soon as it's computed.
+    bool pipelineCopies = shouldPipelineTileCopies();
+    if (!pipelineCopies) {
         auto stats = gem5::ScopedStats(
                 stats::kTensorPrepStart, stats::kTensorPrepEnd);
         tiledTensors[0].copyDataToAllTiles();
@@ -106,7 +116,7 @@ void run(UnaryOp<SmvBackend>* op, std::array<TiledTensor, 2>& tiledTensors) {
 
     runX(op, tiledTensors[0], tiledTensors[1]);
 
-    {
+    if (!pipelineCopies) {
         auto stats = gem5::ScopedStats(
                 stats::kTensorFinalStart, stats::kTensorFinalEnd);
         flattenTiledTensor(tiledTensors[1], outputs);
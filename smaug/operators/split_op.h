@@ -81,7 +81,8 @@ class SplitOp : public Operator {
                              input,
                              std::vector<int>(ndims, 0),
                              srcOrigin,
-                             output->getShape().dims());
+                             output->getShape().dims(),
+                             /* useThreadPool */ true);
             srcOrigin[splitAxis] += output->dim(splitAxis);
         }
     }
@@ -21,6 +21,7 @@ class TanhOp : public UnaryOp<Backend> {
             : UnaryOp<Backend>(name, OpType::Tanh, workspace) {}
 
     void run() override {}
+    bool supportsInPlace() const override { return true; }
 };
 
 /** \ingroup Operators
@@ -41,6 +42,7 @@ class HardTanhOp : public UnaryOp<Backend> {
               max(_max) {}
 
     void run() override {}
+    bool supportsInPlace() const override { return true; }
 
     void setMin(float _min) { min = _min; }
     void setMax(float _max) { max = _max; }
@@ -0,0 +1,149 @@
+#!/usr/bin/env python
+
+"""Reference models for smaug-bench.
+
+This script generates a fixed set of models of different shapes for measuring
+end-to-end performance with the smaug-bench binary:
+
+  cnn: A small CNN of convolutions, batch norms, pooling and FC layers.
+  mobilenet: A MobileNet-like stack of 3x3 and 1x1 convolution blocks with
+    strided downsampling. The Python API has no depthwise convolution, so each
+    separable block is built from a narrow 3x3 convolution followed by a 1x1
+    pointwise convolution.
+  lstm: A two-layer LSTM over a short sequence.
+  attention: A Bahdanau attention layer over a constant memory of 8 timesteps,
+    queried by the output of one step of an LSTM cell, as in seq2seq
+    decoders.
+
+Every model is written as bench_<name>_topo.pbtxt and bench_<name>_params.pb
+into the output directory, and can then be benchmarked with:
+
+  smaug-bench bench_<name>_topo.pbtxt bench_<name>_params.pb --num-threads 0,4
+"""
+
+import os
+import argparse
+import numpy as np
+import smaug as sg
+from smaug.python import global_vars
+
+def rand(shape, dtype):
+  # Small values keep every activation function in its useful range.
+  return (np.random.rand(*shape).astype(dtype) - 0.5) * 0.2
+
+def weights(shape, dtype, layout=sg.NCHW):
+  return sg.Tensor(data_layout=layout, tensor_data=rand(shape, dtype))
+
+def bn_params(channels, dtype):
+  return [weights((1, channels), dtype, sg.NC) for _ in range(4)]
+
+def create_cnn_model(backend, dtype):
+  with sg.Graph(name="bench_cnn", backend=backend) as graph:
+    out = sg.input_data(weights((1, 3, 32, 32), dtype))
+    out = sg.nn.convolution(
+        out, weights((32, 3, 3, 3), dtype), stride=[1, 1], padding="same",
+        activation="relu")
+    out = sg.nn.batch_norm(out, *bn_params(32, dtype))
+    out = sg.nn.max_pool(out, pool_size=[2, 2], stride=[2, 2])
+    out = sg.nn.convolution(
+        out, weights((64, 32, 3, 3), dtype), stride=[1, 1], padding="same",
+        activation="relu")
+    out = sg.nn.batch_norm(out, *bn_params(64, dtype))
+    out = sg.nn.max_pool(out, pool_size=[2, 2], stride=[2, 2])
+    out = sg.tensor.flatten(out)
+    out = sg.nn.mat_mul(
+        out, weights((256, 4096), dtype, sg.NC), activation="relu")
+    out = sg.nn.mat_mul(out, weights((10, 256), dtype, sg.NC))
+    return graph
+
+def create_mobilenet_model(backend, dtype):
+  # (output channels, stride) of each separable block.
+  blocks = [(64, 1), (128, 2), (128, 1), (256, 2), (256, 1), (512, 2)]
+  with sg.Graph(name="bench_mobilenet", backend=backend) as graph:
+    out = sg.input_data(weights((1, 3, 64, 64), dtype))
+    out = sg.nn.convolution(
+        out, weights((32, 3, 3, 3), dtype), stride=[2, 2], padding="same")
+    out = sg.nn.batch_norm(out, *bn_params(32, dtype), activation="relu")
+    channels = 32
+    for filters, stride in blocks:
+      # Spatial filtering, kept narrow to stand in for a depthwise convolution.
+      out = sg.nn.convolution(
+          out, weights((8, channels, 3, 3), dtype), stride=[stride, stride],
+          padding="same")
+      out = sg.nn.batch_norm(out, *bn_params(8, dtype), activation="relu")
+      # Pointwise channel mixing.
+      out = sg.nn.convolution(
+          out, weights((filters, 8, 1, 1), dtype), stride=[1, 1],
+          padding="same")
+      out = sg.nn.batch_norm(out, *bn_params(filters, dtype), activation="relu")
+      channels = filters
+    out = sg.nn.max_pool(out, pool_size=[4, 4], stride=[4, 4])
+    out = sg.tensor.flatten(out)
+    out = sg.nn.mat_mul(out, weights((100, channels), dtype, sg.NC))
+    return graph
+
+def create_lstm_model(backend, dtype):
+  timesteps, depth, units = 8, 64, 128
+  with sg.Graph(name="bench_lstm", backend=backend) as graph:
+    inputs = sg.input_data(
+        sg.Tensor(
+            data_layout=sg.NTC, tensor_data=rand((1, timesteps, depth),
+                                                 dtype)))
+    lstm0 = sg.nn.LSTM([
+        weights((4 * units, depth), dtype, sg.NC),
+        weights((4 * units, units), dtype, sg.NC)
+    ], name="lstm0")
+    lstm1 = sg.nn.LSTM([
+        weights((4 * units, units), dtype, sg.NC),
+        weights((4 * units, units), dtype, sg.NC)
+    ], name="lstm1")
+    outputs, _ = lstm0(inputs)
+    outputs, _ = lstm1(outputs)
+    return graph
+
+def create_attention_model(backend, dtype):
+  timesteps, units = 8, 64
+  with sg.Graph(name="bench_attention", backend=backend) as graph:
+    memory = sg.Tensor(
+        data_layout=sg.NTC, tensor_data=rand((1, timesteps, units), dtype))
+    query = sg.input_data(
+        sg.Tensor(data_layout=sg.NC, tensor_data=rand((1, units), dtype)))
+    encoder = sg.nn.LSTM([
+        weights((4 * units, units), dtype, sg.NC),
+        weights((4 * units, units), dtype, sg.NC)
+    ], name="encoder")
+    attention = sg.nn.BahdanauAttention(
+        memory, weights((units, units), dtype, sg.NC),
+        weights((units, units), dtype, sg.NC),
+        weights((1, units), dtype, sg.NC))
+    cell_out, _ = encoder.step(query, timestep=0)
+    attention(cell_out)
+    return graph
+
+models = {
+    "cnn": create_cnn_model,
+    "mobilenet": create_mobilenet_model,
+    "lstm": create_lstm_model,
+    "attention": create_attention_model,
+}
+
+def main():
+  parser = argparse.ArgumentParser(
+      description="Generate the reference models used by smaug-bench.")
+  parser.add_argument(
+      "--backend", default="Reference", choices=["Reference", "SMV"])
+  parser.add_argument("--output-dir", default=".")
+  parser.add_argument(
+      "--models", nargs="+", default=list(models.keys()),
+      choices=list(models.keys()))
+  args = parser.parse_args()
+
+  dtype = global_vars.backend_datatype[args.backend]
+  os.makedirs(args.output_dir, exist_ok=True)
+  for name in args.models:
+    graph = models[name](args.backend, dtype)
+    graph.print_summary()
+    graph.write_graph(os.path.join(args.output_dir, "bench_" + name))
+
+if __name__ == "__main__":
+  main()
@@ -1,13 +1,23 @@
+#include <chrono>
 #include <fstream>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <boost/program_options.hpp>
 
 #include "core/backend.h"
 #include "core/globals.h"
 #include "core/scheduler.h"
+#include "core/inference_server.h"
 #include "core/network_builder.h"
+#include "core/network_image.h"
+#include "core/pipeline_scheduler.h"
+#include "core/roofline.h"
+#include "core/scheduling_policy.h"
 #include "operators/common.h"
+#include "operators/smv/kernels/kernel_dispatch.h"
+#include "operators/smv/smv_tiling_common.h"
 #include "utility/debug_stream.h"
 #include "utility/utils.h"
 #include "utility/thread_pool.h"
@@ -28,12 +38,32 @@ int main(int argc, char* argv[]) {
     sampling.num_sample_iterations = 1;
     numAcceleratorsAvailable = 1;
     int numThreads = -1;
+    ThreadPool::Options poolOptions;
+    std::vector<int> spadSizesKB;
     useSystolicArrayWhenAvailable = false;
+    bool printRoofline = false;
+    double peakGflops = 0;
+    double peakGbps = 0;
+    std::string tilingObjective = "utilization";
+    std::string schedulingPolicy = "fifo";
+    bool inPlace = false;
+    std::string compiledImage;
+    int pipelineStages = 0;
+    int streamInputs = 1;
+    std::string serveSocket;
+    int numWorkers = 1;
     po::options_description options(
-            "SMAUG Usage:  ./smaug model_topo.pbtxt model_params.pb [options]");
+            "SMAUG Usage:  ./smaug model_topo.pbtxt model_params.pb [options]\n"
+            "              ./smaug network_image [options]");
     // clang-format off
     options.add_options()
         ("help,h", "Display this help message")
+        ("compile", po::value(&compiledImage),
+         "Compile the model protobuf files into a network image at the given "
+         "path and exit. Pass the image to smaug in place of the protobuf "
+         "files to load the model without parsing it or copying its "
+         "weights. The Float32 parameters of SMV models are stored converted "
+         "to Float16.")
         ("debug-level", po::value(&debugLevel)->implicit_value(0),
          "Set the debugging output level. If omitted, all debugging output "
          "is ignored. If specified without a value, the debug level is set "
@@ -67,9 +97,76 @@ int main(int argc, char* argv[]) {
         ("num-threads",
          po::value(&numThreads)->implicit_value(1),
          "Number of threads in the thread pool.")
+        ("thread-spin-us", po::value(&poolOptions.maxSpinMicros),
+         "In native runs, let idle thread pool workers spin for up to this "
+         "many microseconds waiting for work before they sleep, which makes "
+         "short parallel loops cheaper at the cost of busy CPUs.")
+        ("pin-threads",
+         po::value(&poolOptions.pinWorkers)->implicit_value(true),
+         "In native runs, pin every thread pool worker to a CPU of its own.")
+        ("spad-sizes", po::value(&spadSizesKB)->multitoken(),
+         "The scratchpad sizes (in KB) of the SMV accelerators, one value per "
+         "accelerator. A single value applies to all the accelerators. By "
+         "default, every accelerator has 32KB scratchpads.")
         ("use-systolic-array",
          po::value(&useSystolicArrayWhenAvailable)->implicit_value(true),
-         "If the backend contains a systolic array, use it whenever possible.");
+         "If the backend contains a systolic array, use it whenever possible.")
+        ("accel-threads",
+         po::value(&useAcceleratorThreads)->implicit_value(true),
+         "In native runs with more than one accelerator, run every "
+         "accelerator on a host thread of its own, so that independent tiles "
+         "of the SMV operators run concurrently. On by default.")
+        ("pipeline-tile-copies",
+         po::value(&pipelineTileCopies)->implicit_value(true),
+         "In native runs, copy data into the tiles of the SMV operators on a "
+         "helper thread while the kernels run, and copy every output tile "
+         "back as soon as it is final. On by default.")
+        ("tiling-objective", po::value(&tilingObjective),
+         "Set how the SMV tiling optimizers pick among the tile shapes that "
+         "fit in the scratchpads. \"utilization\" (the default) picks the "
+         "largest tiles, and \"data-movement\" picks the tiles with the "
+         "least estimated DMA traffic and the fewest accelerator "
+         "invocations.")
+        ("scheduling-policy", po::value(&schedulingPolicy),
+         "Set the order in which operators that are ready at the same time "
+         "run. \"fifo\" (the default) runs them in the order they became "
+         "ready, and \"critical-path\" runs the operators on the longest "
+         "remaining path of the network first, with costs estimated from "
+         "their FLOP and byte counts and the peaks below.")
+        ("in-place", po::value(&inPlace)->implicit_value(true),
+         "Let activation and elementwise operators write their output over "
+         "an input that no other operator reads, instead of a buffer of their "
+         "own, which saves memory traffic and footprint. Such inputs are not "
+         "available after the network runs.")
+        ("pipeline-stages", po::value(&pipelineStages),
+         "In native runs, cut the network into this many stages of about "
+         "equal cost and run them as a pipeline, each stage on a thread of "
+         "its own, to stream inputs through the network for throughput. "
+         "Only for networks without control flow, on the reference "
+         "backend.")
+        ("stream-inputs", po::value(&streamInputs),
+         "The number of times the input is streamed through the pipeline "
+         "with --pipeline-stages. The throughput is reported at the end.")
+        ("serve", po::value(&serveSocket),
+         "Serve inference requests on this Unix domain socket until "
+         "interrupted, instead of running the network once. The model is "
+         "loaded once and shared by all the worker processes; load it from "
+         "a network image to share its weights through the page cache.")
+        ("num-workers", po::value(&numWorkers),
+         "The number of worker processes that serve inference requests with "
+         "--serve.")
+        ("roofline", po::value(&printRoofline)->implicit_value(true),
+         "Print a per-layer roofline report after the network finishes, "
+         "combining the analytical FLOP and byte counts of every operator "
+         "with its measured run time and data movement.")
+        ("peak-gflops", po::value(&peakGflops),
+         "Peak compute throughput (GFLOP/s) of the target, used by the "
+         "roofline report to classify layers as compute or memory bound, "
+         "and by the critical-path scheduling policy.")
+        ("peak-gbps", po::value(&peakGbps),
+         "Peak memory bandwidth (GB/s) of the target, used by the roofline "
+         "report to classify layers as compute or memory bound, and by the "
+         "critical-path scheduling policy.");
     // clang-format on
 
     po::options_description hidden;
@@ -101,14 +198,25 @@ int main(int argc, char* argv[]) {
         std::cout << visible << "\n";
         return 1;
     }
-    if (modelTopo.empty() || modelParams.empty()) {
+    bool loadImage =
+            modelParams.empty() && compiledImage.empty() &&
+            !modelTopo.empty() && isNetworkImage(modelTopo);
+    if (modelTopo.empty() || (modelParams.empty() && !loadImage)) {
         std::cout << "The model protobuf files must be specified!\n";
         exit(1);
     }
     initDebugStream(debugLevel);
 
-    std::cout << "Model topology file: " << modelTopo << "\n";
-    std::cout << "Model parameters file: " << modelParams << "\n";
+    if (!compiledImage.empty()) {
+        writeNetworkImage(modelTopo, modelParams, compiledImage);
+        return 0;
+    }
+    if (loadImage) {
+        std::cout << "Network image: " << modelTopo << "\n";
+    } else {
+        std::cout << "Model topology file: " << modelTopo << "\n";
+        std::cout << "Model parameters file: " << modelParams << "\n";
+    }
 
     if (samplingLevel == "no") {
         sampling.level = NoSampling;
@@ -131,38 +239,140 @@ int main(int argc, char* argv[]) {
                   << sampling.num_sample_iterations << "\n";
     }
 
+    if (tilingObjective == "utilization") {
+        smv::tilingObjective = smv::MaxSpadUtilization;
+    } else if (tilingObjective == "data-movement") {
+        smv::tilingObjective = smv::MinDataMovement;
+    } else {
+        std::cout << "Doesn't support the specified tiling objective: "
+                  << tilingObjective << "\n";
+        exit(1);
+    }
+
+    std::unique_ptr<SchedulingPolicy> policy;
+    if (schedulingPolicy == "critical-path") {
+        policy.reset(new CriticalPathPolicy(peakGflops, peakGbps));
+    } else if (schedulingPolicy != "fifo") {
+        std::cout << "Doesn't support the specified scheduling policy: "
+                  << schedulingPolicy << "\n";
+        exit(1);
+    }
+
+    if (pipelineStages < 0 || streamInputs < 1) {
+        std::cout << "Invalid number of pipeline stages or stream inputs!\n";
+        exit(1);
+    }
+    if (pipelineStages > 0 && (runningInSimulation || printRoofline)) {
+        std::cout << "Pipelined execution supports neither simulation nor "
+                     "the roofline report!\n";
+        exit(1);
+    }
+
+    if (!serveSocket.empty() &&
+        (numWorkers < 1 || runningInSimulation || pipelineStages > 0 ||
+         printRoofline)) {
+        std::cout << "Serving inference needs at least one worker, and "
+                     "supports neither simulation, pipelined execution nor "
+                     "the roofline report!\n";
+        exit(1);
+    }
+
     if (numAcceleratorsAvailable > maxNumAccelerators) {
         std::cout << "The number of accelerators exceeds the max number!\n";
         exit(1);
     }
     std::cout << "Number of accelerators: " << numAcceleratorsAvailable << "\n";
+    if (smv_kernel_isa)
+        std::cout << "SMV kernel ISA: " << smv_kernel_isa() << "\n";
     if (numAcceleratorsAvailable > 1 && runningInSimulation) {
         std::cout << "SMAUG requires the accelerator IDs (configured in the "
                      "gem5 configuration file) to be monotonically incremented "
                      "by 1.\n";
     }
 
+    if (!spadSizesKB.empty() && spadSizesKB.size() != 1 &&
+        spadSizesKB.size() != (size_t)numAcceleratorsAvailable) {
+        std::cout << "Expected one scratchpad size per accelerator!\n";
+        exit(1);
+    }
+    for (int size : spadSizesKB) {
+        if (size <= 0) {
+            std::cout << "Invalid scratchpad size: " << size << "\n";
+            exit(1);
+        }
+    }
+
     if (numThreads != -1) {
         std::cout << "Using a thread pool, size: " << numThreads << ".\n";
-        threadPool = new ThreadPool(numThreads);
+        // Spinning would only waste simulation time.
+        if (runningInSimulation)
+            poolOptions.maxSpinMicros = 0;
+        threadPool = new ThreadPool(numThreads, poolOptions);
     }
 
     Workspace* workspace = new Workspace();
     Network* network =
-            buildNetwork(modelTopo, modelParams, sampling, workspace);
+            loadImage ? loadNetworkImage(modelTopo, sampling, workspace)
+                      : buildNetwork(modelTopo, modelParams, sampling,
+                                     workspace);
     ReferenceBackend::initGlobals();
     SmvBackend::initGlobals();
+    for (int i = 0; i < numAcceleratorsAvailable && !spadSizesKB.empty(); i++) {
+        int sizeKB = spadSizesKB.size() == 1 ? spadSizesKB[0] : spadSizesKB[i];
+        SmvBackend::setSpadSize(i, sizeKB * 1024);
+    }
 
     if (dumpGraph)
         network->dumpDataflowGraph();
 
     if (!network->validate())
         return -1;
+    if (pipelineStages > 0 && !PipelineScheduler::supportsNetwork(network)) {
+        std::cout << "Pipelined execution does not support the "
+                  << network->getBackend() << " backend!\n";
+        exit(1);
+    }
 
     Scheduler scheduler(network, workspace);
-    Tensor* output = scheduler.runNetwork();
+    scheduler.setPolicy(policy.get());
+    scheduler.setInPlace(inPlace);
+    RooflineProfiler* profiler = nullptr;
+    if (printRoofline) {
+        profiler = new RooflineProfiler(peakGflops, peakGbps);
+        scheduler.setProfiler(profiler);
+    }
+    Tensor* output = nullptr;
+    if (!serveSocket.empty()) {
+        InferenceServer server(&scheduler, workspace, serveSocket, numWorkers);
+        server.run();
+    } else if (pipelineStages > 0) {
+        PipelineScheduler pipeline(network, workspace, pipelineStages);
+        pipeline.setInPlace(inPlace);
+        if (schedulingPolicy == "critical-path")
+            pipeline.setCostModel(
+                    static_cast<CriticalPathPolicy*>(policy.get()));
+        pipeline.compileStages(std::vector<Tensor*>());
+        auto start = std::chrono::steady_clock::now();
+        pipeline.runStream(streamInputs, PipelineScheduler::FeedFunc(),
+                           [&](int input, Tensor* streamOutput) {
+                               output = streamOutput;
+                           });
+        std::chrono::duration<double> elapsed =
+                std::chrono::steady_clock::now() - start;
+        std::cout << "Streamed " << streamInputs << " inputs through "
+                  << pipeline.getNumStages() << " stages in "
+                  << elapsed.count() << " s ("
+                  << streamInputs / elapsed.count() << " inputs/s).\n";
+    } else {
+        output = scheduler.runNetwork();
+    }
+
+    if (profiler) {
+        profiler->printReport(std::cout);
+        delete profiler;
+    }
 
-    if (!lastOutputFile.empty()) {
+    if (!lastOutputFile.empty() && output) {
         if (lastOutputFile == "stdout") {
             std::cout << "Final network output:\n" << *output << "\n";
         } else if (lastOutputFile == "proto") {
@@ -0,0 +1,395 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+
+#include "core/backend.h"
+#include "core/globals.h"
+#include "core/scheduler.h"
+#include "core/network_builder.h"
+#include "operators/common.h"
+#include "utility/debug_stream.h"
+#include "utility/utils.h"
+#include "utility/thread_pool.h"
+
+namespace po = boost::program_options;
+
+using namespace smaug;
+
+namespace {
+
+typedef std::chrono::steady_clock Clock;
+
+double elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+}
+
+/** Splits a comma-separated option value. */
+std::vector<std::string> splitList(const std::string& list) {
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, ','))
+        items.push_back(item);
+    return items;
+}
+
+std::vector<int> splitIntList(const std::string& list) {
+    std::vector<int> values;
+    for (auto& item : splitList(list))
+        values.push_back(std::stoi(item));
+    return values;
+}
+
+bool parseSamplingLevel(const std::string& name, SamplingLevel& level) {
+    if (name == "no")
+        level = NoSampling;
+    else if (name == "low")
+        level = Low;
+    else if (name == "medium")
+        level = Medium;
+    else if (name == "high")
+        level = High;
+    else if (name == "very_high")
+        level = VeryHigh;
+    else
+        return false;
+    return true;
+}
+
+/** Returns the p-th percentile of the sorted samples, by nearest rank. */
+double percentile(const std::vector<double>& sorted, double p) {
+    int rank = std::ceil(p / 100 * sorted.size());
+    return sorted[std::max(rank, 1) - 1];
+}
+
+double mean(const std::vector<double>& samples) {
+    double sum = 0;
+    for (double sample : samples)
+        sum += sample;
+    return sum / samples.size();
+}
+
+/** Peak resident set size of this process so far, in MB. */
+double peakRssMb() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+/**
+ * Runs func in a child process and returns the string it produces, or an
+ * empty string if the child fails. A child starts with the memory of this
+ * process at the fork, so its peak RSS covers the loaded model and whatever
+ * func allocates, and none of what the earlier children allocated.
+ */
+std::string runInChild(const std::function<std::string()>& func) {
+    int fds[2];
+    if (pipe(fds) != 0)
+        return "";
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return "";
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        std::string result = func();
+        const char* data = result.data();
+        size_t remaining = result.size();
+        while (remaining > 0) {
+            ssize_t written = write(fds[1], data, remaining);
+            if (written <= 0)
+                _exit(1);
+            data += written;
+            remaining -= written;
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    std::string result;
+    char buffer[256];
+    ssize_t bytes;
+    while ((bytes = read(fds[0], buffer, sizeof(buffer))) > 0)
+        result.append(buffer, bytes);
+    close(fds[0]);
+    int status;
+    waitpid(pid, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        return "";
+    return result;
+}
+
+/**
+ * Discards everything written to std::cout while in scope, so the progress
+ * banners printed by the Scheduler don't end up in the timed region.
+ */
+class QuietStdout {
+   public:
+    QuietStdout(bool enabled) : saved(nullptr) {
+        if (enabled)
+            saved = std::cout.rdbuf(nullptr);
+    }
+    ~QuietStdout() {
+        if (saved)
+            std::cout.rdbuf(saved);
+    }
+
+   protected:
+    std::streambuf* saved;
+};
+
+/** Replaces the global thread pool with one of the given size. */
+void resizeThreadPool(int numThreads,
+                      const ThreadPool::Options& poolOptions) {
+    if (threadPool && threadPool->size() == numThreads)
+        return;
+    delete threadPool;
+    threadPool = nullptr;
+    if (numThreads <= 0)
+        return;
+    threadPool = new ThreadPool(numThreads, poolOptions);
+    // Before the first run, the Scheduler starts the pool itself once fast
+    // forwarding ends.
+    if (!fastForwardMode)
+        threadPool->initThreadPool();
+}
+
+void setSampling(Network* network, const SamplingInfo& sampling) {
+    network->setSamplingInfo(sampling);
+    for (auto nameOp : network->getOperators()) {
+        Operator* op = nameOp.second;
+        if (op->isSamplingSupported())
+            op->setSamplingInfo(sampling);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string modelTopo;
+    std::string modelParams;
+    int debugLevel = -1;
+    int warmup = 3;
+    int iterations = 20;
+    std::string threadsList = "0";
+    std::string accelsList = "1";
+    std::string samplingList = "no";
+    int sampleNum = 1;
+    bool verbose = false;
+    ThreadPool::Options poolOptions;
+    runningInSimulation = false;
+    useSystolicArrayWhenAvailable = false;
+    po::options_description options(
+            "SMAUG benchmark usage:  ./smaug-bench model_topo.pbtxt "
+            "model_params.pb [options]\n\n"
+            "Loads the model once and runs it repeatedly on the host, "
+            "reporting the latency distribution, throughput, peak memory and "
+            "the time spent loading, tiling and running the network. The "
+            "list-valued options take comma-separated values, and every "
+            "combination of them is benchmarked in a process of its own");
+    // clang-format off
+    options.add_options()
+        ("help,h", "Display this help message")
+        ("debug-level", po::value(&debugLevel)->implicit_value(0),
+         "Set the debugging output level. If omitted, all debugging output "
+         "is ignored. If specified without a value, the debug level is set "
+         "to zero.")
+        ("warmup", po::value(&warmup),
+         "Number of untimed runs before measuring each configuration.")
+        ("iterations,n", po::value(&iterations),
+         "Number of timed runs of each configuration.")
+        ("num-threads", po::value(&threadsList),
+         "List of thread pool sizes. Zero runs without a thread pool.")
+        ("thread-spin-us", po::value(&poolOptions.maxSpinMicros),
+         "Let idle thread pool workers spin for up to this many microseconds "
+         "waiting for work before they sleep, which makes short parallel "
+         "loops cheaper at the cost of busy CPUs.")
+        ("pin-threads",
+         po::value(&poolOptions.pinWorkers)->implicit_value(true),
+         "Pin every thread pool worker to a CPU of its own.")
+        ("num-accels", po::value(&accelsList),
+         "List of numbers of accelerators the backend has.")
+        ("sample-level", po::value(&samplingList),
+         "List of sampling levels, out of no, low, medium, high and "
+         "very_high.")
+        ("sample-num", po::value(&sampleNum),
+         "The number of sample iterations used by every sampling enabled "
+         "entity.")
+        ("use-systolic-array",
+         po::value(&useSystolicArrayWhenAvailable)->implicit_value(true),
+         "If the backend contains a systolic array, use it whenever possible.")
+        ("accel-threads",
+         po::value(&useAcceleratorThreads)->implicit_value(true),
+         "In native runs with more than one accelerator, run every "
+         "accelerator on a host thread of its own, so that independent tiles "
+         "of the SMV operators run concurrently. On by default.")
+        ("pipeline-tile-copies",
+         po::value(&pipelineTileCopies)->implicit_value(true),
+         "In native runs, copy data into the tiles of the SMV operators on a "
+         "helper thread while the kernels run, and copy every output tile "
+         "back as soon as it is final. On by default.")
+        ("verbose,v", po::value(&verbose)->implicit_value(true),
+         "Keep the Scheduler's progress output during the runs.");
+    // clang-format on
+
+    po::options_description hidden;
+    hidden.add_options()("model-topo-file", po::value(&modelTopo),
+                         "Model topology protobuf file");
+    hidden.add_options()("model-params-file", po::value(&modelParams),
+                         "Model parameters protobuf file");
+    po::options_description all, visible;
+    all.add(options).add(hidden);
+    visible.add(options);
+
+    po::positional_options_description p;
+    p.add("model-topo-file", 1);
+    p.add("model-params-file", 1);
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv)
+                          .options(all)
+                          .positional(p)
+                          .run(),
+                  vm);
+        po::notify(vm);
+    } catch (po::error& e) {
+        std::cout << "ERROR: " << e.what() << "\n";
+        exit(1);
+    }
+
+    if (vm.count("help")) {
+        std::cout << visible << "\n";
+        return 1;
+    }
+    if (modelTopo.empty() || modelParams.empty()) {
+        std::cout << "The model protobuf files must be specified!\n";
+        exit(1);
+    }
+    if (iterations < 1 || warmup < 0) {
+        std::cout << "At least one timed iteration is required!\n";
+        exit(1);
+    }
+    initDebugStream(debugLevel);
+
+    std::vector<int> threadCounts = splitIntList(threadsList);
+    std::vector<int> accelCounts = splitIntList(accelsList);
+    std::vector<std::string> samplingLevels = splitList(samplingList);
+    for (int accels : accelCounts) {
+        if (accels < 1 || accels > maxNumAccelerators) {
+            std::cout << "Invalid number of accelerators: " << accels << "\n";
+            exit(1);
+        }
+    }
+    for (auto& level : samplingLevels) {
+        SamplingLevel unused;
+        if (!parseSamplingLevel(level, unused)) {
+            std::cout << "Doesn't support the specified sampling option: "
+                      << level << "\n";
+            exit(1);
+        }
+    }
+
+    std::cout << "Model topology file: " << modelTopo << "\n";
+    std::cout << "Model parameters file: " << modelParams << "\n";
+
+    // The network is built once; every configuration reuses it.
+    SamplingInfo sampling;
+    sampling.level = NoSampling;
+    sampling.num_sample_iterations = sampleNum;
+    numAcceleratorsAvailable = accelCounts.front();
+    auto loadStart = Clock::now();
+    Workspace* workspace = new Workspace();
+    Network* network =
+            buildNetwork(modelTopo, modelParams, sampling, workspace);
+    ReferenceBackend::initGlobals();
+    SmvBackend::initGlobals();
+    double loadMs = elapsedMs(loadStart);
+    if (!network->validate())
+        return -1;
+    Scheduler scheduler(network, workspace);
+
+    static const char* kHeaderFormat =
+            "%7s %6s %9s %10s %10s %10s %10s %10s %10s %11s %14s\n";
+    static const char* kRowFormat =
+            "%7d %6d %9s %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f %11.2f "
+            "%14.1f\n";
+    std::vector<std::string> rows;
+    for (int threads : threadCounts) {
+        for (int accels : accelCounts) {
+            for (auto& level : samplingLevels) {
+                // Every configuration runs in a child process of its own, with
+                // its own thread pool, so that its peak RSS is its own.
+                std::string row = runInChild([&]() {
+                    numAcceleratorsAvailable = accels;
+                    resizeThreadPool(threads, poolOptions);
+                    parseSamplingLevel(level, sampling.level);
+                    setSampling(network, sampling);
+
+                    std::vector<double> tileMs, runMs, totalMs;
+                    for (int i = 0; i < warmup + iterations; i++) {
+                        QuietStdout quiet(!verbose);
+                        auto tileStart = Clock::now();
+                        scheduler.tileNetwork();
+                        double tile = elapsedMs(tileStart);
+                        auto runStart = Clock::now();
+                        scheduler.executeNetwork();
+                        double run = elapsedMs(runStart);
+                        if (i < warmup)
+                            continue;
+                        tileMs.push_back(tile);
+                        runMs.push_back(run);
+                        totalMs.push_back(tile + run);
+                    }
+                    std::sort(totalMs.begin(), totalMs.end());
+                    double meanMs = mean(totalMs);
+                    return (boost::format(kRowFormat) % threads % accels %
+                            level % percentile(totalMs, 50) %
+                            percentile(totalMs, 90) % percentile(totalMs, 99) %
+                            meanMs % mean(tileMs) % mean(runMs) %
+                            (1e3 / meanMs) % peakRssMb())
+                            .str();
+                });
+                if (row.empty()) {
+                    row = (boost::format("%7d %6d %9s  failed\n") % threads %
+                           accels % level)
+                                  .str();
+                }
+                rows.push_back(row);
+            }
+        }
+    }
+
+    std::cout << "======================================================\n";
+    std::cout << "      Benchmark results (" << iterations << " runs, "
+              << warmup << " warmup)\n";
+    std::cout << "======================================================\n";
+    std::cout << boost::format("Load: %.3f ms\n") % loadMs;
+    std::cout << boost::format(kHeaderFormat) % "Threads" % "Accels" %
+                         "Sampling" % "p50 (ms)" % "p90 (ms)" % "p99 (ms)" %
+                         "Mean (ms)" % "Tile (ms)" % "Run (ms)" % "Inf/s" %
+                         "Peak RSS (MB)";
+    for (auto& row : rows)
+        std::cout << row;
+
+    delete threadPool;
+    threadPool = nullptr;
+    delete network;
+    delete workspace;
+    ReferenceBackend::freeGlobals();
+    SmvBackend::freeGlobals();
+
+    return 0;
+}
@@ -0,0 +1,497 @@
+#include <algorithm>
+#include <functional>
+#include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/format.hpp>
+#include <boost/program_options.hpp>
+
+#include "core/backend.h"
+#include "core/globals.h"
+#include "core/network.h"
+#include "core/network_builder.h"
+#include "core/tensor_utils.h"
+#include "operators/smv/smv_batch_norm_op.h"
+#include "operators/smv/smv_batch_norm_tiling.h"
+#include "operators/smv/smv_convolution_op.h"
+#include "operators/smv/smv_convolution_tiling.h"
+#include "operators/smv/smv_inner_product_op.h"
+#include "operators/smv/smv_inner_product_tiling.h"
+#include "operators/smv/smv_pooling_op.h"
+#include "operators/smv/smv_pooling_tiling.h"
+#include "operators/smv/smv_tiling_common.h"
+#include "utility/debug_stream.h"
+
+namespace po = boost::program_options;
+
+using namespace smaug;
+using namespace smaug::smv;
+
+namespace {
+
+/** A candidate TilingConfig along with everything we report about it. */
+struct Candidate {
+    TilingConfig config;
+    TilingCost cost;
+    int inputTiles;
+    int weightTiles;
+    int outputTiles;
+    double utilization;
+};
+
+std::vector<std::string> split(const std::string& str, char delim) {
+    std::vector<std::string> items;
+    std::stringstream stream(str);
+    std::string item;
+    while (std::getline(stream, item, delim))
+        items.push_back(item);
+    return items;
+}
+
+/** Parses a positive integer. Returns false if str is not one. */
+bool parsePositive(const std::string& str, int* value) {
+    try {
+        size_t end;
+        *value = std::stoi(str, &end);
+        return end == str.size() && *value > 0;
+    } catch (const std::invalid_argument&) {
+        return false;
+    } catch (const std::out_of_range&) {
+        return false;
+    }
+}
+
+/**
+ * Parses dimensions written as e.g. 1x32x32x8. Returns an empty list if any
+ * dimension is not a positive integer.
+ */
+std::vector<int> parseDims(const std::string& str) {
+    std::vector<int> dims;
+    for (auto& dim : split(str, 'x')) {
+        int value;
+        if (!parsePositive(dim, &value))
+            return std::vector<int>();
+        dims.push_back(value);
+    }
+    return dims;
+}
+
+std::string dimsString(const TensorShape& shape) {
+    if (shape.ndims() == 0)
+        return "-";
+    std::string str;
+    for (int i = 0; i < shape.ndims(); i++)
+        str += (i ? "x" : "") + std::to_string(shape[i]);
+    return str;
+}
+
+/**
+ * Returns the number of tiles of a tensor, where consecutive tiles overlap by
+ * the given halos.
+ */
+int countTiles(const TensorShape& shape,
+               const TensorShape& tileShape,
+               const std::vector<int>& halos) {
+    if (tileShape.ndims() == 0)
+        return 0;
+    int numTiles = 1;
+    for (int i = 0; i < shape.ndims(); i++) {
+        numTiles *= TilingOptimizerBase::computeNumTiles(
+                shape[i], tileShape[i], halos[i]);
+    }
+    return numTiles;
+}
+
+/** Allocates float16 storage for every tensor of the operator. */
+void allocateTensors(Operator* op) {
+    for (auto t : op->getInputs()) {
+        Tensor* tensor = static_cast<Tensor*>(t);
+        if (!tensor->containsData())
+            tensor->allocateStorage<float16>();
+    }
+    for (auto t : op->getOutputs())
+        static_cast<Tensor*>(t)->allocateStorage<float16>();
+}
+
+Tensor* createInput(Workspace* workspace,
+                    const std::string& name,
+                    const std::vector<int>& dims) {
+    DataLayout layout = dims.size() == 4 ? DataLayout::NHWC : DataLayout::NC;
+    Tensor* input = new Tensor(
+            name + "/input", TensorShape(dims, layout, SmvBackend::Alignment));
+    input->allocateStorage<float16>();
+    workspace->addTensor(input);
+    return input;
+}
+
+/**
+ * Creates an SMV operator from a layer spec of one of these forms:
+ *
+ *   conv:NxHxWxC:RxSxK[:stride[:same|valid]]
+ *   fc:NxA:K
+ *   pool:NxHxWxC:RxS[:stride]
+ *   bn:NxHxWxC or bn:NxA
+ *
+ * Returns nullptr if the spec is malformed.
+ */
+Operator* createLayer(const std::string& spec,
+                      const std::string& name,
+                      Workspace* workspace) {
+    std::vector<std::string> fields = split(spec, ':');
+    if (fields.size() < 2)
+        return nullptr;
+    std::vector<int> inputDims = parseDims(fields[1]);
+    const std::string& type = fields[0];
+    Operator* op = nullptr;
+    if (type == "conv" && fields.size() >= 3 && inputDims.size() == 4) {
+        std::vector<int> kernel = parseDims(fields[2]);
+        int stride = 1;
+        if (kernel.size() != 3 ||
+            (fields.size() >= 4 && !parsePositive(fields[3], &stride)))
+            return nullptr;
+        bool valid = fields.size() >= 5 && fields[4] == "valid";
+        auto convOp = new SmvConvolutionOp(name, workspace);
+        convOp->setInput(createInput(workspace, name, inputDims), 0);
+        convOp->setWeightDims(kernel[0], kernel[1], kernel[2]);
+        convOp->setStride(stride, stride);
+        convOp->setPadding(valid ? ValidPadding : SamePadding);
+        op = convOp;
+    } else if (type == "fc" && fields.size() == 3 && inputDims.size() == 2) {
+        int numOutputs;
+        if (!parsePositive(fields[2], &numOutputs))
+            return nullptr;
+        auto fcOp = new SmvInnerProductOp(name, workspace);
+        fcOp->setInput(createInput(workspace, name, inputDims), 0);
+        fcOp->setNumOutputs(numOutputs);
+        op = fcOp;
+    } else if (type == "pool" && fields.size() >= 3 && inputDims.size() == 4) {
+        std::vector<int> pool = parseDims(fields[2]);
+        int stride = pool.empty() ? 0 : pool[0];
+        if (pool.size() != 2 ||
+            (fields.size() >= 4 && !parsePositive(fields[3], &stride)))
+            return nullptr;
+        // Max and average pooling are tiled the same way.
+        auto poolOp = new SmvMaxPoolingOp(name, workspace);
+        poolOp->setInput(createInput(workspace, name, inputDims), 0);
+        poolOp->setPoolingSize(pool[0], pool[1]);
+        poolOp->setPoolingStride(stride, stride);
+        op = poolOp;
+    } else if (type == "bn" && fields.size() == 2 &&
+               (inputDims.size() == 4 || inputDims.size() == 2)) {
+        auto bnOp = new SmvBatchNormOp(name, workspace);
+        bnOp->setInput(createInput(workspace, name, inputDims), 0);
+        op = bnOp;
+    } else {
+        return nullptr;
+    }
+    op->createAllTensors();
+    allocateTensors(op);
+    return op;
+}
+
+/**
+ * Enumerates and evaluates all the candidate tiling configs of an operator.
+ * Returns false if the operator is not tiled by one of the SMV
+ * TilingOptimizers.
+ */
+bool exploreTilings(Operator* op, std::vector<Candidate>& candidates) {
+    std::vector<TilingConfig> configs;
+    std::function<TilingCost(const TilingConfig&)> estimateCost;
+    TensorShape inputsShape, weightsShape, outputsShape;
+    std::vector<int> inputHalos;
+    if (auto convOp = dynamic_cast<SmvConvolutionOp*>(op)) {
+        configs = conv::TilingOptimizer::enumTilingConfigs(convOp);
+        estimateCost = [convOp](const TilingConfig& config) {
+            return conv::TilingOptimizer::estimateCost(convOp, config);
+        };
+        inputsShape = convOp->getInput(SmvConvolutionOp::Inputs)->getShape();
+        weightsShape = convOp->getInput(SmvConvolutionOp::Kernels)->getShape();
+        outputsShape = convOp->getOutput(SmvConvolutionOp::Outputs)->getShape();
+        inputHalos = { 0, convOp->getWeightRows() - convOp->getRowStride(), 0,
+                       0 };
+    } else if (auto fcOp = dynamic_cast<SmvInnerProductOp*>(op)) {
+        configs = fc::TilingOptimizer::enumTilingConfigs(fcOp);
+        estimateCost = [fcOp](const TilingConfig& config) {
+            return fc::TilingOptimizer::estimateCost(fcOp, config);
+        };
+        inputsShape = fcOp->getInput(SmvInnerProductOp::Inputs)->getShape();
+        weightsShape = fcOp->getInput(SmvInnerProductOp::Weights)->getShape();
+        outputsShape = fcOp->getOutput(SmvInnerProductOp::Outputs)->getShape();
+    } else if (auto poolOp = dynamic_cast<SmvPoolingOp*>(op)) {
+        configs = pool::TilingOptimizer::enumTilingConfigs(poolOp);
+        estimateCost = [poolOp](const TilingConfig& config) {
+            return pool::TilingOptimizer::estimateCost(poolOp, config);
+        };
+        inputsShape = poolOp->getInput(0)->getShape();
+        outputsShape = poolOp->getOutput(0)->getShape();
+        std::pair<int, int> poolSize = poolOp->getPoolingSize();
+        std::pair<int, int> poolStride = poolOp->getPoolingStride();
+        inputHalos = { 0, poolSize.first - poolStride.first,
+                       poolSize.second - poolStride.second, 0 };
+    } else if (auto bnOp = dynamic_cast<SmvBatchNormOp*>(op)) {
+        Tensor* inputs = bnOp->getInput(SmvBatchNormOp::Inputs);
+        Tensor* outputs = bnOp->getOutput(SmvBatchNormOp::Outputs);
+        // The same concatenated weights tensor that doTiling() tiles.
+        Tensor* weights = concatTensors(
+                { bnOp->getInput(SmvBatchNormOp::Mean),
+                  bnOp->getInput(SmvBatchNormOp::Variance),
+                  bnOp->getInput(SmvBatchNormOp::Gamma),
+                  bnOp->getInput(SmvBatchNormOp::Beta) },
+                0, bnOp->getWorkspace());
+        configs = bn::TilingOptimizer::enumTilingConfigs(
+                inputs, weights, outputs);
+        estimateCost = [inputs, weights](const TilingConfig& config) {
+            return bn::TilingOptimizer::estimateCost(inputs, weights, config);
+        };
+        inputsShape = inputs->getShape();
+        weightsShape = weights->getShape();
+        outputsShape = outputs->getShape();
+    } else {
+        return false;
+    }
+
+    if (inputHalos.empty())
+        inputHalos.assign(inputsShape.ndims(), 0);
+    std::vector<int> noHalos(outputsShape.ndims(), 0);
+    int maxTileSize = SmvBackend::SpadSize() /
+                      static_cast<Tensor*>(op->getInputs()[0])
+                              ->getDataTypeSize();
+    for (auto& config : configs) {
+        Candidate candidate;
+        candidate.config = config;
+        candidate.cost = estimateCost(config);
+        candidate.inputTiles =
+                countTiles(inputsShape, config.inputs, inputHalos);
+        candidate.weightTiles =
+                countTiles(weightsShape,
+                           config.weights,
+                           std::vector<int>(weightsShape.ndims(), 0));
+        candidate.outputTiles =
+                countTiles(outputsShape, config.outputs, noHalos);
+        // Each of inputs, weights and outputs has a scratchpad of its own.
+        int numSpads = config.weights.ndims() == 0 ? 2 : 3;
+        candidate.utilization =
+                100.0 * config.getTotalSize() / (numSpads * maxTileSize);
+        candidates.push_back(candidate);
+    }
+    return true;
+}
+
+void printCandidates(Operator* op,
+                     std::vector<Candidate>& candidates,
+                     const std::string& sortBy,
+                     int maxRows) {
+    // Find the configs that the two tiling objectives would pick. Both keep
+    // the first of equally good candidates, as chooseBestConfig() does.
+    int maxUtilIdx = 0, minCostIdx = 0;
+    for (int i = 1; i < candidates.size(); i++) {
+        if (candidates[maxUtilIdx].config.getTotalSize() <
+            candidates[i].config.getTotalSize())
+            maxUtilIdx = i;
+        if (candidates[i].cost < candidates[minCostIdx].cost)
+            minCostIdx = i;
+    }
+    std::vector<int> order(candidates.size());
+    for (int i = 0; i < order.size(); i++)
+        order[i] = i;
+    if (sortBy == "utilization") {
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return candidates[a].config.getTotalSize() >
+                   candidates[b].config.getTotalSize();
+        });
+    } else if (sortBy == "data-movement") {
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return candidates[a].cost < candidates[b].cost;
+        });
+    }
+
+    const TilingConfig& first = candidates.front().config;
+    std::cout << op->getName() << " (" << OpType_Name(op->getOpType())
+              << ")\n";
+    std::cout << "  Tiling dims: inputs " << first.inputTilingDims;
+    if (first.weights.ndims() != 0)
+        std::cout << ", weights " << first.weightTilingDims;
+    std::cout << ", outputs " << first.outputTilingDims << "\n";
+    std::cout << "  Candidates: " << candidates.size()
+              << " (U: max utilization pick, D: min data movement pick)\n";
+
+    static const char* kHeaderFormat =
+            "  %5s %2s %16s %16s %16s %16s %8s %12s %12s %12s %12s %11s\n";
+    static const char* kRowFormat =
+            "  %5d %2s %16s %16s %16s %16s %8.1f %12d %12d %12d %12d %11d\n";
+    std::cout << boost::format(kHeaderFormat) % "#" % "" % "Input tile" %
+                         "Weight tile" % "Output tile" % "Tiles (I/W/O)" %
+                         "Util (%)" % "Input B" % "Weight B" % "Output B" %
+                         "Total B" % "Invocations";
+    int rows = 0;
+    for (int i : order) {
+        // Always show the picks of both objectives.
+        if (maxRows > 0 && rows >= maxRows && i != maxUtilIdx &&
+            i != minCostIdx)
+            continue;
+        rows++;
+        const Candidate& c = candidates[i];
+        std::string picks = std::string(i == maxUtilIdx ? "U" : "") +
+                            std::string(i == minCostIdx ? "D" : "");
+        std::string tiles = std::to_string(c.inputTiles) + "/" +
+                            std::to_string(c.weightTiles) + "/" +
+                            std::to_string(c.outputTiles);
+        std::cout << boost::format(kRowFormat) % i % picks %
+                             dimsString(c.config.inputs) %
+                             dimsString(c.config.weights) %
+                             dimsString(c.config.outputs) % tiles %
+                             c.utilization % c.cost.inputBytes %
+                             c.cost.weightBytes % c.cost.outputBytes %
+                             c.cost.getTotalBytes() % c.cost.invocations;
+    }
+    if (rows < candidates.size()) {
+        std::cout << "  ... " << candidates.size() - rows
+                  << " more candidates not shown\n";
+    }
+    std::cout << "\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string modelTopo;
+    std::string modelParams;
+    std::vector<std::string> layers;
+    int debugLevel = -1;
+    int spadSizeKB = 32;
+    std::string sortBy = "none";
+    int maxRows = 0;
+    runningInSimulation = false;
+    po::options_description options(
+            "SMAUG tiling explorer usage:  ./smaug-tiling [model_topo.pbtxt "
+            "model_params.pb] [--layer spec]... [options]\n\n"
+            "Enumerates every candidate tiling config the SMV tiling "
+            "optimizers consider for each convolution, inner product, pooling "
+            "and batch norm layer, and prints the tile counts, scratchpad "
+            "utilization, estimated DMA traffic and accelerator invocations "
+            "of each. Nothing is executed. Layers come from a model, or from "
+            "--layer specs of the forms:\n"
+            "  conv:NxHxWxC:RxSxK[:stride[:same|valid]]\n"
+            "  fc:NxA:K\n"
+            "  pool:NxHxWxC:RxS[:stride]\n"
+            "  bn:NxHxWxC or bn:NxA");
+    // clang-format off
+    options.add_options()
+        ("help,h", "Display this help message")
+        ("debug-level", po::value(&debugLevel)->implicit_value(0),
+         "Set the debugging output level. If omitted, all debugging output "
+         "is ignored. If specified without a value, the debug level is set "
+         "to zero.")
+        ("layer", po::value(&layers),
+         "Explore a single layer instead of (or in addition to) a model. May "
+         "be given multiple times.")
+        ("spad-size", po::value(&spadSizeKB),
+         "Size of each of the SMV scratchpads in KB.")
+        ("sort-by", po::value(&sortBy),
+         "Order the candidates by \"utilization\" or \"data-movement\". By "
+         "default, they are listed in enumeration order.")
+        ("max-rows", po::value(&maxRows),
+         "Show at most this many candidates per layer, plus the picks of "
+         "both tiling objectives. Zero shows all of them.");
+    // clang-format on
+
+    po::options_description hidden;
+    hidden.add_options()("model-topo-file", po::value(&modelTopo),
+                         "Model topology protobuf file");
+    hidden.add_options()("model-params-file", po::value(&modelParams),
+                         "Model parameters protobuf file");
+    po::options_description all, visible;
+    all.add(options).add(hidden);
+    visible.add(options);
+
+    po::positional_options_description p;
+    p.add("model-topo-file", 1);
+    p.add("model-params-file", 1);
+    po::variables_map vm;
+    try {
+        po::store(po::command_line_parser(argc, argv)
+                          .options(all)
+                          .positional(p)
+                          .run(),
+                  vm);
+        po::notify(vm);
+    } catch (po::error& e) {
+        std::cout << "ERROR: " << e.what() << "\n";
+        exit(1);
+    }
+
+    if (vm.count("help")) {
+        std::cout << visible << "\n";
+        return 1;
+    }
+    if (modelTopo.empty() != modelParams.empty()) {
+        std::cout << "Both model protobuf files must be specified!\n";
+        exit(1);
+    }
+    if (modelTopo.empty() && layers.empty()) {
+        std::cout << "Specify a model or at least one layer!\n";
+        exit(1);
+    }
+    if (sortBy != "none" && sortBy != "utilization" &&
+        sortBy != "data-movement") {
+        std::cout << "Doesn't support the specified sort order: " << sortBy
+                  << "\n";
+        exit(1);
+    }
+    if (spadSizeKB <= 0) {
+        std::cout << "Invalid scratchpad size: " << spadSizeKB << "\n";
+        exit(1);
+    }
+    initDebugStream(debugLevel);
+    // Only the tiling optimizers use the scratchpad size; nothing runs on the
+    // scratchpads, so they are not allocated.
+    smv::kSpadSize = spadSizeKB * 1024;
+    std::cout << "Scratchpad size: " << spadSizeKB << " KB\n\n";
+
+    Workspace* workspace = new Workspace();
+    std::vector<Operator*> ops;
+    Network* network = nullptr;
+    if (!modelTopo.empty()) {
+        SamplingInfo sampling;
+        network = buildNetwork(modelTopo, modelParams, sampling, workspace);
+        std::list<Vertex> vertices;
+        const Graph& graph = network->getGraph();
+        boost::topological_sort(graph, std::front_inserter(vertices));
+        for (auto vertex : vertices)
+            ops.push_back(get(boost::vertex_op, graph, vertex));
+    }
+    std::vector<Operator*> layerOps;
+    for (int i = 0; i < layers.size(); i++) {
+        Operator* op = createLayer(
+                layers[i], "layer" + std::to_string(i), workspace);
+        if (!op) {
+            std::cout << "Invalid layer spec: " << layers[i] << "\n";
+            exit(1);
+        }
+        layerOps.push_back(op);
+        ops.push_back(op);
+    }
+
+    int numExplored = 0;
+    for (auto op : ops) {
+        std::vector<Candidate> candidates;
+        if (!exploreTilings(op, candidates))
+            continue;
+        printCandidates(op, candidates, sortBy, maxRows);
+        numExplored++;
+    }
+    if (numExplored == 0) {
+        std::cout << "No SMV convolution, inner product, pooling or batch "
+                     "norm layers found.\n";
+    }
+
+    for (auto op : layerOps)
+        delete op;
+    delete network;
+    delete workspace;
+
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <immintrin.h>
+
+#include "fp16.h"
+#include "smaug/core/globals.h"
+#include "smaug/utility/fp16_convert.h"
+#include "smaug/utility/thread_pool.h"
+
+namespace smaug {
+
+namespace {
+
+/** Threads cost more than they save on fewer elements than this. */
+constexpr size_t kMinElemsPerThread = 1 << 16;
+
+/** Every thread but the last converts a multiple of this many elements. */
+constexpr size_t kChunkAlignment = 64;
+
+typedef void (*ToHalfFunc)(float16*, const float*, size_t);
+typedef void (*ToFloatFunc)(float*, const float16*, size_t);
+
+void toHalfScalar(float16* dst, const float* src, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        dst[i] = fp16_ieee_from_fp32_value(src[i]);
+}
+
+void toFloatScalar(float* dst, const float16* src, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        dst[i] = fp16_ieee_to_fp32_value(src[i]);
+}
+
+// The binaries are built for SSE3 so they run in gem5, which does not support
+// the YMM registers, so the vector versions are compiled for the ISA they need
+// and only picked at runtime, natively.
+
+__attribute__((target("avx,f16c")))
+void toHalfF16c(float16* dst, const float* src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(src + i),
+                                       _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), half);
+    }
+    toHalfScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx,f16c")))
+void toFloatF16c(float* dst, const float16* src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i half =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+    }
+    toFloatScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+void toHalfAvx512(float16* dst, const float* src, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(src + i),
+                                       _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), half);
+    }
+    toHalfScalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+void toFloatAvx512(float* dst, const float16* src, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i half =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(half));
+    }
+    toFloatScalar(dst + i, src + i, n - i);
+}
+
+struct Converters {
+    ToHalfFunc toHalf;
+    ToFloatFunc toFloat;
+};
+
+/** Returns the conversion functions for the CPU we are running on. */
+const Converters& getConverters() {
+    static const Converters converters = []() -> Converters {
+        if (runningInSimulation)
+            return { toHalfScalar, toFloatScalar };
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return { toHalfAvx512, toFloatAvx512 };
+        if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c"))
+            return { toHalfF16c, toFloatF16c };
+        return { toHalfScalar, toFloatScalar };
+    }();
+    return converters;
+}
+
+/** Calls convert(start, end) on chunks of [0, n), in parallel if worth it. */
+template <typename ConvertFunc>
+void splitConversion(size_t n, const ConvertFunc& convert) {
+    size_t numThreads = 1;
+#ifndef TRACE_MODE
+    if (!runningInSimulation && threadPool) {
+        numThreads = std::min<size_t>(threadPool->size() + 1,
+                                      n / kMinElemsPerThread);
+    }
+#endif
+    if (numThreads <= 1) {
+        convert(0, n);
+        return;
+    }
+    size_t chunk = (n + numThreads - 1) / numThreads;
+    chunk = (chunk + kChunkAlignment - 1) / kChunkAlignment * kChunkAlignment;
+    auto convertChunk = [&](size_t index) {
+        size_t start = std::min(n, index * chunk);
+        convert(start, std::min(n, start + chunk));
+    };
+    if (threadPool->isInitialized()) {
+        threadPool->parallelFor(0, numThreads, 1, [&](int start, int end) {
+            for (int i = start; i < end; i++)
+                convertChunk(i);
+        });
+        return;
+    }
+    // Model loading happens before the thread pool starts, so use threads of
+    // our own, which are gone again by the time this returns.
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < numThreads; i++)
+        threads.emplace_back(convertChunk, i);
+    convertChunk(0);
+    for (auto& thread : threads)
+        thread.join();
+}
+
+}  // namespace
+
+void convertFp32ToFp16(float16* dst, const float* src, size_t n) {
+    ToHalfFunc toHalf = getConverters().toHalf;
+    splitConversion(n, [&](size_t start, size_t end) {
+        toHalf(dst + start, src + start, end - start);
+    });
+}
+
+void convertFp16ToFp32(float* dst, const float16* src, size_t n) {
+    ToFloatFunc toFloat = getConverters().toFloat;
+    splitConversion(n, [&](size_t start, size_t end) {
+        toFloat(dst + start, src + start, end - start);
+    });
+}
+
+}  // namespace smaug
@@ -0,0 +1,43 @@
+#ifndef _UTILITY_FP16_CONVERT_H_
+#define _UTILITY_FP16_CONVERT_H_
+
+#include <cstddef>
+
+#include "smaug/core/datatypes.h"
+
+namespace smaug {
+
+/**
+ * \defgroup BulkFp16Conversion Bulk precision conversion on the host
+ *
+ * Convert whole buffers between single and half precision, for host-side
+ * tensor preparation (e.g. converting weights when a model is loaded). These
+ * are not meant for kernels, which must use the _CVT_* macros of
+ * fp16_utils.h, so that they can be traced and simulated.
+ *
+ * The conversion uses the widest vector instructions the CPU supports
+ * (AVX-512F, or F16C), picked at runtime, and falls back to the FP16 library
+ * otherwise. Either way, the results are rounded to nearest even, and are the
+ * same as the FP16 library's, except for the payloads of NaNs. Large buffers
+ * are split across the threads of the global thread pool; before the pool has
+ * been initialized, the conversion spawns as many short-lived threads
+ * instead. Outside of native execution, the conversion runs on the calling
+ * thread only.
+ *
+ * The source and destination buffers must not overlap.
+ * @{
+ */
+
+/** Converts n single-precision floats in src to half precision in dst. */
+void convertFp32ToFp16(float16* dst, const float* src, size_t n);
+
+/** Converts n half-precision floats in src to single precision in dst. */
+void convertFp16ToFp32(float* dst, const float16* src, size_t n);
+
+/**
+ * @}
+ */
+
+}  // namespace smaug
+
+#endif
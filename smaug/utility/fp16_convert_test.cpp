@@ -0,0 +1,99 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "catch.hpp"
+#include "fp16.h"
+#include "smaug/core/globals.h"
+#include "smaug/utility/fp16_convert.h"
+#include "smaug/utility/thread_pool.h"
+
+using namespace smaug;
+
+namespace {
+
+/** Values that exercise rounding, subnormals, overflow and the signs. */
+std::vector<float> makeFp32Data(size_t n) {
+    std::vector<float> data(n);
+    const float specials[] = { 0.0f,
+                               -0.0f,
+                               1.0f,
+                               -2.5f,
+                               // Halfway between two half-precision values.
+                               1.0f + 1.0f / 2048,
+                               1.0f + 3.0f / 2048,
+                               65504.0f,
+                               70000.0f,
+                               -1e10f,
+                               6e-8f,
+                               -3e-5f,
+                               1e-10f,
+                               std::numeric_limits<float>::infinity() };
+    const size_t numSpecials = sizeof(specials) / sizeof(specials[0]);
+    for (size_t i = 0; i < n; i++) {
+        data[i] = i % 3 == 0 ? specials[i / 3 % numSpecials]
+                             : ((int)(i % 2001) - 1000) * 0.37f;
+    }
+    return data;
+}
+
+void verifyFp32ToFp16(size_t n) {
+    std::vector<float> src = makeFp32Data(n);
+    std::vector<float16> dst(n);
+    convertFp32ToFp16(dst.data(), src.data(), n);
+    for (size_t i = 0; i < n; i++)
+        REQUIRE(dst[i] == fp16_ieee_from_fp32_value(src[i]));
+}
+
+void verifyFp16ToFp32(size_t n) {
+    std::vector<float16> src(n);
+    for (size_t i = 0; i < n; i++) {
+        // Every bit pattern but the NaNs, whose payloads may differ.
+        src[i] = i % 0x7c01;
+        if (i % 2)
+            src[i] |= 0x8000;
+    }
+    std::vector<float> dst(n);
+    convertFp16ToFp32(dst.data(), src.data(), n);
+    for (size_t i = 0; i < n; i++) {
+        float expected = fp16_ieee_to_fp32_value(src[i]);
+        REQUIRE(std::signbit(dst[i]) == std::signbit(expected));
+        REQUIRE(dst[i] == expected);
+    }
+}
+
+}  // namespace
+
+TEST_CASE("Bulk fp16 conversion", "[fp16]") {
+    SECTION("Sizes around the vector widths") {
+        for (size_t n : { 0, 1, 7, 8, 9, 15, 16, 17, 33, 1000 }) {
+            verifyFp32ToFp16(n);
+            verifyFp16ToFp32(n);
+        }
+    }
+
+    SECTION("Large buffers across threads") {
+        size_t n = (1 << 18) + 13;
+        threadPool = new ThreadPool(3);
+        // Before the pool starts, the conversion spawns threads of its own.
+        verifyFp32ToFp16(n);
+        verifyFp16ToFp32(n);
+        threadPool->initThreadPool();
+        verifyFp32ToFp16(n);
+        verifyFp16ToFp32(n);
+        delete threadPool;
+        threadPool = nullptr;
+    }
+
+    SECTION("Round trip") {
+        size_t n = 4096;
+        std::vector<float> src = makeFp32Data(n);
+        std::vector<float16> half(n);
+        std::vector<float16> halfAgain(n);
+        std::vector<float> single(n);
+        convertFp32ToFp16(half.data(), src.data(), n);
+        convertFp16ToFp32(single.data(), half.data(), n);
+        convertFp32ToFp16(halfAgain.data(), single.data(), n);
+        REQUIRE(half == halfAgain);
+    }
+}
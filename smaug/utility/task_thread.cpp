@@ -0,0 +1,69 @@
+#include "smaug/utility/task_thread.h"
+
+namespace smaug {
+
+TaskThread::TaskThread() : lastQueued(0), lastFinished(0), exit(false) {
+    pthread_mutex_init(&mutex, NULL);
+    pthread_cond_init(&wakeupCond, NULL);
+    pthread_cond_init(&finishedCond, NULL);
+    pthread_create(&thread, NULL, &TaskThread::threadLoop, this);
+}
+
+TaskThread::~TaskThread() {
+    pthread_mutex_lock(&mutex);
+    exit = true;
+    pthread_cond_signal(&wakeupCond);
+    pthread_mutex_unlock(&mutex);
+    pthread_join(thread, NULL);
+    pthread_mutex_destroy(&mutex);
+    pthread_cond_destroy(&wakeupCond);
+    pthread_cond_destroy(&finishedCond);
+}
+
+TaskThread::Ticket TaskThread::enqueue(std::function<void()> task) {
+    pthread_mutex_lock(&mutex);
+    tasks.push_back(std::move(task));
+    Ticket ticket = ++lastQueued;
+    pthread_cond_signal(&wakeupCond);
+    pthread_mutex_unlock(&mutex);
+    return ticket;
+}
+
+void TaskThread::wait(Ticket ticket) {
+    pthread_mutex_lock(&mutex);
+    while (lastFinished < ticket)
+        pthread_cond_wait(&finishedCond, &mutex);
+    pthread_mutex_unlock(&mutex);
+}
+
+void TaskThread::join() {
+    pthread_mutex_lock(&mutex);
+    Ticket ticket = lastQueued;
+    pthread_mutex_unlock(&mutex);
+    wait(ticket);
+}
+
+void* TaskThread::threadLoop(void* args) {
+    TaskThread* thread = reinterpret_cast<TaskThread*>(args);
+    pthread_mutex_lock(&thread->mutex);
+    while (true) {
+        while (thread->tasks.empty() && !thread->exit)
+            pthread_cond_wait(&thread->wakeupCond, &thread->mutex);
+        // Finish the queued tasks before exiting.
+        if (thread->tasks.empty())
+            break;
+        std::function<void()> task = std::move(thread->tasks.front());
+        thread->tasks.pop_front();
+        pthread_mutex_unlock(&thread->mutex);
+
+        task();
+
+        pthread_mutex_lock(&thread->mutex);
+        thread->lastFinished++;
+        pthread_cond_broadcast(&thread->finishedCond);
+    }
+    pthread_mutex_unlock(&thread->mutex);
+    return NULL;
+}
+
+}  // namespace smaug
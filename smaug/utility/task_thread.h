@@ -0,0 +1,63 @@
+#ifndef _UTILITY_TASK_THREAD_H_
+#define _UTILITY_TASK_THREAD_H_
+
+#include <pthread.h>
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+namespace smaug {
+
+/**
+ * A host thread that runs the tasks queued on it one at a time, in the order
+ * they were queued.
+ *
+ * Unlike the ThreadPool, which hands out one function at a time to any idle
+ * worker, a TaskThread keeps a queue of work, so the caller can run ahead of
+ * it. This is used to model an accelerator on the host, and to overlap tensor
+ * preparation with computation. It is not meant to be used in simulation.
+ */
+class TaskThread {
+   public:
+    /**
+     * Identifies a queued task. Tasks finish in the order of their tickets.
+     */
+    typedef uint64_t Ticket;
+
+    TaskThread();
+    ~TaskThread();
+
+    /**
+     * Queues a task. This is safe to call from any thread, including from a
+     * task running on this thread.
+     */
+    Ticket enqueue(std::function<void()> task);
+
+    /** Wait until the task with the given ticket has finished. */
+    void wait(Ticket ticket);
+
+    /** Wait until all the queued tasks have finished. */
+    void join();
+
+   protected:
+    static void* threadLoop(void* args);
+
+    pthread_t thread;
+    /** This mutex protects all of the subsequent fields. */
+    pthread_mutex_t mutex;
+    std::deque<std::function<void()>> tasks;
+    /** The ticket of the last queued task. */
+    Ticket lastQueued;
+    /** The ticket of the last finished task. */
+    Ticket lastFinished;
+    /** Set to true to inform the thread to terminate. */
+    bool exit;
+    /** Signaled when a task is queued or the thread should exit. */
+    pthread_cond_t wakeupCond;
+    /** Signaled when a task finishes. */
+    pthread_cond_t finishedCond;
+};
+
+}  // namespace smaug
+
+#endif
@@ -1,3 +1,12 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <unistd.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "smaug/utility/thread_pool.h"
 #include "smaug/utility/utils.h"
 #include "smaug/core/globals.h"
@@ -5,112 +14,273 @@
 
 namespace smaug {
 
-ThreadPool::ThreadPool(int nthreads) : workers(nthreads) {}
+namespace {
+
+/** The index of the pool worker running on this thread, or -1. */
+thread_local int currentWorker = -1;
+
+/** Tells the CPU that this is a spin loop. */
+inline void spinPause() {
+#ifdef __SSE2__
+    _mm_pause();
+#endif
+}
+
+}  // namespace
+
+ThreadPool::ThreadPool(int nthreads, const Options& _options)
+        : workers(nthreads), initialized(false), options(_options),
+          nextWorker(0), numQueued(0), numSleeping(0), numWaiting(0),
+          exit(false), dispatched(this) {
+    pthread_mutex_init(&idleMutex, NULL);
+    pthread_cond_init(&workCond, NULL);
+    pthread_cond_init(&doneCond, NULL);
+}
 
 ThreadPool::~ThreadPool() {
-    // Shutdown the thread pool and free all resources.
-    for (int i = 0; i < workers.size(); i++) {
-        WorkerThread* worker = &workers[i];
-        gem5::wakeCpu(worker->cpuid);
-        pthread_mutex_lock(&worker->statusMutex);
-        worker->exit = true;
-        pthread_cond_signal(&worker->wakeupCond);
-        pthread_mutex_unlock(&worker->statusMutex);
-    }
-    for (int i = 0; i < workers.size(); i++) {
-        WorkerThread* worker = &workers[i];
-        pthread_join(worker->thread, NULL);
-        pthread_mutex_destroy(&worker->statusMutex);
-        pthread_cond_destroy(&worker->wakeupCond);
-        pthread_cond_destroy(&worker->statusCond);
+    // Finish any outstanding work, then shut down the thread pool and free all
+    // resources.
+    dispatched.wait();
+    pthread_mutex_lock(&idleMutex);
+    exit = true;
+    pthread_cond_broadcast(&workCond);
+    pthread_mutex_unlock(&idleMutex);
+    if (initialized) {
+        for (int i = 0; i < workers.size(); i++)
+            gem5::wakeCpu(workers[i].cpuid);
+        for (int i = 0; i < workers.size(); i++)
+            pthread_join(workers[i].thread, NULL);
     }
+    pthread_mutex_destroy(&idleMutex);
+    pthread_cond_destroy(&workCond);
+    pthread_cond_destroy(&doneCond);
 }
 
 void* ThreadPool::workerLoop(void* args) {
     ThreadInitArgs* initArgs = reinterpret_cast<ThreadInitArgs*>(args);
-    WorkerThread* worker = initArgs->worker;
+    ThreadPool* pool = initArgs->pool;
+    const int index = initArgs->index;
+    currentWorker = index;
+    pool->pinWorker(index);
     // Notify the main thread about this thread's cpuid. This can only be done
     // after the thread context is created.
     pthread_mutex_lock(&initArgs->cpuidMutex);
     initArgs->cpuid = gem5::getCpuId();
-    worker->status = Idle;
     pthread_cond_signal(&initArgs->cpuidCond);
     pthread_mutex_unlock(&initArgs->cpuidMutex);
 
-    do {
-        gem5::quiesce();
-        pthread_mutex_lock(&worker->statusMutex);
-        while (!worker->valid && !worker->exit)
-            pthread_cond_wait(&worker->wakeupCond, &worker->statusMutex);
-        if (worker->valid) {
-            worker->status = Running;
-            pthread_mutex_unlock(&worker->statusMutex);
-
-            // Run the function.
-            worker->func(worker->args);
-
-            pthread_mutex_lock(&worker->statusMutex);
-            worker->status = Idle;
-            worker->valid = false;
-            pthread_cond_signal(&worker->statusCond);
+    const int maxSpinMicros = pool->options.maxSpinMicros;
+    int spinMicros = maxSpinMicros;
+    while (true) {
+        Task task;
+        if (pool->takeTask(index, task)) {
+            pool->runTask(task);
+            continue;
         }
-        bool exitThread = worker->exit;
-        pthread_mutex_unlock(&worker->statusMutex);
+        if (maxSpinMicros > 0) {
+            // Spin longer if work tends to show up while spinning, and less if
+            // the spinning is wasted.
+            bool foundWork = pool->spinForWork(spinMicros);
+            spinMicros = foundWork ? std::min(spinMicros * 2, maxSpinMicros)
+                                   : std::max(spinMicros / 2,
+                                              std::max(maxSpinMicros / 8, 1));
+            if (foundWork && !pool->exit)
+                continue;
+        }
+        if (pool->options.quiesceIdleWorkers)
+            gem5::quiesce();
+        pthread_mutex_lock(&pool->idleMutex);
+        // Announce the sleep before checking for work, so that enqueue()
+        // either sees a sleeper to wake or this sees its task.
+        pool->numSleeping++;
+        while (pool->numQueued <= 0 && !pool->exit)
+            pthread_cond_wait(&pool->workCond, &pool->idleMutex);
+        pool->numSleeping--;
+        // Finish the queued tasks before exiting.
+        bool exitThread = pool->exit && pool->numQueued <= 0;
+        pthread_mutex_unlock(&pool->idleMutex);
         if (exitThread)
             break;
-    } while (true);
+    }
 
     pthread_exit(NULL);
 }
 
+void ThreadPool::pinWorker(int index) {
+    if (!options.pinWorkers || runningInSimulation)
+        return;
+    long numCpus = sysconf(_SC_NPROCESSORS_ONLN);
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET((index + 1) % numCpus, &cpus);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+}
+
+bool ThreadPool::spinForWork(int spinMicros) {
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(spinMicros);
+    while (true) {
+        // Only look at the clock every so often.
+        for (int i = 0; i < 64; i++) {
+            if (numQueued > 0 || exit)
+                return true;
+            spinPause();
+        }
+        if (std::chrono::steady_clock::now() >= deadline)
+            return false;
+    }
+}
+
 void ThreadPool::initThreadPool() {
+    assert(!initialized && "The thread pool is already initialized!");
     // Initialize the CPU ID for each worker thread.
     for (int i = 0; i < workers.size(); i++) {
         WorkerThread* worker = &workers[i];
-        ThreadInitArgs initArgs(worker);
+        ThreadInitArgs initArgs(this, i);
         pthread_create(
                 &worker->thread, NULL, &ThreadPool::workerLoop, &initArgs);
 
         // Fill in the CPU ID of the worker thread.
         pthread_mutex_lock(&initArgs.cpuidMutex);
-        while (initArgs.cpuid == -1 || worker->status == Uninitialized)
+        while (initArgs.cpuid == -1)
             pthread_cond_wait(&initArgs.cpuidCond, &initArgs.cpuidMutex);
         worker->cpuid = initArgs.cpuid;
         pthread_mutex_unlock(&initArgs.cpuidMutex);
-        assert(worker->status != Uninitialized &&
-               "Worker thread did not successfully initialize!");
     }
+    initialized = true;
 }
 
-int ThreadPool::dispatchThread(WorkerThreadFunc func, void* args) {
-    for (int i = 0; i < workers.size(); i++) {
-        WorkerThread* worker = &workers[i];
-        pthread_mutex_lock(&worker->statusMutex);
-        if (worker->status == Idle && !worker->valid) {
-            worker->func = func;
-            worker->args = args;
-            worker->valid = true;
-            gem5::wakeCpu(worker->cpuid);
-            pthread_cond_signal(&worker->wakeupCond);
-            pthread_mutex_unlock(&worker->statusMutex);
-            return i;
+int ThreadPool::enqueue(std::function<void()> func, TaskGroup* group) {
+    if (group)
+        group->pending++;
+    Task task = { std::move(func), group };
+    if (!initialized || workers.empty()) {
+        runTask(task);
+        return -1;
+    }
+    // Tasks queued by a worker go on its own deque, where it will find them
+    // first. The others are spread over all the workers.
+    int index = currentWorker;
+    if (index == -1)
+        index = (unsigned)nextWorker++ % workers.size();
+    WorkerThread* worker = &workers[index];
+    pthread_mutex_lock(&worker->queueMutex);
+    worker->tasks.push_back(std::move(task));
+    pthread_mutex_unlock(&worker->queueMutex);
+
+    numQueued++;
+    if (numSleeping > 0) {
+        pthread_mutex_lock(&idleMutex);
+        pthread_cond_signal(&workCond);
+        pthread_mutex_unlock(&idleMutex);
+    }
+    if (options.quiesceIdleWorkers)
+        gem5::wakeCpu(worker->cpuid);
+    return index;
+}
+
+bool ThreadPool::takeTask(int worker, Task& task) {
+    if (numQueued <= 0)
+        return false;
+    if (worker != -1) {
+        WorkerThread* self = &workers[worker];
+        pthread_mutex_lock(&self->queueMutex);
+        if (!self->tasks.empty()) {
+            task = std::move(self->tasks.back());
+            self->tasks.pop_back();
+            pthread_mutex_unlock(&self->queueMutex);
+            numQueued--;
+            return true;
         }
-        pthread_mutex_unlock(&worker->statusMutex);
+        pthread_mutex_unlock(&self->queueMutex);
     }
-    return -1;
+    for (int i = 1; i <= workers.size(); i++) {
+        WorkerThread* victim = &workers[(worker + i) % workers.size()];
+        pthread_mutex_lock(&victim->queueMutex);
+        if (!victim->tasks.empty()) {
+            task = std::move(victim->tasks.front());
+            victim->tasks.pop_front();
+            pthread_mutex_unlock(&victim->queueMutex);
+            numQueued--;
+            return true;
+        }
+        pthread_mutex_unlock(&victim->queueMutex);
+    }
+    return false;
 }
 
-void ThreadPool::joinThreadPool() {
-    // There is no need to call wakeCpu here. If the CPU is quiesced, then
-    // it cannot possibly be running anything, so its status will be Idle, and
-    // this will move on to the next CPU.
-    for (int i = 0; i < workers.size(); i++) {
-        WorkerThread* worker = &workers[i];
-        pthread_mutex_lock(&worker->statusMutex);
-        while (worker->status == Running || worker->valid == true)
-            pthread_cond_wait(&worker->statusCond, &worker->statusMutex);
-        pthread_mutex_unlock(&worker->statusMutex);
+void ThreadPool::runTask(Task& task) {
+    task.func();
+    TaskGroup* group = task.group;
+    if (group && --group->pending == 0 && numWaiting > 0) {
+        pthread_mutex_lock(&idleMutex);
+        pthread_cond_broadcast(&doneCond);
+        pthread_mutex_unlock(&idleMutex);
+    }
+}
+
+void ThreadPool::TaskGroup::run(std::function<void()> task) {
+    pool->enqueue(std::move(task), this);
+}
+
+bool ThreadPool::TaskGroup::spinForCompletion() {
+    int spinMicros = pool->options.maxSpinMicros;
+    if (spinMicros <= 0)
+        return false;
+    auto deadline = std::chrono::steady_clock::now() +
+                    std::chrono::microseconds(spinMicros);
+    while (true) {
+        for (int i = 0; i < 64; i++) {
+            if (pending <= 0 || pool->numQueued > 0)
+                return true;
+            spinPause();
+        }
+        if (std::chrono::steady_clock::now() >= deadline)
+            return false;
     }
 }
 
+void ThreadPool::TaskGroup::wait() {
+    while (pending > 0) {
+        Task task;
+        if (pool->takeTask(currentWorker, task)) {
+            pool->runTask(task);
+            continue;
+        }
+        // The rest of this group's tasks are running elsewhere.
+        if (spinForCompletion())
+            continue;
+        pthread_mutex_lock(&pool->idleMutex);
+        pool->numWaiting++;
+        while (pending > 0 && pool->numQueued <= 0)
+            pthread_cond_wait(&pool->doneCond, &pool->idleMutex);
+        pool->numWaiting--;
+        pthread_mutex_unlock(&pool->idleMutex);
+    }
+}
+
+void ThreadPool::parallelFor(int begin,
+                             int end,
+                             int grain,
+                             const std::function<void(int, int)>& func) {
+    grain = std::max(grain, 1);
+    if (end - begin <= grain) {
+        if (begin < end)
+            func(begin, end);
+        return;
+    }
+    TaskGroup group(this);
+    for (int start = begin; start < end; start += grain) {
+        int stop = std::min(start + grain, end);
+        group.run([&func, start, stop]() { func(start, stop); });
+    }
+    group.wait();
+}
+
+int ThreadPool::dispatchThread(WorkerThreadFunc func, void* args) {
+    return enqueue([func, args]() { func(args); }, &dispatched);
+}
+
+void ThreadPool::joinThreadPool() { dispatched.wait(); }
+
 }  // namespace smaug
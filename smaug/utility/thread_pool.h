@@ -2,13 +2,27 @@
 #define _UTILITY_THREAD_POOL_H_
 
 #include <pthread.h>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
 #include <vector>
 
 namespace smaug {
 
 /**
- * A user-space cooperatve thread pool implementation designed for gem5 in SE
- * mode.
+ * A work-stealing task pool, designed to also work in gem5 SE mode.
+ *
+ * Every worker has a deque of tasks. A worker runs the tasks of its own deque
+ * newest first, and when that runs dry, it steals the oldest task from
+ * another worker. Tasks queued from outside the pool are spread round-robin
+ * over the workers, and tasks queued from a worker go on its own deque. Any
+ * number of tasks can be queued, and they can be waited on through a
+ * TaskGroup or a future. parallelFor() splits a range of indices into tasks.
+ *
+ * A thread that waits on a TaskGroup runs queued tasks in the meantime, so
+ * tasks may wait on task groups of their own without deadlocking the pool.
  *
  * Multithreading in gem5 SE mode is tricky - while we can spawn pthreads, we
  * cannot let threads terminate when the pthread function returns, because the
@@ -16,19 +30,49 @@ namespace smaug {
  * that was assigned to that ThreadContext. The solution is to run an infinite
  * loop on all the threads in the pool and assign work to them from a queue.
  *
- * To prevent wasting simulation time with spinloops, this thread pool
- * implementation quiesces all inactive CPUs and wakes them up only when there
- * is work to do. This is done via magic gem5 instructions.
+ * To prevent wasting simulation time with spinloops, idle workers can be
+ * quiesced and woken up only when there is work to do. This is done via
+ * magic gem5 instructions, and only has an effect in simulation.
+ *
+ * Natively, sleeping on a condition variable and being woken up costs several
+ * microseconds per worker, which adds up for fine-grained parallel loops. The
+ * pool can instead let idle workers, and threads waiting on a TaskGroup, spin
+ * for a while before they sleep. While nobody sleeps, queuing a task and
+ * finishing a task group are just atomic updates, so a parallelFor() followed
+ * by its wait behaves like a spinning barrier.
  */
 class ThreadPool {
    public:
+    /** Tuning knobs of the worker threads. */
+    struct Options {
+        /** Quiesce the CPUs of idle workers in gem5. */
+        bool quiesceIdleWorkers;
+        /**
+         * The longest time (in microseconds) that an idle worker spins waiting
+         * for work before it sleeps. Every worker adapts its spin time between
+         * an eighth of this and this, spinning longer while spinning pays off.
+         * Threads waiting on a TaskGroup spin for up to this long too. Zero
+         * disables spinning, which is what simulation wants.
+         */
+        int maxSpinMicros;
+        /**
+         * Natively, pin worker i to CPU i + 1 (modulo the number of CPUs),
+         * leaving CPU 0 to the main thread.
+         */
+        bool pinWorkers;
+
+        Options()
+                : quiesceIdleWorkers(true), maxSpinMicros(0),
+                  pinWorkers(false) {}
+    };
+
     /**
      * Create a ThreadPool with N threads.
      *
      * The simulation must be created with at least N+1 CPUs, since we need one
      * CPU to run the main thread.
      */
-    ThreadPool(int nthreads);
+    ThreadPool(int nthreads, const Options& _options = Options());
     ~ThreadPool();
 
     /** Function signature for any work to be executed on a worker thread. */
@@ -37,76 +81,125 @@ class ThreadPool {
     /** Returns the number of worker threads. */
     int size() const { return workers.size(); }
 
+    /** Returns true once initThreadPool() has started the workers. */
+    bool isInitialized() const { return initialized; }
+
     /**
      * Initialize the thread pool.
      *
      * Initialization must be postponed until after fast-forwarding is
-     * finished, or we will get incorrect CPU IDs.
+     * finished, or we will get incorrect CPU IDs. Until then, tasks run on the
+     * thread that queues them.
      *
      * This can only be called once; any subsequent call will assert fail.
      */
     void initThreadPool();
 
-    /** Dispatch the function to a worker in the thread pool. */
+    /**
+     * A set of tasks that can be waited on together.
+     *
+     * The group must outlive its tasks, which the destructor ensures by
+     * waiting for them.
+     */
+    class TaskGroup {
+       public:
+        TaskGroup(ThreadPool* _pool) : pool(_pool), pending(0) {}
+        ~TaskGroup() { wait(); }
+
+        /** Queues a task in this group. */
+        void run(std::function<void()> task);
+
+        /**
+         * Waits until all the tasks in this group have finished, running
+         * queued tasks of any group in the meantime.
+         */
+        void wait();
+
+       protected:
+        friend class ThreadPool;
+
+        /**
+         * Spins until all the tasks have finished or there are queued tasks to
+         * help with, for up to the pool's maxSpinMicros. Returns false if it
+         * gave up.
+         */
+        bool spinForCompletion();
+
+        ThreadPool* pool;
+        /** The number of tasks in this group that have not finished. */
+        std::atomic<int> pending;
+    };
+
+    /**
+     * Queues a task and returns a future for its result.
+     *
+     * Unlike TaskGroup::wait(), waiting on the future does not run other
+     * tasks, so tasks should not wait on futures of tasks queued after them.
+     */
+    template <typename Func>
+    auto submit(Func func) -> std::future<decltype(func())> {
+        typedef decltype(func()) Result;
+        auto task = std::make_shared<std::packaged_task<Result()>>(
+                std::move(func));
+        std::future<Result> result = task->get_future();
+        enqueue(std::function<void()>([task]() { (*task)(); }), nullptr);
+        return result;
+    }
+
+    /**
+     * Calls func(start, end) on consecutive subranges of [begin, end) of
+     * (up to) grain indices each, in parallel, and returns once all of them
+     * have finished. The calling thread runs some of the subranges too.
+     */
+    void parallelFor(int begin,
+                     int end,
+                     int grain,
+                     const std::function<void(int, int)>& func);
+
+    /**
+     * Dispatch the function to the thread pool.
+     *
+     * Any number of functions can be dispatched before joinThreadPool().
+     *
+     * @return The index of the worker whose deque the function was queued on,
+     * or -1 if the pool is not initialized and the function ran on the
+     * calling thread.
+     */
     int dispatchThread(WorkerThreadFunc func, void* args);
 
-    /** Wait for all threads in the pool to finish work. */
+    /** Wait for all the functions dispatched with dispatchThread() to finish. */
     void joinThreadPool();
 
    protected:
-    /** Possible worker thread states. */
-    enum ThreadStatus { Uninitialized, Idle, Running };
+    /** A queued function, and the group it belongs to (if any). */
+    struct Task {
+        std::function<void()> func;
+        TaskGroup* group;
+    };
 
     /** All state and metadata for a worker thread. */
     struct WorkerThread {
-        WorkerThreadFunc func;
-        /** User-provided arguments. */
-        void* args;
-
         /** pthread handle. */
         pthread_t thread;
-        /**
-         * This mutex protects all of the subsequent fields of this struct. Any
-         * modification of these fields must first acquire this lock.
-         */
-        pthread_mutex_t statusMutex;
-        /** Set to true to inform the worker thread to terminate. */
-        bool exit;
-        /**  Set to true if the func and args are valid and need to be executed. */
-        bool valid;
-        ThreadStatus status;
-        /**
-         * The main thread signals this condition variable to wake up the
-         * thread and have it check for work (indicated by valid = true).
-         */
-        pthread_cond_t wakeupCond;
-        /** 
-         * The worker thread signals this condition variable to inform the main
-         * thread of a change in status (usually from Running -> Idle).
-         */
-        pthread_cond_t statusCond;
+        /** This mutex protects the deque of tasks. */
+        pthread_mutex_t queueMutex;
+        std::deque<Task> tasks;
         /** The gem5 simulation CPU ID assigned to this worker thread. */
         int cpuid;
 
-        WorkerThread() {
-            func = NULL;
-            args = NULL;
-            exit = false;
-            valid = false;
-            status = Uninitialized;
-            pthread_mutex_init(&statusMutex, NULL);
-            pthread_cond_init(&wakeupCond, NULL);
-            pthread_cond_init(&statusCond, NULL);
-        }
+        WorkerThread() : cpuid(-1) { pthread_mutex_init(&queueMutex, NULL); }
+        ~WorkerThread() { pthread_mutex_destroy(&queueMutex); }
     };
 
     struct ThreadInitArgs {
-        WorkerThread* worker;
+        ThreadPool* pool;
+        int index;
         pthread_mutex_t cpuidMutex;
         pthread_cond_t cpuidCond;
         int cpuid;
 
-        ThreadInitArgs(WorkerThread* _worker) : worker(_worker) {
+        ThreadInitArgs(ThreadPool* _pool, int _index)
+                : pool(_pool), index(_index) {
             pthread_mutex_init(&cpuidMutex, NULL);
             pthread_cond_init(&cpuidCond, NULL);
             cpuid = -1;
@@ -116,8 +209,65 @@ class ThreadPool {
     /** The main event loop executed by all worker threads. */
     static void* workerLoop(void* args);
 
+    /** Pins the calling worker thread to its CPU, if the options say so. */
+    void pinWorker(int index);
+
+    /**
+     * Spins until there are queued tasks (or the pool exits), for up to
+     * spinMicros. Returns false if it gave up.
+     */
+    bool spinForWork(int spinMicros);
+
+    /**
+     * Queues a task and wakes up an idle worker. Returns the index of the
+     * worker the task was queued on, or -1 if it ran on the calling thread.
+     */
+    int enqueue(std::function<void()> func, TaskGroup* group);
+
+    /**
+     * Takes a task to run on the given worker (or on a thread outside the
+     * pool, if worker is -1): the newest task of the worker's own deque, or
+     * else the oldest task of another worker. Returns false if there are none.
+     */
+    bool takeTask(int worker, Task& task);
+
+    /** Runs a task and accounts for its completion. */
+    void runTask(Task& task);
+
     /** Worker threads. */
     std::vector<WorkerThread> workers;
+
+    /** True once initThreadPool() has started the workers. */
+    bool initialized;
+
+    Options options;
+
+    /** The worker that the next task from outside the pool is queued on. */
+    std::atomic<int> nextWorker;
+
+    /** The number of tasks in all the deques. */
+    std::atomic<int> numQueued;
+
+    /** The number of workers sleeping on workCond. */
+    std::atomic<int> numSleeping;
+
+    /** The number of threads sleeping on doneCond. */
+    std::atomic<int> numWaiting;
+
+    /**
+     * This mutex protects the sleeping of idle workers and task group
+     * waiters, and the exit flag.
+     */
+    pthread_mutex_t idleMutex;
+    /** Signaled when a task is queued or the workers should exit. */
+    pthread_cond_t workCond;
+    /** Signaled when the last task of a task group finishes. */
+    pthread_cond_t doneCond;
+    /** Set to true to inform the worker threads to terminate. */
+    std::atomic<bool> exit;
+
+    /** The group of the functions dispatched with dispatchThread(). */
+    TaskGroup dispatched;
 };
 
 }  // namespace smaug
@@ -0,0 +1,61 @@
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include "smaug/core/globals.h"
+#include "smaug/core/smaug_bench.h"
+#include "smaug/utility/thread_pool.h"
+
+using namespace smaug;
+
+namespace {
+
+/** The number of parallel loops timed per benchmark call. */
+constexpr int kLoopsPerCall = 100;
+
+std::string poolName(const std::string& test, int spinMicros, bool pinned) {
+    return test + " [spin " + std::to_string(spinMicros) + "us" +
+           (pinned ? ", pinned]" : "]");
+}
+
+void benchParallelLoops(SmaugBenchmark& bench,
+                        int numThreads,
+                        int spinMicros,
+                        bool pinned) {
+    ThreadPool::Options options;
+    options.maxSpinMicros = spinMicros;
+    options.pinWorkers = pinned;
+    ThreadPool pool(numThreads, options);
+    pool.initThreadPool();
+    // One task per thread and nothing to do: the cost of a parallel region.
+    bench.run(poolName("empty loop x100", spinMicros, pinned), 0, 0, [&]() {
+        for (int i = 0; i < kLoopsPerCall; i++)
+            pool.parallelFor(0, numThreads + 1, 1, [](int start, int end) {});
+    });
+    // A small elementwise loop, as in the tiles of a small layer.
+    std::vector<float> data(16 * 1024, 1.0f);
+    bench.run(poolName("16K-element loop x100", spinMicros, pinned),
+              kLoopsPerCall * data.size(),
+              kLoopsPerCall * data.size() * sizeof(float) * 2, [&]() {
+                  for (int i = 0; i < kLoopsPerCall; i++) {
+                      pool.parallelFor(
+                              0, data.size(), 1024, [&](int start, int end) {
+                                  for (int j = start; j < end; j++)
+                                      data[j] = data[j] * 0.5f + 0.5f;
+                              });
+                  }
+              });
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    SmaugBenchmark bench(argc, argv);
+    runningInSimulation = false;
+
+    bench.printHeader("Thread pool, 3 workers");
+    benchParallelLoops(bench, 3, 0, false);
+    benchParallelLoops(bench, 3, 50, false);
+    benchParallelLoops(bench, 3, 50, true);
+    return 0;
+}
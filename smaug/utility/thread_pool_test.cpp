@@ -0,0 +1,101 @@
+#include <atomic>
+#include <vector>
+
+#include "catch.hpp"
+#include "smaug/utility/thread_pool.h"
+
+using namespace smaug;
+
+namespace {
+
+void* incrementWorker(void* args) {
+    (*reinterpret_cast<std::atomic<int>*>(args))++;
+    return nullptr;
+}
+
+}  // namespace
+
+TEST_CASE("Work-stealing thread pool", "[threadpool]") {
+    ThreadPool pool(3);
+    pool.initThreadPool();
+
+    SECTION("Parallel for") {
+        // Many more tasks than threads, each of which must run exactly once.
+        std::vector<int> visits(1000, 0);
+        std::atomic<int> oversizedRanges(0);
+        pool.parallelFor(0, visits.size(), 7, [&](int start, int end) {
+            if (end - start > 7)
+                oversizedRanges++;
+            for (int i = start; i < end; i++)
+                visits[i]++;
+        });
+        REQUIRE(oversizedRanges == 0);
+        for (int i = 0; i < visits.size(); i++)
+            REQUIRE(visits[i] == 1);
+    }
+
+    SECTION("Nested task groups") {
+        // Tasks that wait on tasks of their own run the queued tasks while
+        // waiting, so this cannot deadlock even with more tasks than threads.
+        std::atomic<int> count(0);
+        ThreadPool::TaskGroup outer(&pool);
+        for (int i = 0; i < 8; i++) {
+            outer.run([&]() {
+                ThreadPool::TaskGroup inner(&pool);
+                for (int j = 0; j < 8; j++)
+                    inner.run([&]() { count++; });
+                inner.wait();
+            });
+        }
+        outer.wait();
+        REQUIRE(count == 64);
+    }
+
+    SECTION("Futures") {
+        std::vector<std::future<int>> results;
+        for (int i = 0; i < 10; i++)
+            results.push_back(pool.submit([i]() { return i * i; }));
+        for (int i = 0; i < 10; i++)
+            REQUIRE(results[i].get() == i * i);
+    }
+
+    SECTION("Dispatching more functions than threads") {
+        std::atomic<int> count(0);
+        for (int i = 0; i < 20; i++)
+            REQUIRE(pool.dispatchThread(incrementWorker, &count) != -1);
+        pool.joinThreadPool();
+        REQUIRE(count == 20);
+    }
+}
+
+TEST_CASE("Uninitialized thread pool", "[threadpool]") {
+    // Until the pool is initialized, everything runs on the calling thread.
+    ThreadPool pool(2);
+    std::atomic<int> count(0);
+    REQUIRE(pool.dispatchThread(incrementWorker, &count) == -1);
+    REQUIRE(count == 1);
+    pool.parallelFor(0, 10, 1, [&](int start, int end) { count++; });
+    REQUIRE(count == 11);
+    REQUIRE(pool.submit([]() { return 3; }).get() == 3);
+}
+
+TEST_CASE("Low-latency thread pool", "[threadpool]") {
+    ThreadPool::Options options;
+    options.maxSpinMicros = 50;
+    options.pinWorkers = true;
+    ThreadPool pool(3, options);
+    pool.initThreadPool();
+    // Many short parallel loops back to back, so that the workers are
+    // spinning for most of them and sleeping for some.
+    std::vector<int> sums(200, 0);
+    for (int iter = 0; iter < sums.size(); iter++) {
+        std::atomic<int> sum(0);
+        pool.parallelFor(0, 64, 4, [&](int start, int end) {
+            for (int i = start; i < end; i++)
+                sum += i;
+        });
+        sums[iter] = sum;
+    }
+    for (int iter = 0; iter < sums.size(); iter++)
+        REQUIRE(sums[iter] == 64 * 63 / 2);
+}